@@ -69,78 +69,64 @@ def print_joining_table(f):
 	for value,short in short_value.items():
 		print "#define %s	%s" % (short, value)
 
-	uu = sorted(values.keys())
-	num = len(values)
-	all_blocks = set([blocks[u] for u in uu])
-
-	last = -100000
-	ranges = []
-	for u in uu:
-		if u - last <= 1+16*5:
-			ranges[-1][-1] = u
-		else:
-			ranges.append([u,u])
-		last = u
+	def split (block_bits):
+		block_size = 1 << block_bits
+		limit = (max (values.keys ()) + block_size) // block_size * block_size
+		blocks = [tuple (["JOINING_TYPE_X"] * block_size)]
+		block_index = {blocks[0]: 0}
+		index = []
+		for start in range (0, limit, block_size):
+			block = tuple (values.get (u, "JOINING_TYPE_X") for u in range (start, start + block_size))
+			if block not in block_index:
+				block_index[block] = len (blocks)
+				blocks.append (block)
+			index.append (block_index[block])
+		index.append (0)
+		index_size = 1 if len (blocks) <= 256 else 2
+		return limit, index, blocks, len (index) * index_size + len (blocks) * block_size // 2
+
+	# Two joining types per byte; pick the block size giving the smallest tables.
+	block_bits = min (range (4, 9), key = lambda bits: split (bits)[3])
+	block_size = 1 << block_bits
+	limit, index, table_blocks, size = split (block_bits)
+	index_type = "uint8_t" if len (table_blocks) <= 256 else "uint16_t"
 
+	print
+	print "#define _(A,B)	((A) | ((B) << 4))"
 	print
 	print "static const uint8_t joining_table[] ="
 	print "{"
+	first_use = {}
+	for i, b in enumerate (index[:-1]):
+		first_use.setdefault (b, i * block_size)
 	last_block = None
-	offset = 0
-	for start,end in ranges:
-
-		print
-		print "#define joining_offset_0x%04xu %d" % (start, offset)
-
-		for u in range(start, end+1):
-
-			block = blocks.get(u, last_block)
-			value = values.get(u, "JOINING_TYPE_X")
-
-			if block != last_block or u == start:
-				if u != start:
-					print
-				if block in all_blocks:
-					print "\n  /* %s */" % block
-				else:
-					print "\n  /* FILLER */"
-				last_block = block
-				if u % 32 != 0:
-					print
-					print "  /* %04X */" % (u//32*32), "  " * (u % 32),
-
-			if u % 32 == 0:
-				print
-				print "  /* %04X */ " % u,
-			sys.stdout.write("%s," % short_value[value])
+	for b, block in enumerate (table_blocks):
+		start = first_use[b]
+		names = [blocks[u] for u in range (start, start + block_size) if u in values]
+		if names and names[0] != last_block:
+			print
+			print "  /* %s */" % names[0]
+			last_block = names[0]
 		print
-
-		offset += end - start + 1
+		for u in range (start, start + block_size, 32):
+			print "  /* %04X */ %s" % (u, ''.join ("_(%s,%s)," % (short_value[block[i]], short_value[block[i + 1]]) for i in range (u - start, u - start + 32, 2)))
 	print
-	occupancy = num * 100. / offset
-	print "}; /* Table items: %d; occupancy: %d%% */" % (offset, occupancy)
+	print "}; /* Table items: %d; blocks: %d */" % (len (table_blocks) * block_size, len (table_blocks))
 	print
-
-	page_bits = 12;
+	print "static const %s joining_index[] =" % index_type
+	print "{"
+	for i in range (0, len (index), 16):
+		print "  /* %05X */ %s" % (i * block_size, ''.join ("%3d," % x for x in index[i:i+16]))
+	print "}; /* Table size: %d bytes */" % size
+	print
+	print "#undef _"
 	print
-	print "static unsigned int"
+	print "static inline unsigned int"
 	print "joining_type (hb_codepoint_t u)"
 	print "{"
-	print "  switch (u >> %d)" % page_bits
-	print "  {"
-	pages = set([u>>page_bits for u in [s for s,e in ranges]+[e for s,e in ranges]])
-	for p in sorted(pages):
-		print "    case 0x%0Xu:" % p
-		for (start,end) in ranges:
-			if p not in [start>>page_bits, end>>page_bits]: continue
-			offset = "joining_offset_0x%04xu" % start
-			print "      if (hb_in_range (u, 0x%04Xu, 0x%04Xu)) return joining_table[u - 0x%04Xu + %s];" % (start, end, start, offset)
-		print "      break;"
-		print ""
-	print "    default:"
-	print "      break;"
-	print "  }"
-	print "  return X;"
+	print "  u = MIN (u, 0x%05Xu);" % limit
+	print "  unsigned int i = (joining_index[u >> %d] << %d) + (u & %d);" % (block_bits, block_bits, block_size - 1)
+	print "  return (joining_table[i >> 1] >> ((i & 1) << 2)) & 15;"
 	print "}"
 	print
 	for value,short in short_value.items():
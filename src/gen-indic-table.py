@@ -59,12 +59,6 @@ for u in [0x17CD, 0x17CE, 0x17CF, 0x17D0, 0x17D3]:
 	if data[u][0] == 'Other':
 		data[u][0] = "Vowel_Dependent"
 
-# Move the outliers NO-BREAK SPACE and DOTTED CIRCLE out
-singles = {}
-for u in [0x00A0, 0x25CC]:
-	singles[u] = data[u]
-	del data[u]
-
 print "/* == Start of generated table == */"
 print "/*"
 print " * The following table is generated by running:"
@@ -130,96 +124,81 @@ print "#define _(S,M) INDIC_COMBINE_CATEGORIES (ISC_##S, IMC_##M)"
 print
 print
 
-total = 0
-used = 0
+# Two-level lookup: the table is cut into blocks of equal size, identical
+# blocks are stored once, and an index maps u >> block_bits to the block.
+# Block 0 is all defaults; the index has one extra entry pointing to it,
+# so that lookups can clamp u instead of testing ranges.
+def split (block_bits):
+	block_size = 1 << block_bits
+	limit = (max (data.keys ()) + block_size) // block_size * block_size
+	blocks = [tuple ([defaults] * block_size)]
+	block_index = {blocks[0]: 0}
+	index = []
+	for start in range (0, limit, block_size):
+		block = tuple (tuple (data.get (u, defaults)) for u in range (start, start + block_size))
+		if block not in block_index:
+			block_index[block] = len (blocks)
+			blocks.append (block)
+		index.append (block_index[block])
+	index.append (0)
+	index_size = 1 if len (blocks) <= 256 else 2
+	return limit, index, blocks, len (index) * index_size + len (blocks) * block_size * 2
+
+# Pick the block size giving the smallest tables.
+block_bits = min (range (3, 9), key = lambda bits: split (bits)[3])
+block_size = 1 << block_bits
+limit, index, blocks, size = split (block_bits)
+index_type = "uint8_t" if len (blocks) <= 256 else "uint16_t"
+
+print "static const INDIC_TABLE_ELEMENT_TYPE indic_table[] = {"
+first_use = {}
+for i, b in enumerate (index[:-1]):
+	first_use.setdefault (b, i * block_size)
 last_block = None
-def print_block (block, start, end, data):
-	global total, used, last_block
-	if block and block != last_block:
-		print
+for b, block in enumerate (blocks):
+	start = first_use[b]
+	names = [data[u][2] for u in range (start, start + block_size) if u in data]
+	if names and names[0] != last_block:
 		print
-		print "  /* %s */" % block
-	num = 0
-	assert start % 8 == 0
-	assert (end+1) % 8 == 0
-	for u in range (start, end+1):
-		if u % 8 == 0:
-			print
-			print "  /* %04X */" % u,
-		if u in data:
-			num += 1
-		d = data.get (u, defaults)
-		sys.stdout.write ("%9s" % ("_(%s,%s)," % (short[0][d[0]], short[1][d[1]])))
-
-	total += end - start + 1
-	used += num
-	if block:
-		last_block = block
-
-uu = data.keys ()
-uu.sort ()
-
-last = -100000
-num = 0
-offset = 0
-starts = []
-ends = []
-print "static const INDIC_TABLE_ELEMENT_TYPE indic_table[] = {"
-for u in uu:
-	if u <= last:
-		continue
-	block = data[u][2]
-
-	start = u//8*8
-	end = start+1
-	while end in uu and block == data[end][2]:
-		end += 1
-	end = (end-1)//8*8 + 7
-
-	if start != last + 1:
-		if start - last <= 1+16*3:
-			print_block (None, last+1, start-1, data)
-			last = start-1
-		else:
-			if last >= 0:
-				ends.append (last + 1)
-				offset += ends[-1] - starts[-1]
-			print
-			print
-			print "#define indic_offset_0x%04xu %d" % (start, offset)
-			starts.append (start)
-
-	print_block (block, start, end, data)
-	last = end
-ends.append (last + 1)
-offset += ends[-1] - starts[-1]
+		print "  /* %s */" % names[0]
+		last_block = names[0]
+	print
+	for u in range (start, start + block_size, 8):
+		print "  /* %04X */%s" % (u, ''.join ("%9s" % ("_(%s,%s)," % (short[0][d[0]], short[1][d[1]])) for d in block[u - start:u - start + 8]))
 print
+print "}; /* Table items: %d; blocks: %d */" % (len (blocks) * block_size, len (blocks))
 print
-occupancy = used * 100. / total
-page_bits = 12
-print "}; /* Table items: %d; occupancy: %d%% */" % (offset, occupancy)
+print "static const %s indic_index[] = {" % index_type
+for i in range (0, len (index), 16):
+	print "  /* %05X */ %s" % (i * block_size, ''.join ("%4d," % x for x in index[i:i+16]))
+print "}; /* Table size: %d bytes */" % size
+print
+print "static inline INDIC_TABLE_ELEMENT_TYPE"
+print "indic_lookup (hb_codepoint_t u)"
+print "{"
+print "  u = MIN (u, 0x%05Xu);" % limit
+print "  return indic_table[(indic_index[u >> %d] << %d) + (u & %d)];" % (block_bits, block_bits, block_size - 1)
+print "}"
 print
 print "INDIC_TABLE_ELEMENT_TYPE"
 print "hb_indic_get_categories (hb_codepoint_t u)"
 print "{"
-print "  switch (u >> %d)" % page_bits
+print "  return indic_lookup (u);"
+print "}"
+print
+print "void"
+print "hb_indic_get_categories_batch (unsigned int              count,"
+print "\t\t\t       const hb_codepoint_t     *first_unicode,"
+print "\t\t\t       unsigned int              unicode_stride,"
+print "\t\t\t       INDIC_TABLE_ELEMENT_TYPE *first_category,"
+print "\t\t\t       unsigned int              category_stride)"
+print "{"
+print "  for (unsigned int i = 0; i < count; i++)"
 print "  {"
-pages = set([u>>page_bits for u in starts+ends+singles.keys()])
-for p in sorted(pages):
-	print "    case 0x%0Xu:" % p
-	for (start,end) in zip (starts, ends):
-		if p not in [start>>page_bits, end>>page_bits]: continue
-		offset = "indic_offset_0x%04xu" % start
-		print "      if (hb_in_range (u, 0x%04Xu, 0x%04Xu)) return indic_table[u - 0x%04Xu + %s];" % (start, end-1, start, offset)
-	for u,d in singles.items ():
-		if p != u>>page_bits: continue
-		print "      if (unlikely (u == 0x%04Xu)) return _(%s,%s);" % (u, short[0][d[0]], short[1][d[1]])
-	print "      break;"
-	print ""
-print "    default:"
-print "      break;"
+print "    *first_category = indic_lookup (*first_unicode);"
+print "    first_unicode = (const hb_codepoint_t *) ((const char *) first_unicode + unicode_stride);"
+print "    first_category = (INDIC_TABLE_ELEMENT_TYPE *) ((char *) first_category + category_stride);"
 print "  }"
-print "  return _(x,x);"
 print "}"
 print
 print "#undef _"
@@ -232,7 +211,3 @@ for i in range (2):
 			(what_short[i], short[i][v])
 print
 print "/* == End of generated table == */"
-
-# Maintain at least 30% occupancy in the table */
-if occupancy < 30:
-	raise Exception ("Table too sparse, please investigate: ", occupancy)
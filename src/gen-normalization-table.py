@@ -0,0 +1,133 @@
+#!/usr/bin/python
+
+import sys
+
+if len (sys.argv) != 3:
+	print >>sys.stderr, "usage: ./gen-normalization-table.py DerivedNormalizationProps.txt UnicodeData.txt"
+	sys.exit (1)
+
+files = [file (x) for x in sys.argv[1:]]
+
+headers = [[files[0].readline ()]]
+headers.append (["UnicodeData.txt does not have a header."])
+
+# Quick-check values we care about; anything but Yes is "not quick".
+NFD_QC_NO = 1
+NFC_QC_NO = 2
+values = {}
+
+for line in files[0]:
+
+	j = line.find ('#')
+	if j >= 0:
+		line = line[:j]
+
+	fields = [x.strip () for x in line.split (';')]
+	if len (fields) != 3 or fields[1] not in ['NFD_QC', 'NFC_QC']:
+		continue
+
+	uu = fields[0].split ('..')
+	start = int (uu[0], 16)
+	if len (uu) == 1:
+		end = start
+	else:
+		end = int (uu[1], 16)
+
+	assert fields[2] in ['N', 'M']
+	flag = NFD_QC_NO if fields[1] == 'NFD_QC' else NFC_QC_NO
+	for u in range (start, end + 1):
+		values[u] = values.get (u, 0) | flag
+
+# Unassigned code points may get decompositions in later versions of the
+# Unicode Character Database; never consider them quick.
+assigned = set ()
+first = None
+for line in files[1]:
+
+	fields = [x.strip () for x in line.split (';')]
+	if len (fields) < 3:
+		continue
+
+	u = int (fields[0], 16)
+	if fields[1].endswith (', First>'):
+		first = u
+		continue
+	if fields[1].endswith (', Last>'):
+		assigned.update (range (first, u + 1))
+		continue
+	assigned.add (u)
+
+# Cover everything up to the last assigned character before plane 14; the
+# rest is only tags, variation selectors and private use, which we don't
+# bother with.
+block_bits = 7
+block_size = 1 << block_bits
+limit = max (u for u in assigned if u < 0xE0000) + 1
+limit = (limit + block_size - 1) // block_size * block_size
+
+def value (u):
+	if u not in assigned:
+		return NFD_QC_NO | NFC_QC_NO
+	return values.get (u, 0)
+
+# Two bits per character, in blocks of 128 characters.
+blocks = []
+index = []
+for start in range (0, limit, block_size):
+	data = []
+	for u in range (start, start + block_size, 4):
+		data.append (sum (value (u + i) << (2 * i) for i in range (4)))
+	data = tuple (data)
+	if data not in blocks:
+		blocks.append (data)
+	index.append (blocks.index (data))
+
+assert len (blocks) <= 256
+
+print "/* == Start of generated table == */"
+print "/*"
+print " * The following table is generated by running:"
+print " *"
+print " *   ./gen-normalization-table.py DerivedNormalizationProps.txt UnicodeData.txt"
+print " *"
+print " * on files with these headers:"
+print " *"
+for h in headers:
+	for l in h:
+		print " * %s" % (l.strip())
+print " */"
+print
+print "#ifndef HB_OT_SHAPE_NORMALIZE_TABLE_HH"
+print "#define HB_OT_SHAPE_NORMALIZE_TABLE_HH"
+print
+print
+print "#define NORMALIZATION_QC_NFD_NO	%du /* NFD_QC is No. */" % NFD_QC_NO
+print "#define NORMALIZATION_QC_NFC_NO	%du /* NFC_QC is No or Maybe. */" % NFC_QC_NO
+print
+print "static const uint8_t normalization_qc_index[] ="
+print "{"
+for i in range (0, len (index), 16):
+	print "  /* %05X */ %s" % (i * block_size, ''.join ("%3d," % x for x in index[i:i+16]))
+print "};"
+print
+print "static const uint8_t normalization_qc_data[][%d] =" % (block_size // 4)
+print "{"
+for i, data in enumerate (blocks):
+	print "  { /* %d */" % i
+	for j in range (0, len (data), 16):
+		print "    %s" % ''.join ("0x%02Xu," % x for x in data[j:j+16])
+	print "  },"
+print "}; /* Table items: %d; blocks: %d */" % (len (index) + len (blocks) * block_size // 4, len (blocks))
+print
+print "static inline unsigned int"
+print "normalization_quick_check (hb_codepoint_t u)"
+print "{"
+print "  if (unlikely (u >= 0x%05Xu))" % limit
+print "    return NORMALIZATION_QC_NFD_NO | NORMALIZATION_QC_NFC_NO;"
+print "  return (normalization_qc_data[normalization_qc_index[u >> %d]][(u & %d) >> 2] >> ((u & 3) << 1)) & 3;" % (block_bits, block_size - 1)
+print "}"
+print
+print
+print "#endif /* HB_OT_SHAPE_NORMALIZE_TABLE_HH */"
+print
+print "/* == End of generated table == */"
@@ -0,0 +1,350 @@
+#!/usr/bin/python
+
+# Compiles the scanner in one of the hb-ot-shape-complex-*-machine.rl files
+# into a minimal DFA, as tables for hb-ot-shape-complex-machine-private.hh.
+#
+# Only the subset of Ragel the syllable machines use is understood:
+# numeric literals, 'any', named definitions, concatenation (explicit '.'
+# or juxtaposition), '|', '?', '*', '+', '{n}', '{n,}', '{n,m}' and a
+# longest-match scanner ('main := |* pattern => { found_syllable (type); };
+# ... *|;').  The .rl files remain valid Ragel input, so the tables can be
+# cross-checked against ragel's output.
+
+import sys, re, os.path
+
+if len (sys.argv) != 2:
+	print >>sys.stderr, "usage: ./gen-syllable-machine.py hb-ot-shape-complex-SHAPER-machine.rl"
+	sys.exit (1)
+
+rl = file (sys.argv[1]).read ()
+grammar = '\n'.join (re.findall (r'%%\{(.*?)\}%%', rl, re.S))
+grammar = re.sub (r'#[^\n]*', '', grammar)
+
+machine = re.search (r'\bmachine\s+(\w+)\s*;', grammar).group (1)
+getkey = re.search (r'\bgetkey\s+[^;]*?\.(\w+\(\))\s*;', grammar).group (1)
+grammar = re.sub (r'\b(machine|alphtype|write|getkey)\b[^;]*;', '', grammar)
+
+
+# Tokenizer.  Actions are kept as single tokens.
+
+tokens = []
+pos = 0
+token_re = re.compile (r'\s*(?:(=>\s*\{[^}]*\})|(\|\*|\*\||:=|[=|.?*+(){},;])|(\d+)|(\w+))')
+while grammar[pos:].strip ():
+	m = token_re.match (grammar, pos)
+	if not m:
+		raise Exception ("Cannot parse grammar at: %s" % grammar[pos:pos+40])
+	action, op, number, name = m.groups ()
+	if action:
+		tokens.append (('action', re.search (r'found_syllable\s*\(\s*(\w+)\s*\)', action).group (1)))
+	elif op:
+		tokens.append (('op', op))
+	elif number:
+		tokens.append (('number', int (number)))
+	else:
+		tokens.append (('name', name))
+	pos = m.end ()
+
+
+# Parser.  Expressions are trees of tuples:
+#   ('set', frozenset), ('cat', a, b), ('alt', a, b), ('star', a), ('empty',)
+
+ANY = frozenset (range (256))
+definitions = {}
+patterns = [] # (expression, syllable type)
+
+class Parser:
+	def __init__ (self, tokens):
+		self.tokens = tokens
+		self.i = 0
+	def peek (self):
+		return self.tokens[self.i] if self.i < len (self.tokens) else (None, None)
+	def next (self):
+		t = self.peek ()
+		self.i += 1
+		return t
+	def expect (self, kind, value = None):
+		t = self.next ()
+		if t[0] != kind or (value is not None and t[1] != value):
+			raise Exception ("Expected %s %s, got %s" % (kind, value, t))
+		return t[1]
+	def is_op (self, value):
+		return self.peek () == ('op', value)
+
+	def union (self):
+		e = self.concat ()
+		while self.is_op ('|'):
+			self.next ()
+			e = ('alt', e, self.concat ())
+		return e
+	def concat (self):
+		e = self.postfix ()
+		while True:
+			if self.is_op ('.'):
+				self.next ()
+			elif not (self.peek ()[0] in ['name', 'number'] or self.is_op ('(')):
+				break
+			e = ('cat', e, self.postfix ())
+		return e
+	def postfix (self):
+		e = self.primary ()
+		while True:
+			if self.is_op ('?'):
+				self.next ()
+				e = ('alt', e, ('empty',))
+			elif self.is_op ('*'):
+				self.next ()
+				e = ('star', e)
+			elif self.is_op ('+'):
+				self.next ()
+				e = ('cat', e, ('star', e))
+			elif self.is_op ('{'):
+				self.next ()
+				lo = self.expect ('number')
+				hi = lo
+				if self.is_op (','):
+					self.next ()
+					hi = self.expect ('number') if self.peek ()[0] == 'number' else None
+				self.expect ('op', '}')
+				e = repeat (e, lo, hi)
+			else:
+				return e
+	def primary (self):
+		kind, value = self.next ()
+		if kind == 'number':
+			return ('set', frozenset ([value]))
+		if kind == 'name':
+			if value == 'any':
+				return ('set', ANY)
+			return definitions[value]
+		if (kind, value) == ('op', '('):
+			e = self.union ()
+			self.expect ('op', ')')
+			return e
+		raise Exception ("Unexpected %s %s" % (kind, value))
+
+	def statements (self):
+		while self.peek ()[0]:
+			name = self.expect ('name')
+			if self.is_op (':='):
+				self.next ()
+				self.expect ('op', '|*')
+				while not self.is_op ('*|'):
+					e = self.union ()
+					patterns.append ((e, self.expect ('action')))
+					self.expect ('op', ';')
+				self.next ()
+			else:
+				self.expect ('op', '=')
+				definitions[name] = self.union ()
+			self.expect ('op', ';')
+
+def repeat (e, lo, hi):
+	r = ('empty',)
+	for i in range (lo):
+		r = ('cat', r, e)
+	if hi is None:
+		return ('cat', r, ('star', e))
+	optional = ('empty',)
+	for i in range (hi - lo):
+		optional = ('alt', ('empty',), ('cat', e, optional))
+	return ('cat', r, optional)
+
+Parser (tokens).statements ()
+assert patterns
+
+
+# Thompson construction.  NFA states are indices into these lists.
+
+nfa_epsilon = []
+nfa_edges = [] # list of (set, target)
+nfa_accept = {} # state -> pattern index
+
+def new_state ():
+	nfa_epsilon.append ([])
+	nfa_edges.append ([])
+	return len (nfa_epsilon) - 1
+
+def build (e):
+	s = new_state ()
+	if e[0] == 'set':
+		t = new_state ()
+		nfa_edges[s].append ((e[1], t))
+	elif e[0] == 'empty':
+		t = s
+	elif e[0] == 'cat':
+		s1, t1 = build (e[1])
+		s2, t2 = build (e[2])
+		nfa_epsilon[s].append (s1)
+		nfa_epsilon[t1].append (s2)
+		t = t2
+	elif e[0] == 'alt':
+		t = new_state ()
+		for sub in e[1:]:
+			s1, t1 = build (sub)
+			nfa_epsilon[s].append (s1)
+			nfa_epsilon[t1].append (t)
+	elif e[0] == 'star':
+		t = s
+		s1, t1 = build (e[1])
+		nfa_epsilon[s].append (s1)
+		nfa_epsilon[t1].append (s)
+	return s, t
+
+nfa_start = new_state ()
+for i, (e, syllable_type) in enumerate (patterns):
+	s, t = build (e)
+	nfa_epsilon[nfa_start].append (s)
+	nfa_accept[t] = min (i, nfa_accept.get (t, i))
+
+def closure (states):
+	stack = list (states)
+	result = set (states)
+	while stack:
+		for t in nfa_epsilon[stack.pop ()]:
+			if t not in result:
+				result.add (t)
+				stack.append (t)
+	return frozenset (result)
+
+
+# Input classes: the categories the grammar names, each on its own, and
+# one class for everything else.
+
+categories = sorted (set (c for edges in nfa_edges for (chars, t) in edges if chars != ANY for c in chars))
+num_categories = max (categories) + 1
+inputs = categories + [num_categories]
+
+
+# Subset construction.  DFA state 0 is the error state, 1 the start state.
+
+def accepting (subset):
+	tags = [nfa_accept[s] for s in subset if s in nfa_accept]
+	return min (tags) + 1 if tags else 0
+
+subsets = [frozenset (), closure ([nfa_start])]
+subset_index = {subsets[0]: 0, subsets[1]: 1}
+dfa = []
+i = 0
+while i < len (subsets):
+	row = []
+	for c in inputs:
+		target = closure ([t for s in subsets[i] for (chars, t) in nfa_edges[s] if c in chars])
+		if target not in subset_index:
+			subset_index[target] = len (subsets)
+			subsets.append (target)
+		row.append (subset_index[target])
+	dfa.append (row)
+	i += 1
+accept = [accepting (s) for s in subsets]
+# The scanner never accepts empty matches.
+accept[1] = 0
+
+
+# Minimize (Moore), keeping the error and start states apart.
+
+partition = [0 if s == 0 else 1 if s == 1 else 2 + accept[s] for s in range (len (dfa))]
+while True:
+	signatures = {}
+	new_partition = []
+	for s in range (len (dfa)):
+		signature = (partition[s],) + tuple (partition[t] for t in dfa[s])
+		new_partition.append (signatures.setdefault (signature, len (signatures)))
+	if len (signatures) == len (set (partition)):
+		break
+	partition = new_partition
+
+# Renumber in breadth-first order from the start state.
+order = [partition[0], partition[1]]
+i = 1
+while i < len (order):
+	s = partition.index (order[i])
+	for t in dfa[s]:
+		if partition[t] not in order:
+			order.append (partition[t])
+	i += 1
+state_of = dict ((p, i) for i, p in enumerate (order))
+num_states = len (order)
+transitions = []
+accepts = []
+for p in order:
+	s = partition.index (p)
+	transitions.append ([state_of[partition[t]] for t in dfa[s]])
+	accepts.append (accept[s])
+
+# Merge input classes that behave the same in every state.
+columns = []
+class_of = []
+for i in range (len (inputs)):
+	column = tuple (row[i] for row in transitions)
+	if column not in columns:
+		columns.append (column)
+	class_of.append (columns.index (column))
+num_classes = len (columns)
+classes = [class_of[inputs.index (c)] if c in inputs else class_of[-1] for c in range (num_categories + 1)]
+table = [columns[c][s] for s in range (num_states) for c in range (num_classes)]
+
+assert num_states <= 65536 and num_classes <= 256
+transition_type = "uint8_t" if num_states <= 256 else "uint16_t"
+syllable_types = [t for (e, t) in patterns]
+
+
+print "/* == Start of generated table == */"
+print "/*"
+print " * The following tables are generated by running:"
+print " *"
+print " *   ./gen-syllable-machine.py %s" % os.path.basename (sys.argv[1])
+print " */"
+print
+guard = re.sub (r'\W', '_', os.path.basename (sys.argv[1])[:-3].upper ()) + '_HH'
+print "#ifndef %s" % guard
+print "#define %s" % guard
+print
+print '#include "hb-ot-shape-complex-machine-private.hh"'
+print
+print
+print "static const uint8_t _%s_classes[%d] =" % (machine, len (classes))
+print "{"
+for i in range (0, len (classes), 16):
+	print "  %s" % ''.join ("%3d," % x for x in classes[i:i+16])
+print "};"
+print
+print "static const %s _%s_transitions[%d] =" % (transition_type, machine, len (table))
+print "{"
+width = len (str (num_states - 1)) + 1
+for s in range (num_states):
+	print "  /* %*d */ %s" % (width - 1, s, ''.join ("%*d," % (width, x) for x in table[s * num_classes:(s + 1) * num_classes]))
+print "};"
+print
+print "static const uint8_t _%s_accepting[%d] =" % (machine, num_states)
+print "{"
+for i in range (0, num_states, 16):
+	print "  %s" % ''.join ("%2d," % x for x in accepts[i:i+16])
+print "};"
+print
+print "static const uint8_t _%s_syllable_types[%d] =" % (machine, len (syllable_types))
+print "{"
+for t in syllable_types:
+	print "  %s," % t
+print "};"
+print
+print "static const hb_syllable_machine_t<%s> %s =" % (transition_type, machine)
+print "{"
+print "  %d, /* num_categories */" % num_categories
+print "  %d, /* num_classes */" % num_classes
+print "  _%s_classes," % machine
+print "  _%s_transitions," % machine
+print "  _%s_accepting," % machine
+print "  _%s_syllable_types," % machine
+print "}; /* %d states; table size: %d bytes */" % (num_states, len (classes) + len (table) * (1 if transition_type == "uint8_t" else 2) + num_states + len (syllable_types))
+print
+print "static void"
+print "find_syllables (hb_buffer_t *buffer)"
+print "{"
+print "  hb_find_syllables (%s, buffer," % machine
+print "\t\t     &buffer->info[0].%s, sizeof (buffer->info[0]));" % getkey
+print "}"
+print
+print "#endif /* %s */" % guard
+print
+print "/* == End of generated table == */"
@@ -0,0 +1,165 @@
+#!/usr/bin/python
+
+import sys
+
+if len (sys.argv) != 5:
+	print >>sys.stderr, "usage: ./gen-ucd-table.py UnicodeData.txt Scripts.txt BidiMirroring.txt ArabicShaping.txt"
+	sys.exit (1)
+
+files = [file (x) for x in sys.argv[1:]]
+
+headers = [["UnicodeData.txt does not have a header."]]
+headers.extend ([[f.readline ()] for f in files[1:]])
+
+def read_ranges (f, min_fields):
+	for line in f:
+
+		j = line.find ('#')
+		if j >= 0:
+			line = line[:j]
+
+		fields = [x.strip () for x in line.split (';')]
+		if len (fields) < min_fields:
+			continue
+
+		uu = fields[0].split ('..')
+		start = int (uu[0], 16)
+		if len (uu) == 1:
+			end = start
+		else:
+			end = int (uu[1], 16)
+
+		yield start, end, fields
+
+# In the order of hb_unicode_general_category_t.
+general_categories = ['Cc', 'Cf', 'Cn', 'Co', 'Cs', 'Ll', 'Lm', 'Lo', 'Lt', 'Lu',
+		      'Mc', 'Me', 'Mn', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Pe', 'Pf',
+		      'Pi', 'Po', 'Ps', 'Sc', 'Sk', 'Sm', 'So', 'Zl', 'Zp', 'Zs']
+
+# Values of hb_arabic_joining_type_t.
+joining_types = {'U': 0, 'L': 1, 'R': 2, 'D': 3, 'C': 3,
+		 'ALAPH': 4, 'DALATH RISH': 5, 'T': 7, 'X': 8}
+
+script_names = {'Canadian_Aboriginal': 'CANADIAN_SYLLABICS'}
+
+gc = {}
+ccc = {}
+first = None
+for line in files[0]:
+	fields = [x.strip () for x in line.split (';')]
+	if len (fields) < 4:
+		continue
+	u = int (fields[0], 16)
+	if fields[1].endswith (', First>'):
+		first = u
+		continue
+	if fields[1].endswith (', Last>'):
+		uu = range (first, u + 1)
+	else:
+		uu = [u]
+	for u in uu:
+		gc[u] = general_categories.index (fields[2])
+		ccc[u] = int (fields[3])
+
+scripts = ['Unknown']
+sc = {}
+for start, end, fields in read_ranges (files[1], 2):
+	if fields[1] not in scripts:
+		scripts.append (fields[1])
+	for u in range (start, end + 1):
+		sc[u] = scripts.index (fields[1])
+
+mirroring_deltas = [0]
+bmg = {}
+for start, end, fields in read_ranges (files[2], 2):
+	delta = int (fields[1], 16) - start
+	if delta not in mirroring_deltas:
+		mirroring_deltas.append (delta)
+	bmg[start] = mirroring_deltas.index (delta)
+
+jt = {}
+for start, end, fields in read_ranges (files[3], 4):
+	if fields[3] in ['ALAPH', 'DALATH RISH']:
+		value = fields[3]
+	else:
+		value = fields[2]
+	jt[start] = joining_types[value]
+
+# Must match hb-ucd-private.hh.
+assert len (scripts) <= 256
+assert len (mirroring_deltas) <= 32
+def pack (u):
+	return (gc.get (u, general_categories.index ('Cn')) |
+		ccc.get (u, 0) << 5 |
+		sc.get (u, 0) << 13 |
+		jt.get (u, joining_types['X']) << 21 |
+		bmg.get (u, 0) << 25)
+
+# Record 0 is the one for unassigned characters.
+records = [pack (0x10FFFF)]
+record_index = {records[0]: 0}
+values = []
+for u in range (0x110000):
+	r = pack (u)
+	if r not in record_index:
+		record_index[r] = len (records)
+		records.append (r)
+	values.append (record_index[r])
+
+def split (values, bits):
+	size = 1 << bits
+	blocks = {}
+	index = []
+	data = []
+	for i in range (0, len (values), size):
+		block = tuple (values[i:i+size])
+		if block not in blocks:
+			blocks[block] = len (blocks)
+			data.extend (block)
+		index.append (blocks[block])
+	return index, data
+
+# Three stages: u>>8, then (u>>3)&31, then u&7.
+u2_index, u3 = split (values, 3)
+u1, u2 = split (u2_index, 5)
+assert max (u1) < 256 and max (u2) < 65536 and max (u3) < 65536
+
+def print_array (type, name, data, per_line, fmt):
+	print "const %s %s[%d] =" % (type, name, len (data))
+	print "{"
+	for i in range (0, len (data), per_line):
+		print "  %s" % ''.join (fmt % x for x in data[i:i+per_line])
+	print "};"
+	print
+
+print "/* == Start of generated table == */"
+print "/*"
+print " * The following tables are generated by running:"
+print " *"
+print " *   ./gen-ucd-table.py UnicodeData.txt Scripts.txt BidiMirroring.txt ArabicShaping.txt"
+print " *"
+print " * on files with these headers:"
+print " *"
+for h in headers:
+	for l in h:
+		print " * %s" % (l.strip())
+print " */"
+print
+print '#include "hb-ucd-private.hh"'
+print
+print
+print "const hb_script_t _hb_ucd_sc_map[%d] =" % len (scripts)
+print "{"
+for s in scripts:
+	print "  HB_SCRIPT_%s," % script_names.get (s, s.upper ())
+print "};"
+print
+print_array ("int16_t", "_hb_ucd_bmg_map", mirroring_deltas, 8, "%6d,")
+print_array ("uint32_t", "_hb_ucd_records", records, 6, "0x%08Xu,")
+print_array ("uint8_t", "_hb_ucd_u1", u1, 16, "%4d,")
+print_array ("uint16_t", "_hb_ucd_u2", u2, 12, "%5d,")
+print_array ("uint16_t", "_hb_ucd_u3", u3, 12, "%4d,")
+print "/* Table size: %d bytes */" % (len (scripts) * 4 + len (mirroring_deltas) * 2 + len (records) * 4 +
+				    len (u1) + len (u2) * 2 + len (u3) * 2)
+print
+print "/* == End of generated table == */"
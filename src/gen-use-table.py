@@ -335,12 +335,6 @@ def map_to_use(data):
 defaults = ('O', 'No_Block')
 data = map_to_use(data)
 
-# Remove the outliers
-singles = {}
-for u in [0x034F, 0x25CC, 0x1107F]:
-	singles[u] = data[u]
-	del data[u]
-
 print "/* == Start of generated table == */"
 print "/*"
 print " * The following table is generated by running:"
@@ -357,42 +351,6 @@ print
 print '#include "hb-ot-shape-complex-use-private.hh"'
 print
 
-total = 0
-used = 0
-last_block = None
-def print_block (block, start, end, data):
-	global total, used, last_block
-	if block and block != last_block:
-		print
-		print
-		print "  /* %s */" % block
-		if start % 16:
-			print ' ' * (20 + (start % 16 * 6)),
-	num = 0
-	assert start % 8 == 0
-	assert (end+1) % 8 == 0
-	for u in range (start, end+1):
-		if u % 16 == 0:
-			print
-			print "  /* %04X */" % u,
-		if u in data:
-			num += 1
-		d = data.get (u, defaults)
-		sys.stdout.write ("%6s," % d[0])
-
-	total += end - start + 1
-	used += num
-	if block:
-		last_block = block
-
-uu = data.keys ()
-uu.sort ()
-
-last = -100000
-num = 0
-offset = 0
-starts = []
-ends = []
 for k,v in sorted(use_mapping.items()):
 	if k in use_positions and use_positions[k]: continue
 	print "#define %s	USE_%s	/* %s */" % (k, k, v.__name__[3:])
@@ -401,63 +359,83 @@ for k,v in sorted(use_positions.items()):
 	for suf in v.keys():
 		tag = k + suf
 		print "#define %s	USE_%s" % (tag, tag)
-print ""
+print
+
+# Two-level lookup: the table is cut into blocks of equal size, identical
+# blocks are stored once, and an index maps u >> block_bits to the block.
+# Block 0 is all defaults; the index has one extra entry pointing to it,
+# so that lookups can clamp u instead of testing ranges.
+def split (block_bits):
+	block_size = 1 << block_bits
+	limit = (max (data.keys ()) + block_size) // block_size * block_size
+	blocks = [tuple ([defaults[0]] * block_size)]
+	block_index = {blocks[0]: 0}
+	index = []
+	for start in range (0, limit, block_size):
+		block = tuple (data.get (u, defaults)[0] for u in range (start, start + block_size))
+		if block not in block_index:
+			block_index[block] = len (blocks)
+			blocks.append (block)
+		index.append (block_index[block])
+	index.append (0)
+	index_size = 1 if len (blocks) <= 256 else 2
+	return limit, index, blocks, len (index) * index_size + len (blocks) * block_size
+
+# Pick the block size giving the smallest tables.
+block_bits = min (range (3, 9), key = lambda bits: split (bits)[3])
+block_size = 1 << block_bits
+limit, index, blocks, size = split (block_bits)
+index_type = "uint8_t" if len (blocks) <= 256 else "uint16_t"
+
 print "static const USE_TABLE_ELEMENT_TYPE use_table[] = {"
-for u in uu:
-	if u <= last:
-		continue
-	block = data[u][1]
-
-	start = u//8*8
-	end = start+1
-	while end in uu and block == data[end][1]:
-		end += 1
-	end = (end-1)//8*8 + 7
-
-	if start != last + 1:
-		if start - last <= 1+16*3:
-			print_block (None, last+1, start-1, data)
-			last = start-1
-		else:
-			if last >= 0:
-				ends.append (last + 1)
-				offset += ends[-1] - starts[-1]
-			print
-			print
-			print "#define use_offset_0x%04xu %d" % (start, offset)
-			starts.append (start)
-
-	print_block (block, start, end, data)
-	last = end
-ends.append (last + 1)
-offset += ends[-1] - starts[-1]
+first_use = {}
+for i, b in enumerate (index[:-1]):
+	first_use.setdefault (b, i * block_size)
+last_block = None
+for b, block in enumerate (blocks):
+	start = first_use[b]
+	names = [data[u][1] for u in range (start, start + block_size) if u in data]
+	if names and names[0] != last_block:
+		print
+		print "  /* %s */" % names[0]
+		last_block = names[0]
+	print
+	for u in range (start, start + block_size, 16):
+		print "  /* %04X */%s" % (u, ''.join ("%6s," % d for d in block[u - start:u - start + 16]))
+print
+print "}; /* Table items: %d; blocks: %d */" % (len (blocks) * block_size, len (blocks))
 print
+print "static const %s use_index[] = {" % index_type
+for i in range (0, len (index), 16):
+	print "  /* %05X */ %s" % (i * block_size, ''.join ("%4d," % x for x in index[i:i+16]))
+print "}; /* Table size: %d bytes */" % size
 print
-occupancy = used * 100. / total
-page_bits = 12
-print "}; /* Table items: %d; occupancy: %d%% */" % (offset, occupancy)
+print "static inline USE_TABLE_ELEMENT_TYPE"
+print "use_lookup (hb_codepoint_t u)"
+print "{"
+print "  u = MIN (u, 0x%05Xu);" % limit
+print "  return use_table[(use_index[u >> %d] << %d) + (u & %d)];" % (block_bits, block_bits, block_size - 1)
+print "}"
 print
 print "USE_TABLE_ELEMENT_TYPE"
 print "hb_use_get_categories (hb_codepoint_t u)"
 print "{"
-print "  switch (u >> %d)" % page_bits
+print "  return use_lookup (u);"
+print "}"
+print
+print "void"
+print "hb_use_get_categories_batch (unsigned int            count,"
+print "\t\t\t     const hb_codepoint_t   *first_unicode,"
+print "\t\t\t     unsigned int            unicode_stride,"
+print "\t\t\t     USE_TABLE_ELEMENT_TYPE *first_category,"
+print "\t\t\t     unsigned int            category_stride)"
+print "{"
+print "  for (unsigned int i = 0; i < count; i++)"
 print "  {"
-pages = set([u>>page_bits for u in starts+ends+singles.keys()])
-for p in sorted(pages):
-	print "    case 0x%0Xu:" % p
-	for (start,end) in zip (starts, ends):
-		if p not in [start>>page_bits, end>>page_bits]: continue
-		offset = "use_offset_0x%04xu" % start
-		print "      if (hb_in_range (u, 0x%04Xu, 0x%04Xu)) return use_table[u - 0x%04Xu + %s];" % (start, end-1, start, offset)
-	for u,d in singles.items ():
-		if p != u>>page_bits: continue
-		print "      if (unlikely (u == 0x%04Xu)) return %s;" % (u, d[0])
-	print "      break;"
-	print ""
-print "    default:"
-print "      break;"
+print "    *first_category = use_lookup (*first_unicode);"
+print "    first_unicode = (const hb_codepoint_t *) ((const char *) first_unicode + unicode_stride);"
+print "    first_category = (USE_TABLE_ELEMENT_TYPE *) ((char *) first_category + category_stride);"
 print "  }"
-print "  return USE_O;"
 print "}"
 print
 for k in sorted(use_mapping.keys()):
@@ -470,7 +448,3 @@ for k,v in sorted(use_positions.items()):
 		print "#undef %s" % tag
 print
 print "/* == End of generated table == */"
-
-# Maintain at least 50% occupancy in the table */
-if occupancy < 50:
-	raise Exception ("Table too sparse, please investigate: ", occupancy)
@@ -179,6 +179,7 @@ struct hb_atomic_int_t
   inline int get_unsafe (void) const { return v; }
   inline int inc (void) { return hb_atomic_int_impl_add (const_cast<hb_atomic_int_impl_t &> (v),  1); }
   inline int dec (void) { return hb_atomic_int_impl_add (const_cast<hb_atomic_int_impl_t &> (v), -1); }
+  inline int add (int v_) { return hb_atomic_int_impl_add (const_cast<hb_atomic_int_impl_t &> (v), v_); }
 };
 
 
@@ -51,12 +51,17 @@ ASSERT_STATIC (sizeof (hb_glyph_info_t) == sizeof (hb_glyph_position_t));
 HB_MARK_AS_FLAG_T (hb_buffer_flags_t);
 HB_MARK_AS_FLAG_T (hb_buffer_serialize_flags_t);
 
+/* Glyph flags, hb_glyph_flags_t, live in the lowest bits of
+ * hb_glyph_info_t.mask; the shaper allocates feature masks above them.
+ * See hb_ot_map_builder_t::compile(). */
+
 enum hb_buffer_scratch_flags_t {
   HB_BUFFER_SCRATCH_FLAG_DEFAULT			= 0x00000000u,
   HB_BUFFER_SCRATCH_FLAG_HAS_NON_ASCII			= 0x00000001u,
   HB_BUFFER_SCRATCH_FLAG_HAS_DEFAULT_IGNORABLES		= 0x00000002u,
   HB_BUFFER_SCRATCH_FLAG_HAS_SPACE_FALLBACK		= 0x00000004u,
   HB_BUFFER_SCRATCH_FLAG_HAS_GPOS_ATTACHMENT		= 0x00000008u,
+  HB_BUFFER_SCRATCH_FLAG_HAS_UNSAFE_TO_BREAK		= 0x00000010u,
   /* Reserved for complex shapers' internal use. */
   HB_BUFFER_SCRATCH_FLAG_COMPLEX0			= 0x01000000u,
   HB_BUFFER_SCRATCH_FLAG_COMPLEX1			= 0x02000000u,
@@ -251,6 +256,28 @@ struct hb_buffer_t {
   /* Merge clusters for deleting current glyph, and skip it. */
   HB_INTERNAL void delete_glyph (void);
 
+  /* Flag glyphs in [start, end) as unsafe to break at, except for those in
+   * the first cluster of the range. */
+  inline void unsafe_to_break (unsigned int start,
+			       unsigned int end)
+  {
+    if (end - start < 2)
+      return;
+    unsafe_to_break_impl (start, end);
+  }
+  HB_INTERNAL void unsafe_to_break_impl (unsigned int start,
+					 unsigned int end);
+  /* Same, for a range starting at out_info[start] and ending at info[end];
+   * during GSUB that is how backtrack-to-lookahead contexts are laid out. */
+  HB_INTERNAL void unsafe_to_break_from_outbuffer (unsigned int start,
+						   unsigned int end);
+  /* For shapers that don't track contexts. */
+  inline void unsafe_to_break_all (void)
+  {
+    for (unsigned int i = 0; i < len; i++)
+      info[i].mask |= HB_GLYPH_FLAG_UNSAFE_TO_BREAK;
+  }
+
   /* Internal methods */
   HB_INTERNAL bool enlarge (unsigned int size);
 
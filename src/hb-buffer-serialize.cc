@@ -161,6 +161,12 @@ _hb_buffer_serialize_glyphs_json (hb_buffer_t *buffer,
         extents.width, extents.height));
     }
 
+    if (flags & HB_BUFFER_SERIALIZE_FLAG_GLYPH_FLAGS)
+    {
+      if (hb_glyph_info_get_glyph_flags (&info[i]))
+	p += MAX (0, snprintf (p, ARRAY_LENGTH (b) - (p - b), ",\"fl\":%u", hb_glyph_info_get_glyph_flags (&info[i])));
+    }
+
     *p++ = '}';
 
     unsigned int l = p - b;
@@ -233,6 +239,12 @@ _hb_buffer_serialize_glyphs_text (hb_buffer_t *buffer,
       p += MAX (0, snprintf (p, ARRAY_LENGTH (b) - (p - b), "<%d,%d,%d,%d>", extents.x_bearing, extents.y_bearing, extents.width, extents.height));
     }
 
+    if (flags & HB_BUFFER_SERIALIZE_FLAG_GLYPH_FLAGS)
+    {
+      if (hb_glyph_info_get_glyph_flags (&info[i]))
+	p += MAX (0, snprintf (p, ARRAY_LENGTH (b) - (p - b), "#%X", hb_glyph_info_get_glyph_flags (&info[i])));
+    }
+
     unsigned int l = p - b;
     if (buf_size > l)
     {
@@ -285,6 +297,8 @@ _hb_buffer_serialize_glyphs_text (hb_buffer_t *buffer,
  *   - If #HB_BUFFER_SERIALIZE_FLAG_GLYPH_EXTENTS is set, the
  *     #hb_glyph_extents_t in the format
  *     `&lt;x_bearing,y_bearing,width,height&gt;`
+ *   - If #HB_BUFFER_SERIALIZE_FLAG_GLYPH_FLAGS is set and the glyph has any
+ *     #hb_glyph_flags_t, `#` then the flags in hexadecimal.
  *
  * ## json
  * TODO.
@@ -261,7 +261,7 @@ hb_buffer_t::add (hb_codepoint_t  codepoint,
 
   memset (glyph, 0, sizeof (*glyph));
   glyph->codepoint = codepoint;
-  glyph->mask = 1;
+  glyph->mask = 0;
   glyph->cluster = cluster;
 
   len++;
@@ -596,13 +596,82 @@ hb_buffer_t::merge_out_clusters (unsigned int start,
   for (unsigned int i = start; i < end; i++)
     out_info[i].cluster = cluster;
 }
+
+static inline unsigned int
+_unsafe_to_break_find_min_cluster (const hb_glyph_info_t *infos,
+				   unsigned int start, unsigned int end,
+				   unsigned int cluster)
+{
+  for (unsigned int i = start; i < end; i++)
+    cluster = MIN (cluster, infos[i].cluster);
+  return cluster;
+}
+static inline bool
+_unsafe_to_break_set_mask (hb_glyph_info_t *infos,
+			   unsigned int start, unsigned int end,
+			   unsigned int cluster)
+{
+  bool set = false;
+  for (unsigned int i = start; i < end; i++)
+    if (cluster != infos[i].cluster)
+    {
+      infos[i].mask |= HB_GLYPH_FLAG_UNSAFE_TO_BREAK;
+      set = true;
+    }
+  return set;
+}
+
+void
+hb_buffer_t::unsafe_to_break_impl (unsigned int start, unsigned int end)
+{
+  /* Whole clusters; glyphs of them outside the range may still be split off
+   * into clusters of their own, eg. by reordering. */
+  while (end < len && info[end - 1].cluster == info[end].cluster)
+    end++;
+  while (start > (have_output ? idx : 0) && info[start - 1].cluster == info[start].cluster)
+    start--;
+
+  unsigned int cluster = _unsafe_to_break_find_min_cluster (info, start, end, (unsigned int) -1);
+  if (_unsafe_to_break_set_mask (info, start, end, cluster))
+    scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_UNSAFE_TO_BREAK;
+}
+void
+hb_buffer_t::unsafe_to_break_from_outbuffer (unsigned int start, unsigned int end)
+{
+  if (!have_output)
+  {
+    unsafe_to_break (start, end);
+    return;
+  }
+
+  assert (start <= out_len);
+  assert (idx <= end);
+
+  /* Whole clusters, as above. */
+  while (idx < end && end < len && info[end - 1].cluster == info[end].cluster)
+    end++;
+  while (start && out_info[start - 1].cluster == out_info[start].cluster)
+    start--;
+
+  unsigned int cluster = (unsigned int) -1;
+  cluster = _unsafe_to_break_find_min_cluster (out_info, start, out_len, cluster);
+  cluster = _unsafe_to_break_find_min_cluster (info, idx, end, cluster);
+  bool set = _unsafe_to_break_set_mask (out_info, start, out_len, cluster);
+  set = _unsafe_to_break_set_mask (info, idx, end, cluster) || set;
+  if (set)
+    scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_UNSAFE_TO_BREAK;
+}
+
 void
 hb_buffer_t::delete_glyph ()
 {
   unsigned int cluster = info[idx].cluster;
+  /* Glyphs taking over the cluster keep its flags. */
+  unsigned int flags = info[idx].mask & HB_GLYPH_FLAG_DEFINED;
   if (idx + 1 < len && cluster == info[idx + 1].cluster)
   {
     /* Cluster survives; do nothing. */
+    info[idx + 1].mask |= flags;
     goto done;
   }
 
@@ -613,7 +682,10 @@ hb_buffer_t::delete_glyph ()
     {
       unsigned int old_cluster = out_info[out_len - 1].cluster;
       for (unsigned i = out_len; i && out_info[i - 1].cluster == old_cluster; i--)
+      {
 	out_info[i - 1].cluster = cluster;
+	out_info[i - 1].mask |= flags;
+      }
     }
     goto done;
   }
@@ -622,6 +694,7 @@ hb_buffer_t::delete_glyph ()
   {
     /* Merge cluster forward. */
     merge_clusters (idx, idx + 2);
+    info[idx + 1].mask |= flags;
     goto done;
   }
 
@@ -1371,6 +1444,23 @@ hb_buffer_get_glyph_positions (hb_buffer_t  *buffer,
   return (hb_glyph_position_t *) buffer->pos;
 }
 
+/**
+ * hb_glyph_info_get_glyph_flags:
+ * @info: a #hb_glyph_info_t of a shaped buffer.
+ *
+ * Returns the #hb_glyph_flags_t the shaper recorded for the glyph.
+ *
+ * Return value: 
+ * The #hb_glyph_flags_t of @info.
+ *
+ * Since: 1.2.4
+ **/
+hb_glyph_flags_t
+(hb_glyph_info_get_glyph_flags) (const hb_glyph_info_t *info)
+{
+  return hb_glyph_info_get_glyph_flags (info);
+}
+
 /**
  * hb_buffer_reverse:
  * @buffer: an #hb_buffer_t.
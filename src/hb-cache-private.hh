@@ -68,7 +68,62 @@ struct hb_cache_t
 };
 
 typedef hb_cache_t<21, 16, 8> hb_cmap_cache_t;
-typedef hb_cache_t<16, 24, 8> hb_advance_cache_t;
+typedef hb_cache_t<16, 23, 8> hb_advance_cache_t;
+
+
+/* Implements a lock-free cache for glyph extents.  Like hb_cache_t, but
+ * each of the four values carries the key tag, so a reader racing with a
+ * writer sees a mix of two glyphs' values only as a miss. */
+
+struct hb_extents_cache_t
+{
+  enum { key_bits = 16, value_bits = 23, cache_bits = 8 };
+
+  inline void clear (void)
+  {
+    memset (values, 255, sizeof (values));
+  }
+
+  inline bool get (unsigned int key, hb_glyph_extents_t *extents)
+  {
+    const unsigned int *v = values[key & ((1<<cache_bits)-1)];
+    unsigned int tag = key >> cache_bits;
+    unsigned int v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3];
+    if ((v0 >> value_bits) != tag || (v1 >> value_bits) != tag ||
+	(v2 >> value_bits) != tag || (v3 >> value_bits) != tag)
+      return false;
+    extents->x_bearing = unpack (v0);
+    extents->y_bearing = unpack (v1);
+    extents->width = unpack (v2);
+    extents->height = unpack (v3);
+    return true;
+  }
+
+  inline bool set (unsigned int key, const hb_glyph_extents_t *extents)
+  {
+    if (unlikely ((key >> key_bits) ||
+		  !fits (extents->x_bearing) || !fits (extents->y_bearing) ||
+		  !fits (extents->width) || !fits (extents->height)))
+      return false; /* Overflows */
+    unsigned int *v = values[key & ((1<<cache_bits)-1)];
+    unsigned int tag = (key >> cache_bits) << value_bits;
+    v[0] = tag | pack (extents->x_bearing);
+    v[1] = tag | pack (extents->y_bearing);
+    v[2] = tag | pack (extents->width);
+    v[3] = tag | pack (extents->height);
+    return true;
+  }
+
+  private:
+  static inline bool fits (hb_position_t x)
+  { return -(1<<(value_bits-1)) <= x && x < (1<<(value_bits-1)); }
+  static inline unsigned int pack (hb_position_t x)
+  { return (unsigned int) x & ((1<<value_bits)-1); }
+  static inline hb_position_t unpack (unsigned int v)
+  { return (hb_position_t) ((v & ((1<<value_bits)-1)) ^ (1<<(value_bits-1))) - (1<<(value_bits-1)); }
+
+  unsigned int values[1<<cache_bits][4];
+};
 
 
 #endif /* HB_CACHE_PRIVATE_HH */
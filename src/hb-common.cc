@@ -47,6 +47,7 @@ _hb_options_init (void)
 
   char *c = getenv ("HB_OPTIONS");
   u.opts.uniscribe_bug_compatible = c && strstr (c, "uniscribe-bug-compatible");
+  u.opts.normalize_in_rounds = c && strstr (c, "normalize-in-rounds");
 
   /* This is idempotent and threadsafe. */
   _hb_options = u;
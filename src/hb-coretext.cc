@@ -1162,6 +1162,9 @@ resize_and_retry:
 	}
       }
     }
+
+    /* CoreText doesn't tell us where contexts matched. */
+    buffer->unsafe_to_break_all ();
   }
 
 #undef FAIL
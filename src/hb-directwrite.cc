@@ -819,6 +819,9 @@ _hb_directwrite_shape(hb_shape_plan_t    *shape_plan,
     pos->y_offset = info->var2.u32;
   }
 
+  /* DirectWrite doesn't tell us where contexts matched. */
+  buffer->unsafe_to_break_all ();
+
   if (backward)
     hb_buffer_reverse (buffer);
 
@@ -105,6 +105,13 @@ struct hb_font_t {
   int x_scale;
   int y_scale;
 
+  /* Set from the scales and upem by update_scale_factors (), so that
+   * em_scale () can multiply or shift instead of divide. */
+  unsigned int upem;
+  int upem_shift;	/* log2 (upem), or -1 if upem is not a power of two. */
+  int x_mult;		/* x_scale / upem if it divides evenly, or 0. */
+  int y_mult;
+
   unsigned int x_ppem;
   unsigned int y_ppem;
 
@@ -112,12 +119,22 @@ struct hb_font_t {
   void              *user_data;
   hb_destroy_func_t  destroy;
 
+  struct hb_extents_cache_t *extents_cache; /* Created on first use. */
+
   struct hb_shaper_data_t shaper_data;
 
 
   /* Convert from font-space to user-space */
-  inline hb_position_t em_scale_x (int16_t v) { return em_scale (v, this->x_scale); }
-  inline hb_position_t em_scale_y (int16_t v) { return em_scale (v, this->y_scale); }
+  inline hb_position_t em_scale_x (int32_t v) { return em_scale (v, this->x_scale, this->x_mult); }
+  inline hb_position_t em_scale_y (int32_t v) { return em_scale (v, this->y_scale, this->y_mult); }
+
+  inline void update_scale_factors (void)
+  {
+    this->upem = face->get_upem ();
+    this->upem_shift = (this->upem & (this->upem - 1)) ? -1 : (int) _hb_bit_storage (this->upem) - 1;
+    this->x_mult = this->x_scale % (int) this->upem ? 0 : this->x_scale / (int) this->upem;
+    this->y_mult = this->y_scale % (int) this->upem ? 0 : this->y_scale / (int) this->upem;
+  }
 
   /* Convert from parent-font user-space to our user-space */
   inline hb_position_t parent_scale_x_distance (hb_position_t v) {
@@ -258,6 +275,14 @@ struct hb_font_t {
 				       klass->user_data.glyph_extents);
   }
 
+  /* Same as get_glyph_extents(), through a per-font cache; for callers that
+   * ask for the same glyphs over and over, like fallback mark positioning.
+   * The cache is dropped when the font's funcs, scale or ppem change.
+   * Sub-fonts don't use it, as their results depend on the parent's. */
+  HB_INTERNAL hb_bool_t get_glyph_extents_cached (hb_codepoint_t glyph,
+						  hb_glyph_extents_t *extents);
+  HB_INTERNAL void clear_glyph_extents_cache (void);
+
   inline hb_bool_t get_glyph_contour_point (hb_codepoint_t glyph, unsigned int point_index,
 					    hb_position_t *x, hb_position_t *y)
   {
@@ -505,7 +530,19 @@ struct hb_font_t {
   }
 
   private:
-  inline hb_position_t em_scale (int16_t v, int scale) { return (hb_position_t) (v * (int64_t) scale / face->get_upem ()); }
+  inline hb_position_t em_scale (int32_t v, int scale, int mult)
+  {
+    if (likely (mult))
+      return (hb_position_t) (v * (int64_t) mult);
+    int64_t scaled = v * (int64_t) scale;
+    if (this->upem_shift >= 0)
+    {
+      /* Round towards zero, as the division does. */
+      int64_t bias = scaled < 0 ? (1 << this->upem_shift) - 1 : 0;
+      return (hb_position_t) ((scaled + bias) >> this->upem_shift);
+    }
+    return (hb_position_t) (scaled / this->upem);
+  }
 };
 
 #define HB_SHAPER_DATA_CREATE_FUNC_EXTRA_ARGS
@@ -587,6 +587,50 @@ hb_font_t::has_func (unsigned int i)
   return this->klass->get.array[i] != _hb_font_funcs_parent.get.array[i];
 }
 
+hb_bool_t
+hb_font_t::get_glyph_extents_cached (hb_codepoint_t glyph,
+				     hb_glyph_extents_t *extents)
+{
+  /* A sub-font can't tell when its parent's scale, ppem or funcs change,
+   * so its results are not cached. */
+  if (unlikely (hb_object_is_inert (this) ||
+		(parent && parent != hb_font_get_empty ())))
+    return get_glyph_extents (glyph, extents);
+
+retry:
+  /* No barrier for the common case: the compare-and-exchange below orders
+   * clearing the cache before publishing it, and readers only go through
+   * the pointer they load.  A barrier per glyph is measurably slower. */
+  hb_extents_cache_t *cache = extents_cache;
+  if (unlikely (!cache))
+  {
+    cache = (hb_extents_cache_t *) malloc (sizeof (hb_extents_cache_t));
+    if (unlikely (!cache))
+      return get_glyph_extents (glyph, extents);
+    cache->clear ();
+    if (!hb_atomic_ptr_cmpexch (&extents_cache, NULL, cache))
+    {
+      free (cache);
+      goto retry;
+    }
+  }
+
+  if (cache->get (glyph, extents))
+    return true;
+  if (!get_glyph_extents (glyph, extents))
+    return false;
+  cache->set (glyph, extents);
+  return true;
+}
+
+void
+hb_font_t::clear_glyph_extents_cache (void)
+{
+  /* Setters are not thread-safe anyway. */
+  if (extents_cache)
+    extents_cache->clear ();
+}
+
 /* Public getters */
 
 /**
@@ -1134,6 +1178,7 @@ hb_font_create (hb_face_t *face)
   font->klass = hb_font_funcs_get_empty ();
 
   font->x_scale = font->y_scale = hb_face_get_upem (face);
+  font->update_scale_factors ();
 
   return font;
 }
@@ -1163,6 +1208,7 @@ hb_font_create_sub_font (hb_font_t *parent)
 
   font->x_scale = parent->x_scale;
   font->y_scale = parent->y_scale;
+  font->update_scale_factors ();
   font->x_ppem = parent->x_ppem;
   font->y_ppem = parent->y_ppem;
 
@@ -1192,6 +1238,11 @@ hb_font_get_empty (void)
     1000, /* x_scale */
     1000, /* y_scale */
 
+    1000, /* upem */
+    -1, /* upem_shift */
+    1, /* x_mult */
+    1, /* y_mult */
+
     0, /* x_ppem */
     0, /* y_ppem */
 
@@ -1199,6 +1250,8 @@ hb_font_get_empty (void)
     NULL, /* user_data */
     NULL, /* destroy */
 
+    NULL, /* extents_cache */
+
     {
 #define HB_SHAPER_IMPLEMENT(shaper) HB_SHAPER_DATA_INVALID,
 #include "hb-shaper-list.hh"
@@ -1249,6 +1302,8 @@ hb_font_destroy (hb_font_t *font)
   hb_face_destroy (font->face);
   hb_font_funcs_destroy (font->klass);
 
+  free (font->extents_cache);
+
   free (font);
 }
 
@@ -1352,6 +1407,7 @@ hb_font_set_parent (hb_font_t *font,
   hb_font_t *old = font->parent;
 
   font->parent = hb_font_reference (parent);
+  font->clear_glyph_extents_cache ();
 
   hb_font_destroy (old);
 }
@@ -1423,6 +1479,7 @@ hb_font_set_funcs (hb_font_t         *font,
   font->klass = klass;
   font->user_data = font_data;
   font->destroy = destroy;
+  font->clear_glyph_extents_cache ();
 }
 
 /**
@@ -1452,6 +1509,7 @@ hb_font_set_funcs_data (hb_font_t         *font,
 
   font->user_data = font_data;
   font->destroy = destroy;
+  font->clear_glyph_extents_cache ();
 }
 
 
@@ -1475,6 +1533,8 @@ hb_font_set_scale (hb_font_t *font,
 
   font->x_scale = x_scale;
   font->y_scale = y_scale;
+  font->update_scale_factors ();
+  font->clear_glyph_extents_cache ();
 }
 
 /**
@@ -1516,6 +1576,7 @@ hb_font_set_ppem (hb_font_t *font,
 
   font->x_ppem = x_ppem;
   font->y_ppem = y_ppem;
+  font->clear_glyph_extents_cache ();
 }
 
 /**
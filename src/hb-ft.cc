@@ -32,6 +32,8 @@
 #include "hb-ft.h"
 
 #include "hb-font-private.hh"
+#include "hb-cache-private.hh"
+#include "hb-mutex-private.hh"
 
 #include FT_ADVANCES_H
 #include FT_TRUETYPE_TABLES_H
@@ -52,29 +54,72 @@
  *     Have not investigated.
  *
  *   - FreeType works in 26.6 mode.  Clients can decide to use that mode, and everything
- *     would work fine.  However, we also abuse this API for performing in font-space,
- *     but don't pass the correct flags to FreeType.  We just abuse the no-hinting mode
- *     for that, such that no rounding etc happens.  As such, we don't set ppem, and
- *     pass NO_HINTING as load_flags.  Would be much better to use NO_SCALE, and scale
- *     ourselves, like we do in uniscribe, etc.
+ *     would work fine.  However, fonts created with hb_ft_font_create() still abuse
+ *     this API for performing in font-space: we don't set ppem, and pass NO_HINTING
+ *     as load_flags, such that no rounding etc happens.  Clients can pass NO_SCALE
+ *     to hb_ft_font_set_load_flags() instead, in which case we work in font units
+ *     and scale ourselves, like we do in uniscribe, etc.  hb_ft_font_set_funcs()
+ *     does that.
  *
  *   - We don't handle / allow for emboldening / obliqueing.
  *
  *   - In the future, we should add constructors to create fonts in font space?
  *
- *   - FT_Load_Glyph() is exteremely costly.  Do something about it?
+ *   - FT_Load_Glyph() is exteremely costly.  In NO_SCALE mode we cache advances,
+ *     fetched a run at a time with FT_Get_Advances(), and extents, which don't
+ *     depend on the font scale then.  Contour points and vertical origins still
+ *     load the glyph.
  */
 
 
+/* User data of faces that hb_ft_face_create() makes for non-memory
+ * streams, whose tables are loaded through the FT_Face. */
+struct hb_ft_face_data_t
+{
+  FT_Face ft_face;
+  hb_destroy_func_t destroy;
+  /* Taken around FT_Load_Sfnt_Table(); shared by the fonts that
+   * hb_ft_font_create() makes on this face, as they use the same FT_Face. */
+  hb_mutex_t lock;
+};
+
+static hb_blob_t *
+reference_table (hb_face_t *face, hb_tag_t tag, void *user_data);
+
+
 struct hb_ft_font_t
 {
   FT_Face ft_face;
   int load_flags;
   bool unref; /* Whether to destroy ft_face when done. */
+
+  /* FT_Face is not thread-safe; all our uses of ft_face go through lock,
+   * so an hb-ft font can be shared between threads.  The caches below are
+   * lock-free, and answer most queries without taking it.  lock points to
+   * own_lock, or to the lock of the face if that reads tables through the
+   * same FT_Face. */
+  hb_mutex_t *lock;
+  hb_mutex_t own_lock;
+
+  hb_cmap_cache_t cmap;
+
+  /* In font units; only used with FT_LOAD_NO_SCALE. */
+  hb_advance_cache_t h_advances;
+  hb_advance_cache_t v_advances;
+  hb_extents_cache_t extents;
+
+  inline bool unscaled (void) const { return load_flags & FT_LOAD_NO_SCALE; }
+
+  inline void clear_caches (void)
+  {
+    h_advances.clear ();
+    v_advances.clear ();
+    extents.clear ();
+  }
 };
 
 static hb_ft_font_t *
-_hb_ft_font_create (FT_Face ft_face, bool unref)
+_hb_ft_font_create (FT_Face ft_face, bool unref, hb_mutex_t *shared_lock)
 {
   hb_ft_font_t *ft_font = (hb_ft_font_t *) calloc (1, sizeof (hb_ft_font_t));
 
@@ -83,8 +128,12 @@ _hb_ft_font_create (FT_Face ft_face, bool unref)
 
   ft_font->ft_face = ft_face;
   ft_font->unref = unref;
+  ft_font->own_lock.init ();
+  ft_font->lock = shared_lock ? shared_lock : &ft_font->own_lock;
 
   ft_font->load_flags = FT_LOAD_DEFAULT | FT_LOAD_NO_HINTING;
+  ft_font->cmap.clear ();
+  ft_font->clear_caches ();
 
   return ft_font;
 }
@@ -95,6 +144,8 @@ _hb_ft_font_destroy (hb_ft_font_t *ft_font)
   if (ft_font->unref)
     FT_Done_Face (ft_font->ft_face);
 
+  ft_font->own_lock.finish ();
+
   free (ft_font);
 }
 
@@ -103,7 +154,12 @@ _hb_ft_font_destroy (hb_ft_font_t *ft_font)
  * @font:
  * @load_flags:
  *
- * 
+ * Sets the flags hb-ft passes to FreeType when loading glyphs.
+ *
+ * If @load_flags includes %FT_LOAD_NO_SCALE, all metrics are fetched in
+ * font units and scaled by HarfBuzz according to the font scale, like
+ * hb_ot_font_set_funcs() does, and advances and glyph extents are cached.
+ * The size set on the FT_Face doesn't matter then.
  *
  * Since: 1.0.5
  **/
@@ -119,6 +175,8 @@ hb_ft_font_set_load_flags (hb_font_t *font, int load_flags)
   hb_ft_font_t *ft_font = (hb_ft_font_t *) font->user_data;
 
   ft_font->load_flags = load_flags;
+  ft_font->clear_caches ();
+  font->clear_glyph_extents_cache ();
 }
 
 /**
@@ -161,8 +219,16 @@ hb_ft_get_nominal_glyph (hb_font_t *font HB_UNUSED,
 			 hb_codepoint_t *glyph,
 			 void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
-  unsigned int g = FT_Get_Char_Index (ft_font->ft_face, unicode);
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
+  unsigned int g;
+
+  if (!ft_font->cmap.get (unicode, &g))
+  {
+    ft_font->lock->lock ();
+    g = FT_Get_Char_Index (ft_font->ft_face, unicode);
+    ft_font->lock->unlock ();
+    ft_font->cmap.set (unicode, g);
+  }
 
   if (unlikely (!g))
     return false;
@@ -179,8 +245,10 @@ hb_ft_get_variation_glyph (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t *glyph,
 			   void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
+  ft_font->lock->lock ();
   unsigned int g = FT_Face_GetCharVariantIndex (ft_font->ft_face, unicode, variation_selector);
+  ft_font->lock->unlock ();
 
   if (unlikely (!g))
     return false;
@@ -189,16 +257,64 @@ hb_ft_get_variation_glyph (hb_font_t *font HB_UNUSED,
   return true;
 }
 
+/* Returns the advance of glyph in font units, through cache.  On a miss,
+ * fetches the advances of the aligned run of glyphs around it, as text
+ * mostly uses glyphs close to each other. */
+static bool
+_hb_ft_get_unscaled_advance (hb_ft_font_t *ft_font,
+			     hb_advance_cache_t *cache,
+			     int load_flags,
+			     hb_codepoint_t glyph,
+			     FT_Fixed *v)
+{
+  unsigned int cached;
+  if (cache->get (glyph, &cached))
+  {
+    *v = cached;
+    return true;
+  }
+
+  FT_Face ft_face = ft_font->ft_face;
+  FT_Fixed advances[16];
+  unsigned int start = glyph & ~15u;
+  unsigned int count = MIN<unsigned int> (ARRAY_LENGTH (advances), ft_face->num_glyphs - MIN<unsigned int> (start, ft_face->num_glyphs));
+  ft_font->lock->lock ();
+  if (glyph < start + count &&
+      !FT_Get_Advances (ft_face, start, count, load_flags, advances))
+  {
+    ft_font->lock->unlock ();
+    for (unsigned int i = 0; i < count; i++)
+      cache->set (start + i, advances[i]);
+    *v = advances[glyph - start];
+    return true;
+  }
+  bool ret = !FT_Get_Advance (ft_face, glyph, load_flags, v);
+  ft_font->lock->unlock ();
+
+  return ret;
+}
+
 static hb_position_t
 hb_ft_get_glyph_h_advance (hb_font_t *font HB_UNUSED,
 			   void *font_data,
 			   hb_codepoint_t glyph,
 			   void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Fixed v;
 
-  if (unlikely (FT_Get_Advance (ft_font->ft_face, glyph, ft_font->load_flags, &v)))
+  if (ft_font->unscaled ())
+  {
+    if (unlikely (!_hb_ft_get_unscaled_advance (ft_font, &ft_font->h_advances,
+						ft_font->load_flags, glyph, &v)))
+      return 0;
+    return font->em_scale_x (v);
+  }
+
+  ft_font->lock->lock ();
+  FT_Error err = FT_Get_Advance (ft_font->ft_face, glyph, ft_font->load_flags, &v);
+  ft_font->lock->unlock ();
+  if (unlikely (err))
     return 0;
 
   if (font->x_scale < 0)
@@ -213,10 +329,22 @@ hb_ft_get_glyph_v_advance (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t glyph,
 			   void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Fixed v;
 
-  if (unlikely (FT_Get_Advance (ft_font->ft_face, glyph, ft_font->load_flags | FT_LOAD_VERTICAL_LAYOUT, &v)))
+  if (ft_font->unscaled ())
+  {
+    if (unlikely (!_hb_ft_get_unscaled_advance (ft_font, &ft_font->v_advances,
+						ft_font->load_flags | FT_LOAD_VERTICAL_LAYOUT, glyph, &v)))
+      return 0;
+    /* See below for the negation. */
+    return font->em_scale_y (-v);
+  }
+
+  ft_font->lock->lock ();
+  FT_Error err = FT_Get_Advance (ft_font->ft_face, glyph, ft_font->load_flags | FT_LOAD_VERTICAL_LAYOUT, &v);
+  ft_font->lock->unlock ();
+  if (unlikely (err))
     return 0;
 
   if (font->y_scale < 0)
@@ -235,16 +363,28 @@ hb_ft_get_glyph_v_origin (hb_font_t *font HB_UNUSED,
 			  hb_position_t *y,
 			  void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Face ft_face = ft_font->ft_face;
 
+  ft_font->lock->lock ();
   if (unlikely (FT_Load_Glyph (ft_face, glyph, ft_font->load_flags)))
+  {
+    ft_font->lock->unlock ();
     return false;
+  }
 
   /* Note: FreeType's vertical metrics grows downward while other FreeType coordinates
    * have a Y growing upward.  Hence the extra negation. */
   *x = ft_face->glyph->metrics.horiBearingX -   ft_face->glyph->metrics.vertBearingX;
   *y = ft_face->glyph->metrics.horiBearingY - (-ft_face->glyph->metrics.vertBearingY);
+  ft_font->lock->unlock ();
+
+  if (ft_font->unscaled ())
+  {
+    *x = font->em_scale_x (*x);
+    *y = font->em_scale_y (*y);
+    return true;
+  }
 
   if (font->x_scale < 0)
     *x = -*x;
@@ -261,13 +401,20 @@ hb_ft_get_glyph_h_kerning (hb_font_t *font,
 			   hb_codepoint_t right_glyph,
 			   void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Vector kerningv;
 
-  FT_Kerning_Mode mode = font->x_ppem ? FT_KERNING_DEFAULT : FT_KERNING_UNFITTED;
-  if (FT_Get_Kerning (ft_font->ft_face, left_glyph, right_glyph, mode, &kerningv))
+  FT_UInt mode = ft_font->unscaled () ? FT_KERNING_UNSCALED :
+		 font->x_ppem ? FT_KERNING_DEFAULT : FT_KERNING_UNFITTED;
+  ft_font->lock->lock ();
+  FT_Error err = FT_Get_Kerning (ft_font->ft_face, left_glyph, right_glyph, mode, &kerningv);
+  ft_font->lock->unlock ();
+  if (err)
     return 0;
 
+  if (ft_font->unscaled ())
+    return font->em_scale_x (kerningv.x);
+
   return kerningv.x;
 }
 
@@ -278,16 +425,46 @@ hb_ft_get_glyph_extents (hb_font_t *font HB_UNUSED,
 			 hb_glyph_extents_t *extents,
 			 void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Face ft_face = ft_font->ft_face;
 
+  if (ft_font->unscaled ())
+  {
+    hb_glyph_extents_t unscaled;
+    if (!ft_font->extents.get (glyph, &unscaled))
+    {
+      ft_font->lock->lock ();
+      if (unlikely (FT_Load_Glyph (ft_face, glyph, ft_font->load_flags)))
+      {
+	ft_font->lock->unlock ();
+	return false;
+      }
+      unscaled.x_bearing = ft_face->glyph->metrics.horiBearingX;
+      unscaled.y_bearing = ft_face->glyph->metrics.horiBearingY;
+      unscaled.width = ft_face->glyph->metrics.width;
+      unscaled.height = -ft_face->glyph->metrics.height;
+      ft_font->lock->unlock ();
+      ft_font->extents.set (glyph, &unscaled);
+    }
+    extents->x_bearing = font->em_scale_x (unscaled.x_bearing);
+    extents->y_bearing = font->em_scale_y (unscaled.y_bearing);
+    extents->width = font->em_scale_x (unscaled.width);
+    extents->height = font->em_scale_y (unscaled.height);
+    return true;
+  }
+
+  ft_font->lock->lock ();
   if (unlikely (FT_Load_Glyph (ft_face, glyph, ft_font->load_flags)))
+  {
+    ft_font->lock->unlock ();
     return false;
+  }
 
   extents->x_bearing = ft_face->glyph->metrics.horiBearingX;
   extents->y_bearing = ft_face->glyph->metrics.horiBearingY;
   extents->width = ft_face->glyph->metrics.width;
   extents->height = -ft_face->glyph->metrics.height;
+  ft_font->lock->unlock ();
   if (font->x_scale < 0)
   {
     extents->x_bearing = -extents->x_bearing;
@@ -310,20 +487,28 @@ hb_ft_get_glyph_contour_point (hb_font_t *font HB_UNUSED,
 			       hb_position_t *y,
 			       void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Face ft_face = ft_font->ft_face;
 
-  if (unlikely (FT_Load_Glyph (ft_face, glyph, ft_font->load_flags)))
-      return false;
-
-  if (unlikely (ft_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE))
-      return false;
+  ft_font->lock->lock ();
+  bool ret = !FT_Load_Glyph (ft_face, glyph, ft_font->load_flags) &&
+	     ft_face->glyph->format == FT_GLYPH_FORMAT_OUTLINE &&
+	     point_index < (unsigned int) ft_face->glyph->outline.n_points;
+  if (likely (ret))
+  {
+    *x = ft_face->glyph->outline.points[point_index].x;
+    *y = ft_face->glyph->outline.points[point_index].y;
+  }
+  ft_font->lock->unlock ();
 
-  if (unlikely (point_index >= (unsigned int) ft_face->glyph->outline.n_points))
-      return false;
+  if (unlikely (!ret))
+    return false;
 
-  *x = ft_face->glyph->outline.points[point_index].x;
-  *y = ft_face->glyph->outline.points[point_index].y;
+  if (ft_font->unscaled ())
+  {
+    *x = font->em_scale_x (*x);
+    *y = font->em_scale_y (*y);
+  }
 
   return true;
 }
@@ -335,9 +520,11 @@ hb_ft_get_glyph_name (hb_font_t *font HB_UNUSED,
 		      char *name, unsigned int size,
 		      void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
 
+  ft_font->lock->lock ();
   hb_bool_t ret = !FT_Get_Glyph_Name (ft_font->ft_face, glyph, name, size);
+  ft_font->lock->unlock ();
   if (ret && (size && !*name))
     ret = false;
 
@@ -351,8 +538,11 @@ hb_ft_get_glyph_from_name (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t *glyph,
 			   void *user_data HB_UNUSED)
 {
-  const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
+  hb_ft_font_t *ft_font = (hb_ft_font_t *) font_data;
   FT_Face ft_face = ft_font->ft_face;
+  hb_bool_t ret;
+
+  ft_font->lock->lock ();
 
   if (len < 0)
     *glyph = FT_Get_Name_Index (ft_face, (FT_String *) name);
@@ -369,12 +559,15 @@ hb_ft_get_glyph_from_name (hb_font_t *font HB_UNUSED,
   {
     /* Check whether the given name was actually the name of glyph 0. */
     char buf[128];
-    if (!FT_Get_Glyph_Name(ft_face, 0, buf, sizeof (buf)) &&
-        len < 0 ? !strcmp (buf, name) : !strncmp (buf, name, len))
-      return true;
+    ret = !FT_Get_Glyph_Name(ft_face, 0, buf, sizeof (buf)) &&
+	  len < 0 ? !strcmp (buf, name) : !strncmp (buf, name, len);
   }
+  else
+    ret = true;
 
-  return *glyph != 0;
+  ft_font->lock->unlock ();
+
+  return ret;
 }
 
 static hb_bool_t
@@ -385,6 +578,13 @@ hb_ft_get_font_h_extents (hb_font_t *font HB_UNUSED,
 {
   const hb_ft_font_t *ft_font = (const hb_ft_font_t *) font_data;
   FT_Face ft_face = ft_font->ft_face;
+  if (ft_font->unscaled ())
+  {
+    metrics->ascender = font->em_scale_y (ft_face->ascender);
+    metrics->descender = font->em_scale_y (ft_face->descender);
+    metrics->line_gap = font->em_scale_y (ft_face->height - (ft_face->ascender - ft_face->descender));
+    return true;
+  }
   metrics->ascender = ft_face->size->metrics.ascender;
   metrics->descender = ft_face->size->metrics.descender;
   metrics->line_gap = ft_face->size->metrics.height - (ft_face->size->metrics.ascender - ft_face->size->metrics.descender);
@@ -444,24 +644,45 @@ retry:
 #endif
   };
 
+  /* The face holds the lock, and the font holds the face. */
+  hb_mutex_t *shared_lock = NULL;
+  hb_face_t *face = font->face;
+  if (face->reference_table_func == reference_table &&
+      ((hb_ft_face_data_t *) face->user_data)->ft_face == ft_face)
+    shared_lock = &((hb_ft_face_data_t *) face->user_data)->lock;
+
   hb_font_set_funcs (font,
 		     funcs,
-		     _hb_ft_font_create (ft_face, unref),
+		     _hb_ft_font_create (ft_face, unref, shared_lock),
 		     (hb_destroy_func_t) _hb_ft_font_destroy);
 }
 
 
+static void
+_hb_ft_face_data_destroy (hb_ft_face_data_t *data)
+{
+  if (data->destroy)
+    data->destroy (data->ft_face);
+
+  data->lock.finish ();
+
+  free (data);
+}
+
 static hb_blob_t *
 reference_table  (hb_face_t *face HB_UNUSED, hb_tag_t tag, void *user_data)
 {
-  FT_Face ft_face = (FT_Face) user_data;
+  hb_ft_face_data_t *data = (hb_ft_face_data_t *) user_data;
+  FT_Face ft_face = data->ft_face;
   FT_Byte *buffer;
   FT_ULong  length = 0;
   FT_Error error;
 
   /* Note: FreeType like HarfBuzz uses the NONE tag for fetching the entire blob */
 
+  data->lock.lock ();
   error = FT_Load_Sfnt_Table (ft_face, tag, 0, NULL, &length);
+  data->lock.unlock ();
   if (error)
     return NULL;
 
@@ -469,9 +690,14 @@ reference_table  (hb_face_t *face HB_UNUSED, hb_tag_t tag, void *user_data)
   if (buffer == NULL)
     return NULL;
 
+  data->lock.lock ();
   error = FT_Load_Sfnt_Table (ft_face, tag, 0, buffer, &length);
+  data->lock.unlock ();
   if (error)
+  {
+    free (buffer);
     return NULL;
+  }
 
   return hb_blob_create ((const char *) buffer, length,
 			 HB_MEMORY_MODE_WRITABLE,
@@ -504,7 +730,19 @@ hb_ft_face_create (FT_Face           ft_face,
     face = hb_face_create (blob, ft_face->face_index);
     hb_blob_destroy (blob);
   } else {
-    face = hb_face_create_for_tables (reference_table, ft_face, destroy);
+    hb_ft_face_data_t *data = (hb_ft_face_data_t *) calloc (1, sizeof (hb_ft_face_data_t));
+    if (unlikely (!data))
+    {
+      if (destroy)
+	destroy (ft_face);
+      return hb_face_get_empty ();
+    }
+    data->ft_face = ft_face;
+    data->destroy = destroy;
+    data->lock.init ();
+
+    face = hb_face_create_for_tables (reference_table, data,
+				      (hb_destroy_func_t) _hb_ft_face_data_destroy);
   }
 
   hb_face_set_index (face, ft_face->face_index);
@@ -695,5 +933,5 @@ hb_ft_font_set_funcs (hb_font_t *font)
   ft_face->generic.finalizer = (FT_Generic_Finalizer) _release_blob;
 
   _hb_ft_font_set_funcs (font, ft_face, true);
-  hb_ft_font_set_load_flags (font, FT_LOAD_DEFAULT | FT_LOAD_NO_HINTING);
+  hb_ft_font_set_load_flags (font, FT_LOAD_DEFAULT | FT_LOAD_NO_SCALE);
 }
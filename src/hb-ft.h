@@ -39,6 +39,14 @@ HB_BEGIN_DECLS
 /*
  * Note: FreeType is not thread-safe.
  * Hence, these functions are not either.
+ *
+ * Fonts made by hb_ft_font_create() and hb_ft_font_set_funcs() serialize
+ * their own use of the FT_Face, so they can be shared between threads like
+ * other fonts.  So do faces made by hb_ft_face_create() when they load
+ * tables through the FT_Face, with the same lock as the fonts made on
+ * them.  The client must not use that FT_Face at the same time, though,
+ * nor change its size while HarfBuzz may be using it, nor use it through
+ * two hb-ft faces at the same time.
  */
 
 /*
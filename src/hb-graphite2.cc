@@ -421,5 +421,8 @@ _hb_graphite2_shape (hb_shape_plan_t    *shape_plan,
   if (feats) gr_featureval_destroy (feats);
   gr_seg_destroy (seg);
 
+  /* Graphite doesn't tell us where rules matched. */
+  buffer->unsafe_to_break_all ();
+
   return true;
 }
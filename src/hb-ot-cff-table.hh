@@ -0,0 +1,1065 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef HB_OT_CFF_TABLE_HH
+#define HB_OT_CFF_TABLE_HH
+
+#include "hb-open-type-private.hh"
+#include "hb-cache-private.hh"
+
+
+namespace OT {
+
+
+/*
+ * CFF  -- Compact Font Format (PostScript outlines)
+ * CFF2 -- Compact Font Format version 2
+ */
+
+#define HB_OT_TAG_CFF HB_TAG('C','F','F',' ')
+#define HB_OT_TAG_CFF2 HB_TAG('C','F','F','2')
+
+
+/* Strings with SIDs below 391 are not stored in the font. */
+#define HB_OT_CFF_NUM_STANDARD_STRINGS 391
+static const char * const _hb_ot_cff_standard_strings[HB_OT_CFF_NUM_STANDARD_STRINGS] =
+{
+  /*   0 */ ".notdef", "space", "exclam", "quotedbl",
+  /*   4 */ "numbersign", "dollar", "percent", "ampersand",
+  /*   8 */ "quoteright", "parenleft", "parenright", "asterisk",
+  /*  12 */ "plus", "comma", "hyphen", "period",
+  /*  16 */ "slash", "zero", "one", "two",
+  /*  20 */ "three", "four", "five", "six",
+  /*  24 */ "seven", "eight", "nine", "colon",
+  /*  28 */ "semicolon", "less", "equal", "greater",
+  /*  32 */ "question", "at", "A", "B",
+  /*  36 */ "C", "D", "E", "F",
+  /*  40 */ "G", "H", "I", "J",
+  /*  44 */ "K", "L", "M", "N",
+  /*  48 */ "O", "P", "Q", "R",
+  /*  52 */ "S", "T", "U", "V",
+  /*  56 */ "W", "X", "Y", "Z",
+  /*  60 */ "bracketleft", "backslash", "bracketright", "asciicircum",
+  /*  64 */ "underscore", "quoteleft", "a", "b",
+  /*  68 */ "c", "d", "e", "f",
+  /*  72 */ "g", "h", "i", "j",
+  /*  76 */ "k", "l", "m", "n",
+  /*  80 */ "o", "p", "q", "r",
+  /*  84 */ "s", "t", "u", "v",
+  /*  88 */ "w", "x", "y", "z",
+  /*  92 */ "braceleft", "bar", "braceright", "asciitilde",
+  /*  96 */ "exclamdown", "cent", "sterling", "fraction",
+  /* 100 */ "yen", "florin", "section", "currency",
+  /* 104 */ "quotesingle", "quotedblleft", "guillemotleft", "guilsinglleft",
+  /* 108 */ "guilsinglright", "fi", "fl", "endash",
+  /* 112 */ "dagger", "daggerdbl", "periodcentered", "paragraph",
+  /* 116 */ "bullet", "quotesinglbase", "quotedblbase", "quotedblright",
+  /* 120 */ "guillemotright", "ellipsis", "perthousand", "questiondown",
+  /* 124 */ "grave", "acute", "circumflex", "tilde",
+  /* 128 */ "macron", "breve", "dotaccent", "dieresis",
+  /* 132 */ "ring", "cedilla", "hungarumlaut", "ogonek",
+  /* 136 */ "caron", "emdash", "AE", "ordfeminine",
+  /* 140 */ "Lslash", "Oslash", "OE", "ordmasculine",
+  /* 144 */ "ae", "dotlessi", "lslash", "oslash",
+  /* 148 */ "oe", "germandbls", "onesuperior", "logicalnot",
+  /* 152 */ "mu", "trademark", "Eth", "onehalf",
+  /* 156 */ "plusminus", "Thorn", "onequarter", "divide",
+  /* 160 */ "brokenbar", "degree", "thorn", "threequarters",
+  /* 164 */ "twosuperior", "registered", "minus", "eth",
+  /* 168 */ "multiply", "threesuperior", "copyright", "Aacute",
+  /* 172 */ "Acircumflex", "Adieresis", "Agrave", "Aring",
+  /* 176 */ "Atilde", "Ccedilla", "Eacute", "Ecircumflex",
+  /* 180 */ "Edieresis", "Egrave", "Iacute", "Icircumflex",
+  /* 184 */ "Idieresis", "Igrave", "Ntilde", "Oacute",
+  /* 188 */ "Ocircumflex", "Odieresis", "Ograve", "Otilde",
+  /* 192 */ "Scaron", "Uacute", "Ucircumflex", "Udieresis",
+  /* 196 */ "Ugrave", "Yacute", "Ydieresis", "Zcaron",
+  /* 200 */ "aacute", "acircumflex", "adieresis", "agrave",
+  /* 204 */ "aring", "atilde", "ccedilla", "eacute",
+  /* 208 */ "ecircumflex", "edieresis", "egrave", "iacute",
+  /* 212 */ "icircumflex", "idieresis", "igrave", "ntilde",
+  /* 216 */ "oacute", "ocircumflex", "odieresis", "ograve",
+  /* 220 */ "otilde", "scaron", "uacute", "ucircumflex",
+  /* 224 */ "udieresis", "ugrave", "yacute", "ydieresis",
+  /* 228 */ "zcaron", "exclamsmall", "Hungarumlautsmall", "dollaroldstyle",
+  /* 232 */ "dollarsuperior", "ampersandsmall", "Acutesmall",
+  /* 235 */ "parenleftsuperior", "parenrightsuperior", "twodotenleader",
+  /* 238 */ "onedotenleader", "zerooldstyle", "oneoldstyle", "twooldstyle",
+  /* 242 */ "threeoldstyle", "fouroldstyle", "fiveoldstyle", "sixoldstyle",
+  /* 246 */ "sevenoldstyle", "eightoldstyle", "nineoldstyle",
+  /* 249 */ "commasuperior", "threequartersemdash", "periodsuperior",
+  /* 252 */ "questionsmall", "asuperior", "bsuperior", "centsuperior",
+  /* 256 */ "dsuperior", "esuperior", "isuperior", "lsuperior",
+  /* 260 */ "msuperior", "nsuperior", "osuperior", "rsuperior",
+  /* 264 */ "ssuperior", "tsuperior", "ff", "ffi",
+  /* 268 */ "ffl", "parenleftinferior", "parenrightinferior",
+  /* 271 */ "Circumflexsmall", "hyphensuperior", "Gravesmall", "Asmall",
+  /* 275 */ "Bsmall", "Csmall", "Dsmall", "Esmall",
+  /* 279 */ "Fsmall", "Gsmall", "Hsmall", "Ismall",
+  /* 283 */ "Jsmall", "Ksmall", "Lsmall", "Msmall",
+  /* 287 */ "Nsmall", "Osmall", "Psmall", "Qsmall",
+  /* 291 */ "Rsmall", "Ssmall", "Tsmall", "Usmall",
+  /* 295 */ "Vsmall", "Wsmall", "Xsmall", "Ysmall",
+  /* 299 */ "Zsmall", "colonmonetary", "onefitted", "rupiah",
+  /* 303 */ "Tildesmall", "exclamdownsmall", "centoldstyle", "Lslashsmall",
+  /* 307 */ "Scaronsmall", "Zcaronsmall", "Dieresissmall", "Brevesmall",
+  /* 311 */ "Caronsmall", "Dotaccentsmall", "Macronsmall", "figuredash",
+  /* 315 */ "hypheninferior", "Ogoneksmall", "Ringsmall", "Cedillasmall",
+  /* 319 */ "questiondownsmall", "oneeighth", "threeeighths", "fiveeighths",
+  /* 323 */ "seveneighths", "onethird", "twothirds", "zerosuperior",
+  /* 327 */ "foursuperior", "fivesuperior", "sixsuperior", "sevensuperior",
+  /* 331 */ "eightsuperior", "ninesuperior", "zeroinferior", "oneinferior",
+  /* 335 */ "twoinferior", "threeinferior", "fourinferior", "fiveinferior",
+  /* 339 */ "sixinferior", "seveninferior", "eightinferior", "nineinferior",
+  /* 343 */ "centinferior", "dollarinferior", "periodinferior",
+  /* 346 */ "commainferior", "Agravesmall", "Aacutesmall",
+  /* 349 */ "Acircumflexsmall", "Atildesmall", "Adieresissmall",
+  /* 352 */ "Aringsmall", "AEsmall", "Ccedillasmall", "Egravesmall",
+  /* 356 */ "Eacutesmall", "Ecircumflexsmall", "Edieresissmall",
+  /* 359 */ "Igravesmall", "Iacutesmall", "Icircumflexsmall",
+  /* 362 */ "Idieresissmall", "Ethsmall", "Ntildesmall", "Ogravesmall",
+  /* 366 */ "Oacutesmall", "Ocircumflexsmall", "Otildesmall",
+  /* 369 */ "Odieresissmall", "OEsmall", "Oslashsmall", "Ugravesmall",
+  /* 373 */ "Uacutesmall", "Ucircumflexsmall", "Udieresissmall",
+  /* 376 */ "Yacutesmall", "Thornsmall", "Ydieresissmall", "001.000",
+  /* 380 */ "001.001", "001.002", "001.003", "Black",
+  /* 384 */ "Bold", "Book", "Light", "Medium",
+  /* 388 */ "Regular", "Roman", "Semibold",
+};
+
+
+/* CFF data is addressed by offsets of varying sizes and is not aligned, so
+ * it is read through these bounds-checked helpers rather than mapped onto
+ * structs like the sfnt tables are. */
+
+static inline unsigned int
+_hb_cff_read (const uint8_t *p, unsigned int size)
+{
+  unsigned int v = 0;
+  for (unsigned int i = 0; i < size; i++)
+    v = (v << 8) | p[i];
+  return v;
+}
+
+static inline int
+_hb_cff_floor (double v)
+{
+  int i = (int) v;
+  return i > v ? i - 1 : i;
+}
+
+struct CFFIndex
+{
+  /* Parses the INDEX at p; returns false if it does not fit before end.
+   * The count is 16-bit in CFF and 32-bit in CFF2. */
+  inline bool init (const uint8_t *p, const uint8_t *end, unsigned int count_size = 2)
+  {
+    this->count = 0;
+    this->data = this->offsets = this->end = p;
+    if (unlikely (p >= end || (unsigned int) (end - p) < count_size))
+      return false;
+    unsigned int count = _hb_cff_read (p, count_size);
+    p += count_size;
+    if (!count)
+    {
+      this->end = p;
+      return true;
+    }
+    if (unlikely (p >= end))
+      return false;
+    this->off_size = *p++;
+    if (unlikely (this->off_size < 1 || this->off_size > 4))
+      return false;
+    this->offsets = p;
+    if (unlikely ((unsigned int) (end - this->offsets) / this->off_size <= count))
+      return false;
+    this->data = this->offsets + (count + 1) * this->off_size - 1; /* Offsets are 1-based. */
+    unsigned int last = _hb_cff_read (this->offsets + count * this->off_size, this->off_size);
+    if (unlikely (last < 1 || last > (unsigned int) (end - this->data)))
+      return false;
+    this->end = this->data + last;
+    this->count = count;
+    return true;
+  }
+
+  inline bool get (unsigned int i, const uint8_t **item, unsigned int *len) const
+  {
+    if (unlikely (i >= this->count))
+      return false;
+    unsigned int start = _hb_cff_read (this->offsets + i * this->off_size, this->off_size);
+    unsigned int stop = _hb_cff_read (this->offsets + (i + 1) * this->off_size, this->off_size);
+    if (unlikely (start < 1 || start > stop || stop > (unsigned int) (this->end - this->data)))
+      return false;
+    *item = this->data + start;
+    *len = stop - start;
+    return true;
+  }
+
+  /* Subroutine numbers in charstrings are biased by this. */
+  inline int get_bias (void) const
+  {
+    return this->count < 1240 ? 107 : this->count < 33900 ? 1131 : 32768;
+  }
+
+  unsigned int count;
+  unsigned int off_size;
+  const uint8_t *offsets;
+  const uint8_t *data;
+  const uint8_t *end;
+};
+
+/* DICT operators we care about. */
+enum cff_dict_op_t {
+  CFF_OP_charset	= 15,
+  CFF_OP_CharStrings	= 17,
+  CFF_OP_Private	= 18,
+  CFF_OP_Subrs		= 19,
+  CFF_OP_vsindex	= 22,
+  CFF_OP_vstore		= 24,
+  CFF_OP_ROS		= (12 << 8) | 30,
+  CFF_OP_FDArray	= (12 << 8) | 36,
+  CFF_OP_FDSelect	= (12 << 8) | 37
+};
+
+/* Calls op_func (op, operands, num_operands) for each operator in the DICT
+ * data [p, end).  Real operands are read as zero; none of the operators we
+ * look at takes one.  Returns false on malformed data. */
+template <typename OpFunc>
+static inline bool
+_hb_cff_parse_dict (const uint8_t *p, const uint8_t *end, OpFunc &op_func)
+{
+  int operands[48];
+  unsigned int num_operands = 0;
+  while (p < end)
+  {
+    unsigned int b0 = *p++;
+    int v;
+    if (b0 <= 24)
+    {
+      unsigned int op = b0;
+      if (b0 == 12)
+      {
+	if (unlikely (p >= end))
+	  return false;
+	op = (12 << 8) | *p++;
+      }
+      op_func (op, operands, num_operands);
+      num_operands = 0;
+      continue;
+    }
+    else if (b0 == 28)
+    {
+      if (unlikely (p + 2 > end))
+	return false;
+      v = (int16_t) _hb_cff_read (p, 2);
+      p += 2;
+    }
+    else if (b0 == 29)
+    {
+      if (unlikely (p + 4 > end))
+	return false;
+      v = (int32_t) _hb_cff_read (p, 4);
+      p += 4;
+    }
+    else if (b0 == 30)
+    {
+      /* Real number; skip nibbles up to the end marker. */
+      for (;;)
+      {
+	if (unlikely (p >= end))
+	  return false;
+	unsigned int b = *p++;
+	if ((b & 0x0F) == 0x0F || (b & 0xF0) == 0xF0)
+	  break;
+      }
+      v = 0;
+    }
+    else if (b0 >= 32 && b0 <= 246)
+      v = (int) b0 - 139;
+    else if (b0 >= 247 && b0 <= 254)
+    {
+      if (unlikely (p >= end))
+	return false;
+      if (b0 < 251)
+	v = ((int) (b0 - 247) << 8) + *p++ + 108;
+      else
+	v = -((int) (b0 - 251) << 8) - *p++ - 108;
+    }
+    else
+      return false;
+
+    if (unlikely (num_operands >= ARRAY_LENGTH (operands)))
+      return false;
+    operands[num_operands++] = v;
+  }
+  return true;
+}
+
+/* The values of the Top, Font and Private DICT operators we use. */
+struct cff_dict_values_t
+{
+  inline void operator () (unsigned int op, const int *operands, unsigned int num_operands)
+  {
+    int v = num_operands ? operands[num_operands - 1] : 0;
+    switch (op)
+    {
+      case CFF_OP_charset:	charset_offset = v;		break;
+      case CFF_OP_CharStrings:	charstrings_offset = v;		break;
+      case CFF_OP_Subrs:	subrs_offset = v;		break;
+      case CFF_OP_vsindex:	vsindex = v;			break;
+      case CFF_OP_vstore:	vstore_offset = v;		break;
+      case CFF_OP_ROS:		is_cid = true;			break;
+      case CFF_OP_FDArray:	fd_array_offset = v;		break;
+      case CFF_OP_FDSelect:	fd_select_offset = v;		break;
+      case CFF_OP_Private:
+	if (num_operands >= 2)
+	{
+	  private_size = operands[num_operands - 2];
+	  private_offset = v;
+	}
+	break;
+    }
+  }
+
+  int charset_offset;
+  int charstrings_offset;
+  int private_size;
+  int private_offset;
+  int subrs_offset;
+  int vsindex;
+  int vstore_offset;
+  int fd_array_offset;
+  int fd_select_offset;
+  bool is_cid;
+};
+
+
+struct CFF_accelerator_t
+{
+  struct fd_t
+  {
+    CFFIndex subrs;
+    unsigned int vsindex;
+  };
+
+  inline void init (hb_face_t *face)
+  {
+    memset (this, 0, sizeof (*this));
+    this->extents_cache.clear ();
+
+    this->blob = face->reference_table (HB_OT_TAG_CFF);
+    if (!hb_blob_get_length (this->blob))
+    {
+      hb_blob_destroy (this->blob);
+      this->blob = face->reference_table (HB_OT_TAG_CFF2);
+      this->is_cff2 = true;
+    }
+
+    unsigned int len = hb_blob_get_length (this->blob);
+    const uint8_t *start = (const uint8_t *) hb_blob_get_data (this->blob, NULL);
+    const uint8_t *end = start + len;
+    this->table = start;
+    this->table_end = end;
+
+    /* Header: major, minor, hdrSize, and offSize (CFF) or topDictLength
+     * (CFF2). */
+    if (len < 5 || start[0] != (this->is_cff2 ? 2 : 1) || start[2] > len)
+      return;
+
+    cff_dict_values_t top;
+    memset (&top, 0, sizeof (top));
+    top.charset_offset = -1;
+    const uint8_t *next;
+    if (this->is_cff2)
+    {
+      unsigned int top_dict_length = _hb_cff_read (start + 3, 2);
+      const uint8_t *dict = start + start[2];
+      if (top_dict_length > (unsigned int) (end - dict) ||
+	  !_hb_cff_parse_dict (dict, dict + top_dict_length, top))
+	return;
+      next = dict + top_dict_length;
+    }
+    else
+    {
+      CFFIndex name_index, top_dict_index;
+      if (!name_index.init (start + start[2], end) ||
+	  !top_dict_index.init (name_index.end, end) ||
+	  !this->string_index.init (top_dict_index.end, end))
+	return;
+      const uint8_t *dict;
+      unsigned int dict_len;
+      top.charset_offset = 0;
+      if (!top_dict_index.get (0, &dict, &dict_len) ||
+	  !_hb_cff_parse_dict (dict, dict + dict_len, top))
+	return;
+      next = this->string_index.end;
+    }
+    unsigned int count_size = this->is_cff2 ? 4 : 2;
+    if (!this->global_subrs.init (next, end, count_size))
+      return;
+
+    if (top.charstrings_offset <= 0 || (unsigned int) top.charstrings_offset >= len ||
+	!this->charstrings.init (start + top.charstrings_offset, end, count_size))
+      return;
+
+    if (top.vstore_offset > 0 && (unsigned int) top.vstore_offset + 2 < len)
+    {
+      /* The ItemVariationStore follows a 16-bit length. */
+      this->vstore = start + top.vstore_offset + 2;
+    }
+
+    /* Each Font DICT of a CID-keyed font, or the single Private DICT of a
+     * name-keyed one, brings its own local subroutines. */
+    CFFIndex fd_array;
+    if (top.fd_array_offset > 0 && (unsigned int) top.fd_array_offset < len &&
+	fd_array.init (start + top.fd_array_offset, end, count_size) &&
+	fd_array.count)
+    {
+      this->fds = (fd_t *) calloc (fd_array.count, sizeof (fd_t));
+      if (unlikely (!this->fds))
+	return;
+      this->num_fds = fd_array.count;
+      for (unsigned int i = 0; i < this->num_fds; i++)
+      {
+	const uint8_t *dict;
+	unsigned int dict_len;
+	cff_dict_values_t font;
+	memset (&font, 0, sizeof (font));
+	if (fd_array.get (i, &dict, &dict_len) &&
+	    _hb_cff_parse_dict (dict, dict + dict_len, font))
+	  init_private (font, &this->fds[i]);
+      }
+      if (top.fd_select_offset > 0 && (unsigned int) top.fd_select_offset < len)
+	this->fd_select = start + top.fd_select_offset;
+    }
+    else
+    {
+      this->fds = (fd_t *) calloc (1, sizeof (fd_t));
+      if (unlikely (!this->fds))
+	return;
+      this->num_fds = 1;
+      init_private (top, &this->fds[0]);
+    }
+
+    this->num_glyphs = this->charstrings.count;
+
+    /* CID-keyed fonts map glyphs to CIDs, not names; neither do the
+     * predefined Expert charsets, which we don't carry; CFF2 has no
+     * names at all. */
+    this->charset_offset = top.charset_offset;
+    this->has_glyph_names = !this->is_cff2 &&
+			    !top.is_cid &&
+			    this->charset_offset != 1 &&
+			    this->charset_offset != 2 &&
+			    this->charset_offset >= 0 &&
+			    (unsigned int) this->charset_offset < len;
+  }
+
+  inline void fini (void)
+  {
+    hb_blob_destroy (this->blob);
+    free (this->fds);
+  }
+
+  inline void init_private (const cff_dict_values_t &dict, fd_t *fd)
+  {
+    if (dict.private_offset <= 0 || dict.private_size <= 0 ||
+	(unsigned int) dict.private_offset > (unsigned int) (this->table_end - this->table) ||
+	(unsigned int) dict.private_size > (unsigned int) (this->table_end - this->table) - dict.private_offset)
+      return;
+    const uint8_t *p = this->table + dict.private_offset;
+    cff_dict_values_t priv;
+    memset (&priv, 0, sizeof (priv));
+    if (!_hb_cff_parse_dict (p, p + dict.private_size, priv))
+      return;
+    fd->vsindex = MAX (priv.vsindex, 0);
+    /* Subrs is relative to the Private DICT. */
+    if (priv.subrs_offset > 0 &&
+	(unsigned int) priv.subrs_offset < (unsigned int) (this->table_end - p))
+      fd->subrs.init (p + priv.subrs_offset, this->table_end, this->is_cff2 ? 4 : 2);
+  }
+
+  inline unsigned int get_fd (hb_codepoint_t glyph) const
+  {
+    if (!this->fd_select)
+      return 0;
+    const uint8_t *p = this->fd_select;
+    const uint8_t *end = this->table_end;
+    unsigned int fd = 0;
+    switch (*p++)
+    {
+      case 0:
+	if (glyph < (unsigned int) (end - p))
+	  fd = p[glyph];
+	break;
+      case 3:
+      case 4:
+      {
+	/* Ranges of (first glyph, fd), then a sentinel glyph. */
+	unsigned int glyph_size = this->fd_select[0] == 3 ? 2 : 4;
+	unsigned int fd_size = glyph_size / 2;
+	unsigned int range_size = glyph_size + fd_size;
+	if ((unsigned int) (end - p) < glyph_size)
+	  break;
+	unsigned int num_ranges = _hb_cff_read (p, glyph_size);
+	p += glyph_size;
+	if ((unsigned int) (end - p) / range_size < num_ranges ||
+	    (unsigned int) (end - p) - num_ranges * range_size < glyph_size)
+	  break;
+	/* Binary search for the last range starting at or before glyph. */
+	int min = 0, max = (int) num_ranges - 1;
+	while (min <= max)
+	{
+	  int mid = (min + max) / 2;
+	  const uint8_t *range = p + mid * range_size;
+	  if (glyph < _hb_cff_read (range, glyph_size))
+	    max = mid - 1;
+	  else
+	  {
+	    unsigned int next_first = _hb_cff_read (range + range_size, glyph_size);
+	    if (glyph < next_first)
+	    {
+	      fd = _hb_cff_read (range + glyph_size, fd_size);
+	      break;
+	    }
+	    min = mid + 1;
+	  }
+	}
+	break;
+      }
+    }
+    return fd < this->num_fds ? fd : 0;
+  }
+
+  /* Number of regions blended in CFF2 charstrings under vsindex. */
+  inline unsigned int get_region_count (unsigned int vsindex) const
+  {
+    /* ItemVariationStore: format, region list offset, data count and
+     * data offsets; ItemVariationData: item count, short delta count,
+     * region index count, ... */
+    const uint8_t *p = this->vstore;
+    const uint8_t *end = this->table_end;
+    if (!p || end - p < 8 || vsindex >= _hb_cff_read (p + 6, 2) ||
+	(unsigned int) (end - p) < 8 + 4 * (vsindex + 1))
+      return 0;
+    unsigned int offset = _hb_cff_read (p + 8 + 4 * vsindex, 4);
+    if (offset > (unsigned int) (end - p) || (unsigned int) (end - p) - offset < 6)
+      return 0;
+    return _hb_cff_read (p + offset + 4, 2);
+  }
+
+  inline bool get_extents (hb_codepoint_t glyph,
+			   hb_glyph_extents_t *extents) const;
+
+  /* Fills sids[] with the string ID of the name of each glyph; 0, the SID
+   * of .notdef, for glyphs the charset does not cover. */
+  inline void get_glyph_sids (uint16_t *sids) const
+  {
+    unsigned int count = this->num_glyphs;
+    memset (sids, 0, count * sizeof (sids[0]));
+    if (!this->has_glyph_names)
+      return;
+
+    if (this->charset_offset == 0)
+    {
+      /* ISOAdobe: glyph i is SID i. */
+      for (unsigned int i = 0; i < count && i <= 228; i++)
+	sids[i] = i;
+      return;
+    }
+
+    const uint8_t *p = this->table + this->charset_offset;
+    const uint8_t *end = this->table_end;
+    if (unlikely (p >= end))
+      return;
+    unsigned int format = *p++;
+    unsigned int glyph = 1;
+    switch (format)
+    {
+      case 0:
+	for (; glyph < count && p + 2 <= end; glyph++, p += 2)
+	  sids[glyph] = _hb_cff_read (p, 2);
+	break;
+      case 1:
+      case 2:
+      {
+	unsigned int left_size = format == 1 ? 1 : 2;
+	while (glyph < count && p + 2 + left_size <= end)
+	{
+	  unsigned int sid = _hb_cff_read (p, 2);
+	  unsigned int left = _hb_cff_read (p + 2, left_size);
+	  p += 2 + left_size;
+	  for (unsigned int i = 0; i <= left && glyph < count; i++)
+	    sids[glyph++] = sid + i;
+	}
+	break;
+      }
+    }
+  }
+
+  inline const char *get_string (unsigned int sid, unsigned int *len) const
+  {
+    if (sid < HB_OT_CFF_NUM_STANDARD_STRINGS)
+    {
+      const char *s = _hb_ot_cff_standard_strings[sid];
+      *len = strlen (s);
+      return s;
+    }
+    const uint8_t *s;
+    if (!this->string_index.get (sid - HB_OT_CFF_NUM_STANDARD_STRINGS, &s, len))
+      return NULL;
+    return (const char *) s;
+  }
+
+  unsigned int num_glyphs;
+  bool is_cff2;
+  bool has_glyph_names;
+  int charset_offset;
+  CFFIndex string_index;
+  CFFIndex global_subrs;
+  CFFIndex charstrings;
+  unsigned int num_fds;
+  fd_t *fds;
+  const uint8_t *fd_select;
+  const uint8_t *vstore;
+  const uint8_t *table;
+  const uint8_t *table_end;
+  hb_blob_t *blob;
+  mutable hb_extents_cache_t extents_cache;
+};
+
+
+/*
+ * Charstrings
+ *
+ * Only as much of the Type 2 charstring language as it takes to find the
+ * control box of a glyph: hints are skipped, and so are the deprecated
+ * arithmetic operators.  The accent of a seac-style endchar is not drawn.
+ */
+
+#define HB_CFF_MAX_STACK		513	/* CFF2 maxstack; CFF's is 48. */
+#define HB_CFF_MAX_CALL_DEPTH		10
+#define HB_CFF_MAX_OPS			100000	/* Bounds the work of pathological subroutine nesting. */
+
+struct CFFCharStringBounds
+{
+  const CFF_accelerator_t *cff;
+  const CFFIndex *local_subrs;
+  unsigned int vsindex;
+  unsigned int ops_left;
+
+  double stack[HB_CFF_MAX_STACK];
+  unsigned int sp;
+  unsigned int num_stems;
+  bool seen_width;
+  bool done;
+
+  double x, y;
+  bool contour_started;
+  bool empty;
+  double min_x, min_y, max_x, max_y;
+
+  inline void init (const CFF_accelerator_t *cff_,
+		    const CFFIndex *local_subrs_,
+		    unsigned int vsindex_)
+  {
+    this->cff = cff_;
+    this->local_subrs = local_subrs_;
+    this->vsindex = vsindex_;
+    this->ops_left = HB_CFF_MAX_OPS;
+    this->sp = 0;
+    this->num_stems = 0;
+    this->seen_width = cff_->is_cff2; /* CFF2 charstrings have no width. */
+    this->done = false;
+    this->x = this->y = 0;
+    this->contour_started = false;
+    this->empty = true;
+    this->min_x = this->min_y = this->max_x = this->max_y = 0;
+  }
+
+  inline void add_point (double px, double py)
+  {
+    if (this->empty)
+    {
+      this->min_x = this->max_x = px;
+      this->min_y = this->max_y = py;
+      this->empty = false;
+      return;
+    }
+    this->min_x = MIN (this->min_x, px);
+    this->max_x = MAX (this->max_x, px);
+    this->min_y = MIN (this->min_y, py);
+    this->max_y = MAX (this->max_y, py);
+  }
+
+  /* Like FreeType, only count the point moved to once something is drawn
+   * from it. */
+  inline void move_to (double dx, double dy)
+  {
+    this->x += dx;
+    this->y += dy;
+    this->contour_started = false;
+  }
+  inline void start_contour (void)
+  {
+    if (!this->contour_started)
+    {
+      add_point (this->x, this->y);
+      this->contour_started = true;
+    }
+  }
+  inline void line_to (double dx, double dy)
+  {
+    start_contour ();
+    this->x += dx;
+    this->y += dy;
+    add_point (this->x, this->y);
+  }
+  inline void curve_to (double dx1, double dy1,
+			double dx2, double dy2,
+			double dx3, double dy3)
+  {
+    start_contour ();
+    this->x += dx1; this->y += dy1; add_point (this->x, this->y);
+    this->x += dx2; this->y += dy2; add_point (this->x, this->y);
+    this->x += dx3; this->y += dy3; add_point (this->x, this->y);
+  }
+
+  /* In CFF, the first stack-clearing operator may carry the advance width
+   * as an extra first argument; drop it. */
+  inline void skip_width (bool has_width)
+  {
+    if (!this->seen_width && has_width && this->sp)
+    {
+      memmove (this->stack, this->stack + 1, (this->sp - 1) * sizeof (this->stack[0]));
+      this->sp--;
+    }
+    this->seen_width = true;
+  }
+
+  inline bool run (const uint8_t *p, const uint8_t *end, unsigned int depth);
+};
+
+
+inline bool
+CFFCharStringBounds::run (const uint8_t *p, const uint8_t *end, unsigned int depth)
+{
+  double *s = this->stack;
+  while (p < end && !this->done)
+  {
+    if (unlikely (!this->ops_left--))
+      return false;
+
+    unsigned int b0 = *p++;
+
+    /* Operands. */
+    if (b0 >= 32 || b0 == 28)
+    {
+      double v;
+      if (b0 <= 246 && b0 != 28)
+	v = (int) b0 - 139;
+      else if (b0 == 28)
+      {
+	if (unlikely (end - p < 2))
+	  return false;
+	v = (int16_t) _hb_cff_read (p, 2);
+	p += 2;
+      }
+      else if (b0 <= 254)
+      {
+	if (unlikely (p >= end))
+	  return false;
+	if (b0 < 251)
+	  v = ((int) (b0 - 247) << 8) + *p++ + 108;
+	else
+	  v = -((int) (b0 - 251) << 8) - *p++ - 108;
+      }
+      else
+      {
+	/* 16.16 fixed. */
+	if (unlikely (end - p < 4))
+	  return false;
+	v = (int32_t) _hb_cff_read (p, 4) / 65536.;
+	p += 4;
+      }
+      if (unlikely (this->sp >= HB_CFF_MAX_STACK))
+	return false;
+      s[this->sp++] = v;
+      continue;
+    }
+
+    /* Operators. */
+    unsigned int n = this->sp;
+    switch (b0)
+    {
+      case 1:  /* hstem */
+      case 3:  /* vstem */
+      case 18: /* hstemhm */
+      case 23: /* vstemhm */
+	skip_width (this->sp & 1);
+	this->num_stems += this->sp / 2;
+	break;
+
+      case 19: /* hintmask */
+      case 20: /* cntrmask */
+	/* Any arguments are an implied vstem. */
+	skip_width (this->sp & 1);
+	this->num_stems += this->sp / 2;
+	if (unlikely ((unsigned int) (end - p) < (this->num_stems + 7) / 8))
+	  return false;
+	p += (this->num_stems + 7) / 8;
+	break;
+
+      case 21: /* rmoveto */
+	skip_width (n > 2);
+	if (this->sp >= 2)
+	  move_to (s[this->sp - 2], s[this->sp - 1]);
+	break;
+      case 22: /* hmoveto */
+	skip_width (n > 1);
+	if (this->sp >= 1)
+	  move_to (s[this->sp - 1], 0);
+	break;
+      case 4:  /* vmoveto */
+	skip_width (n > 1);
+	if (this->sp >= 1)
+	  move_to (0, s[this->sp - 1]);
+	break;
+
+      case 5:  /* rlineto */
+	for (unsigned int i = 0; i + 2 <= n; i += 2)
+	  line_to (s[i], s[i + 1]);
+	break;
+      case 6:  /* hlineto */
+      case 7:  /* vlineto */
+      {
+	bool horizontal = b0 == 6;
+	for (unsigned int i = 0; i < n; i++, horizontal = !horizontal)
+	  if (horizontal)
+	    line_to (s[i], 0);
+	  else
+	    line_to (0, s[i]);
+	break;
+      }
+
+      case 8:  /* rrcurveto */
+	for (unsigned int i = 0; i + 6 <= n; i += 6)
+	  curve_to (s[i], s[i + 1], s[i + 2], s[i + 3], s[i + 4], s[i + 5]);
+	break;
+      case 24: /* rcurveline */
+      {
+	unsigned int i = 0;
+	for (; i + 8 <= n; i += 6)
+	  curve_to (s[i], s[i + 1], s[i + 2], s[i + 3], s[i + 4], s[i + 5]);
+	if (i + 2 <= n)
+	  line_to (s[i], s[i + 1]);
+	break;
+      }
+      case 25: /* rlinecurve */
+      {
+	unsigned int i = 0;
+	for (; i + 8 <= n; i += 2)
+	  line_to (s[i], s[i + 1]);
+	if (i + 6 <= n)
+	  curve_to (s[i], s[i + 1], s[i + 2], s[i + 3], s[i + 4], s[i + 5]);
+	break;
+      }
+      case 26: /* vvcurveto */
+      case 27: /* hhcurveto */
+      {
+	unsigned int i = 0;
+	double d1 = 0;
+	if (n & 1)
+	  d1 = s[i++];
+	for (; i + 4 <= n; i += 4, d1 = 0)
+	  if (b0 == 26)
+	    curve_to (d1, s[i], s[i + 1], s[i + 2], 0, s[i + 3]);
+	  else
+	    curve_to (s[i], d1, s[i + 1], s[i + 2], s[i + 3], 0);
+	break;
+      }
+      case 30: /* vhcurveto */
+      case 31: /* hvcurveto */
+      {
+	bool horizontal = b0 == 31;
+	for (unsigned int i = 0; i + 4 <= n; i += 4, horizontal = !horizontal)
+	{
+	  /* The last curve may end with an extra, perpendicular, delta. */
+	  double df = n - i == 5 ? s[i + 4] : 0;
+	  if (horizontal)
+	    curve_to (s[i], 0, s[i + 1], s[i + 2], df, s[i + 3]);
+	  else
+	    curve_to (0, s[i], s[i + 1], s[i + 2], s[i + 3], df);
+	}
+	break;
+      }
+
+      case 10: /* callsubr */
+      case 29: /* callgsubr */
+      {
+	const CFFIndex *subrs = b0 == 10 ? this->local_subrs : &this->cff->global_subrs;
+	if (unlikely (!n || depth >= HB_CFF_MAX_CALL_DEPTH))
+	  return false;
+	int index = (int) s[--this->sp] + subrs->get_bias ();
+	const uint8_t *subr;
+	unsigned int subr_len;
+	if (unlikely (index < 0 || !subrs->get (index, &subr, &subr_len)))
+	  return false;
+	if (unlikely (!run (subr, subr + subr_len, depth + 1)))
+	  return false;
+	continue; /* Keep the stack. */
+      }
+      case 11: /* return */
+	return true;
+
+      case 14: /* endchar */
+	if (this->cff->is_cff2)
+	  break;
+	skip_width (n == 1 || n == 5);
+	this->done = true;
+	return true;
+
+      case 15: /* vsindex */
+	if (n)
+	  this->vsindex = (unsigned int) s[n - 1];
+	break;
+      case 16: /* blend */
+      {
+	/* n default values, n * regions deltas, n; keep the defaults, as
+	 * there are no variations applied. */
+	if (unlikely (!n))
+	  return false;
+	unsigned int count = (unsigned int) s[n - 1];
+	unsigned int regions = this->cff->get_region_count (this->vsindex);
+	if (unlikely (count > (n - 1) / (regions + 1)))
+	  return false;
+	this->sp = n - 1 - count * regions;
+	continue; /* Keep the defaults on the stack. */
+      }
+
+      case 12: /* escape */
+      {
+	if (unlikely (p >= end))
+	  return false;
+	unsigned int b1 = *p++;
+	switch (b1)
+	{
+	  case 35: /* flex */
+	    if (n >= 12)
+	    {
+	      curve_to (s[0], s[1], s[2], s[3], s[4], s[5]);
+	      curve_to (s[6], s[7], s[8], s[9], s[10], s[11]);
+	    }
+	    break;
+	  case 34: /* hflex */
+	    if (n >= 7)
+	    {
+	      curve_to (s[0], 0, s[1], s[2], s[3], 0);
+	      curve_to (s[4], 0, s[5], -s[2], s[6], 0);
+	    }
+	    break;
+	  case 36: /* hflex1 */
+	    if (n >= 9)
+	    {
+	      curve_to (s[0], s[1], s[2], s[3], s[4], 0);
+	      curve_to (s[5], 0, s[6], s[7], s[8], -(s[1] + s[3] + s[7]));
+	    }
+	    break;
+	  case 37: /* flex1 */
+	    if (n >= 11)
+	    {
+	      double dx = s[0] + s[2] + s[4] + s[6] + s[8];
+	      double dy = s[1] + s[3] + s[5] + s[7] + s[9];
+	      curve_to (s[0], s[1], s[2], s[3], s[4], s[5]);
+	      if ((dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy))
+		curve_to (s[6], s[7], s[8], s[9], s[10], -dy);
+	      else
+		curve_to (s[6], s[7], s[8], s[9], -dx, s[10]);
+	    }
+	    break;
+	}
+	break;
+      }
+    }
+    this->sp = 0;
+  }
+  return true;
+}
+
+
+inline bool
+CFF_accelerator_t::get_extents (hb_codepoint_t glyph,
+				hb_glyph_extents_t *extents) const
+{
+  if (unlikely (glyph >= this->num_glyphs))
+    return false;
+
+  if (this->extents_cache.get (glyph, extents))
+    return true;
+
+  const uint8_t *charstring;
+  unsigned int len;
+  if (!this->charstrings.get (glyph, &charstring, &len))
+    return false;
+
+  const fd_t &fd = this->fds[get_fd (glyph)];
+  CFFCharStringBounds bounds;
+  bounds.init (this, &fd.subrs, fd.vsindex);
+  if (!bounds.run (charstring, charstring + len, 0))
+    return false;
+
+  if (bounds.empty)
+    extents->x_bearing = extents->y_bearing = extents->width = extents->height = 0;
+  else
+  {
+    extents->x_bearing = _hb_cff_floor (bounds.min_x);
+    extents->y_bearing = -_hb_cff_floor (-bounds.max_y);
+    extents->width     = -_hb_cff_floor (-bounds.max_x) - extents->x_bearing;
+    extents->height    = _hb_cff_floor (bounds.min_y) - extents->y_bearing;
+  }
+
+  this->extents_cache.set (glyph, extents);
+  return true;
+}
+
+
+struct CFF
+{
+  static const hb_tag_t tableTag = HB_OT_TAG_CFF;
+
+  typedef CFF_accelerator_t accelerator_t;
+
+  public:
+  BYTE		major;		/* Format major version (starting at 1). */
+  BYTE		minor;		/* Format minor version (starting at 0). */
+  BYTE		hdrSize;	/* Header size (bytes). */
+  BYTE		offSize;	/* Absolute offset (0) size. */
+  public:
+  DEFINE_SIZE_STATIC (4);
+};
+
+} /* namespace OT */
+
+
+#endif /* HB_OT_CFF_TABLE_HH */
@@ -29,13 +29,17 @@
 #include "hb-ot.h"
 
 #include "hb-font-private.hh"
+#include "hb-cache-private.hh"
 
+#include "hb-ot-cff-table.hh"
 #include "hb-ot-cmap-table.hh"
 #include "hb-ot-glyf-table.hh"
 #include "hb-ot-head-table.hh"
 #include "hb-ot-hhea-table.hh"
 #include "hb-ot-hmtx-table.hh"
 #include "hb-ot-os2-table.hh"
+#include "hb-ot-post-table.hh"
+#include "hb-ot-vorg-table.hh"
 
 
 struct hb_ot_face_metrics_accelerator_t
@@ -126,6 +130,18 @@ struct hb_ot_face_metrics_accelerator_t
 
     return this->table->longMetric[glyph].advance;
   }
+
+  inline int get_side_bearing (hb_codepoint_t glyph) const
+  {
+    if (unlikely (glyph >= this->num_metrics))
+      return 0;
+
+    if (glyph < this->num_advances)
+      return this->table->longMetric[glyph].lsb;
+
+    const OT::SHORT *side_bearings = &OT::StructAtOffset<OT::SHORT> (this->table, 4 * this->num_advances);
+    return side_bearings[glyph - this->num_advances];
+  }
 };
 
 struct hb_ot_face_glyf_accelerator_t
@@ -299,6 +315,239 @@ struct hb_ot_face_cmap_accelerator_t
   }
 };
 
+/* Glyph names come from the 'post' table, or for CFF fonts whose 'post'
+ * table has none, from the CFF charset. */
+struct hb_ot_face_names_accelerator_t
+{
+  /* Built on first use: the start of each Pascal string in the 'post'
+   * pool, or the name SID of each CFF glyph; and an open-addressed hash of
+   * glyph names, so that looking a name up does not walk every glyph. */
+  struct index_t
+  {
+    unsigned int num_strings;
+    unsigned int mask;
+    const uint32_t *string_offsets;
+    const uint16_t *sids;
+    const uint16_t *buckets; /* Glyph + 1; 0 is empty. */
+  };
+
+  unsigned int num_glyphs;
+  const OT::ArrayOf<OT::USHORT> *glyph_name_index; /* NULL for version 1.0. */
+  const uint8_t *pool;
+  unsigned int pool_len;
+  const OT::CFF::accelerator_t *cff; /* NULL unless names come from CFF. */
+  hb_blob_t *blob;
+  mutable index_t *index;
+
+  inline void init (hb_face_t *face,
+		    const OT::CFF::accelerator_t *cff)
+  {
+    this->blob = OT::Sanitizer<OT::post>::sanitize (face->reference_table (HB_OT_TAG_post));
+    const OT::post *post = OT::Sanitizer<OT::post>::lock_instance (this->blob);
+
+    if (post->version.major == 1 && post->version.minor == 0)
+      this->num_glyphs = HB_OT_POST_NUM_MAC_GLYPH_NAMES;
+    else if ((this->glyph_name_index = post->get_v2_glyph_name_index ()))
+    {
+      this->num_glyphs = this->glyph_name_index->len;
+      this->pool = (const uint8_t *) &this->glyph_name_index->array[this->num_glyphs];
+      const uint8_t *end = (const uint8_t *) hb_blob_get_data (this->blob, NULL) + hb_blob_get_length (this->blob);
+      this->pool_len = end - this->pool;
+    }
+    else if (cff->has_glyph_names)
+    {
+      this->cff = cff;
+      this->num_glyphs = cff->num_glyphs;
+    }
+  }
+
+  inline void fini (void)
+  {
+    hb_blob_destroy (this->blob);
+    free (this->index);
+  }
+
+  static inline uint32_t hash (const char *name, unsigned int len)
+  {
+    uint32_t h = 2166136261u;
+    for (unsigned int i = 0; i < len; i++)
+      h = (h ^ (uint8_t) name[i]) * 16777619u;
+    return h;
+  }
+
+  inline const char *get_name (const index_t *index,
+			       hb_codepoint_t glyph,
+			       unsigned int *len) const
+  {
+    if (unlikely (glyph >= this->num_glyphs))
+      return NULL;
+
+    if (this->cff)
+      return this->cff->get_string (index->sids[glyph], len);
+
+    const char *name;
+    unsigned int name_index = this->glyph_name_index ? (unsigned int) this->glyph_name_index->array[glyph] : glyph;
+    if (name_index < HB_OT_POST_NUM_MAC_GLYPH_NAMES)
+    {
+      name = OT::_hb_ot_post_mac_glyph_names[name_index];
+      *len = strlen (name);
+      return name;
+    }
+
+    name_index -= HB_OT_POST_NUM_MAC_GLYPH_NAMES;
+    if (unlikely (name_index >= index->num_strings))
+      return NULL;
+    unsigned int offset = index->string_offsets[name_index];
+    *len = this->pool[offset];
+    return (const char *) this->pool + offset + 1;
+  }
+
+  inline const index_t *get_index (void) const
+  {
+  retry:
+    index_t *index = (index_t *) hb_atomic_ptr_get (&this->index);
+
+    if (unlikely (!index))
+    {
+      unsigned int max_name_index = 0;
+      if (this->glyph_name_index)
+	for (unsigned int i = 0; i < this->num_glyphs; i++)
+	  max_name_index = MAX (max_name_index, (unsigned int) this->glyph_name_index->array[i]);
+      unsigned int num_strings = max_name_index < HB_OT_POST_NUM_MAC_GLYPH_NAMES ?
+				 0 : max_name_index - HB_OT_POST_NUM_MAC_GLYPH_NAMES + 1;
+      unsigned int num_buckets = 8;
+      while (num_buckets < 2 * this->num_glyphs)
+	num_buckets <<= 1;
+
+      unsigned int num_sids = this->cff ? this->num_glyphs : 0;
+
+      index = (index_t *) calloc (1, sizeof (index_t) +
+				     num_strings * sizeof (uint32_t) +
+				     num_buckets * sizeof (uint16_t) +
+				     num_sids * sizeof (uint16_t));
+      if (unlikely (!index))
+	return NULL;
+
+      uint32_t *string_offsets = (uint32_t *) (index + 1);
+      uint16_t *buckets = (uint16_t *) (string_offsets + num_strings);
+      index->mask = num_buckets - 1;
+      index->string_offsets = string_offsets;
+      index->buckets = buckets;
+      if (this->cff)
+      {
+	uint16_t *sids = buckets + num_buckets;
+	this->cff->get_glyph_sids (sids);
+	index->sids = sids;
+      }
+
+      /* Strings running past the end of the table are dropped, and so
+       * are the names of glyphs referring to them. */
+      unsigned int offset = 0;
+      while (index->num_strings < num_strings &&
+	     offset < this->pool_len &&
+	     offset + 1 + this->pool[offset] <= this->pool_len)
+      {
+	string_offsets[index->num_strings++] = offset;
+	offset += 1 + this->pool[offset];
+      }
+
+      /* Insert in glyph order, skipping duplicate names, so the first
+       * glyph with a name wins. */
+      for (unsigned int glyph = 0; glyph < this->num_glyphs; glyph++)
+      {
+	unsigned int len;
+	const char *name = get_name (index, glyph, &len);
+	if (!name)
+	  continue;
+	unsigned int i = hash (name, len) & index->mask;
+	for (; buckets[i]; i = (i + 1) & index->mask)
+	{
+	  unsigned int other_len;
+	  const char *other = get_name (index, buckets[i] - 1, &other_len);
+	  if (other_len == len && 0 == memcmp (other, name, len))
+	    break;
+	}
+	if (!buckets[i])
+	  buckets[i] = glyph + 1;
+      }
+
+      if (!hb_atomic_ptr_cmpexch (&this->index, NULL, index)) {
+	free (index);
+	goto retry;
+      }
+    }
+
+    return index;
+  }
+
+  inline bool get_glyph_name (hb_codepoint_t glyph,
+			      char *name, unsigned int size) const
+  {
+    const index_t *index = get_index ();
+    if (unlikely (!index))
+      return false;
+
+    unsigned int len;
+    const char *s = get_name (index, glyph, &len);
+    if (!s || !len)
+      return false;
+
+    if (size)
+    {
+      len = MIN (len, size - 1);
+      memcpy (name, s, len);
+      name[len] = '\0';
+    }
+    return true;
+  }
+
+  inline bool get_glyph_from_name (const char *name, int len,
+				   hb_codepoint_t *glyph) const
+  {
+    const index_t *index = get_index ();
+    if (unlikely (!index))
+      return false;
+
+    if (len < 0)
+      len = strlen (name);
+
+    for (unsigned int i = hash (name, len) & index->mask; index->buckets[i]; i = (i + 1) & index->mask)
+    {
+      unsigned int other_len;
+      const char *other = get_name (index, index->buckets[i] - 1, &other_len);
+      if (other_len == (unsigned int) len && 0 == memcmp (other, name, len))
+      {
+	*glyph = index->buckets[i] - 1;
+	return true;
+      }
+    }
+    return false;
+  }
+};
+
+
+struct hb_ot_face_vorg_accelerator_t
+{
+  const OT::VORG *table;
+  hb_blob_t *blob;
+
+  inline void init (hb_face_t *face)
+  {
+    this->blob = OT::Sanitizer<OT::VORG>::sanitize (face->reference_table (HB_OT_TAG_VORG));
+    this->table = OT::Sanitizer<OT::VORG>::lock_instance (this->blob);
+  }
+
+  inline void fini (void)
+  {
+    hb_blob_destroy (this->blob);
+  }
+
+  inline bool has_data (void) const
+  {
+    return hb_blob_get_length (this->blob) != 0;
+  }
+};
+
 
 struct hb_ot_font_t
 {
@@ -306,6 +555,35 @@ struct hb_ot_font_t
   hb_ot_face_metrics_accelerator_t h_metrics;
   hb_ot_face_metrics_accelerator_t v_metrics;
   hb_ot_face_glyf_accelerator_t glyf;
+  OT::CFF::accelerator_t cff;
+  hb_ot_face_names_accelerator_t names;
+  hb_ot_face_vorg_accelerator_t vorg;
+  mutable hb_advance_cache_t v_origins;
+
+  /* The vertical origin comes from 'VORG' if present, or else lies the
+   * top side bearing above the top of the glyph.  Without 'vmtx', use the
+   * ascender.  Results are cached, as the latter needs glyph extents. */
+  inline int get_v_origin_y (hb_codepoint_t glyph) const
+  {
+    unsigned int v;
+    if (this->v_origins.get (glyph, &v))
+      return v;
+
+    int y;
+    hb_glyph_extents_t extents = {0, 0, 0, 0};
+    if (this->vorg.has_data ())
+      y = this->vorg.table->get_y_origin (glyph);
+    else if (this->v_metrics.num_metrics &&
+	     (this->glyf.get_extents (glyph, &extents) ||
+	      this->cff.get_extents (glyph, &extents)))
+      y = extents.y_bearing + this->v_metrics.get_side_bearing (glyph);
+    else
+      y = this->h_metrics.ascender;
+
+    /* Negative origins don't fit the cache; they are rare. */
+    this->v_origins.set (glyph, y);
+    return y;
+  }
 };
 
 
@@ -321,6 +599,10 @@ _hb_ot_font_create (hb_face_t *face)
   ot_font->h_metrics.init (face, HB_OT_TAG_hhea, HB_OT_TAG_hmtx, HB_OT_TAG_os2);
   ot_font->v_metrics.init (face, HB_OT_TAG_vhea, HB_OT_TAG_vmtx, HB_TAG_NONE); /* TODO Can we do this lazily? */
   ot_font->glyf.init (face);
+  ot_font->cff.init (face);
+  ot_font->names.init (face, &ot_font->cff);
+  ot_font->vorg.init (face);
+  ot_font->v_origins.clear ();
 
   return ot_font;
 }
@@ -332,6 +614,9 @@ _hb_ot_font_destroy (hb_ot_font_t *ot_font)
   ot_font->h_metrics.fini ();
   ot_font->v_metrics.fini ();
   ot_font->glyf.fini ();
+  ot_font->cff.fini ();
+  ot_font->names.fini ();
+  ot_font->vorg.fini ();
 
   free (ot_font);
 }
@@ -381,6 +666,20 @@ hb_ot_get_glyph_v_advance (hb_font_t *font HB_UNUSED,
   return font->em_scale_y (-(int) ot_font->v_metrics.get_advance (glyph));
 }
 
+static hb_bool_t
+hb_ot_get_glyph_v_origin (hb_font_t *font HB_UNUSED,
+			  void *font_data,
+			  hb_codepoint_t glyph,
+			  hb_position_t *x,
+			  hb_position_t *y,
+			  void *user_data HB_UNUSED)
+{
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  *x = font->em_scale_x (ot_font->h_metrics.get_advance (glyph) / 2);
+  *y = font->em_scale_y (ot_font->get_v_origin_y (glyph));
+  return true;
+}
+
 static hb_bool_t
 hb_ot_get_glyph_extents (hb_font_t *font HB_UNUSED,
 			 void *font_data,
@@ -389,7 +688,8 @@ hb_ot_get_glyph_extents (hb_font_t *font HB_UNUSED,
 			 void *user_data HB_UNUSED)
 {
   const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
-  bool ret = ot_font->glyf.get_extents (glyph, extents);
+  bool ret = ot_font->glyf.get_extents (glyph, extents) ||
+	     ot_font->cff.get_extents (glyph, extents);
   extents->x_bearing = font->em_scale_x (extents->x_bearing);
   extents->y_bearing = font->em_scale_y (extents->y_bearing);
   extents->width     = font->em_scale_x (extents->width);
@@ -397,6 +697,28 @@ hb_ot_get_glyph_extents (hb_font_t *font HB_UNUSED,
   return ret;
 }
 
+static hb_bool_t
+hb_ot_get_glyph_name (hb_font_t *font HB_UNUSED,
+		      void *font_data,
+		      hb_codepoint_t glyph,
+		      char *name, unsigned int size,
+		      void *user_data HB_UNUSED)
+{
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  return ot_font->names.get_glyph_name (glyph, name, size);
+}
+
+static hb_bool_t
+hb_ot_get_glyph_from_name (hb_font_t *font HB_UNUSED,
+			   void *font_data,
+			   const char *name, int len, /* -1 means nul-terminated */
+			   hb_codepoint_t *glyph,
+			   void *user_data HB_UNUSED)
+{
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  return ot_font->names.get_glyph_from_name (name, len, glyph);
+}
+
 static hb_bool_t
 hb_ot_get_font_h_extents (hb_font_t *font HB_UNUSED,
 			  void *font_data,
@@ -450,13 +772,13 @@ retry:
     hb_font_funcs_set_glyph_h_advance_func (funcs, hb_ot_get_glyph_h_advance, NULL, NULL);
     hb_font_funcs_set_glyph_v_advance_func (funcs, hb_ot_get_glyph_v_advance, NULL, NULL);
     //hb_font_funcs_set_glyph_h_origin_func (funcs, hb_ot_get_glyph_h_origin, NULL, NULL);
-    //hb_font_funcs_set_glyph_v_origin_func (funcs, hb_ot_get_glyph_v_origin, NULL, NULL);
+    hb_font_funcs_set_glyph_v_origin_func (funcs, hb_ot_get_glyph_v_origin, NULL, NULL);
     //hb_font_funcs_set_glyph_h_kerning_func (funcs, hb_ot_get_glyph_h_kerning, NULL, NULL); TODO
     //hb_font_funcs_set_glyph_v_kerning_func (funcs, hb_ot_get_glyph_v_kerning, NULL, NULL);
     hb_font_funcs_set_glyph_extents_func (funcs, hb_ot_get_glyph_extents, NULL, NULL);
     //hb_font_funcs_set_glyph_contour_point_func (funcs, hb_ot_get_glyph_contour_point, NULL, NULL); TODO
-    //hb_font_funcs_set_glyph_name_func (funcs, hb_ot_get_glyph_name, NULL, NULL); TODO
-    //hb_font_funcs_set_glyph_from_name_func (funcs, hb_ot_get_glyph_from_name, NULL, NULL); TODO
+    hb_font_funcs_set_glyph_name_func (funcs, hb_ot_get_glyph_name, NULL, NULL);
+    hb_font_funcs_set_glyph_from_name_func (funcs, hb_ot_get_glyph_from_name, NULL, NULL);
 
     hb_font_funcs_make_immutable (funcs);
 
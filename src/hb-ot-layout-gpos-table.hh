@@ -431,6 +431,8 @@ struct MarkArray : ArrayOf<MarkRecord>	/* Array of MarkRecords--in Coverage orde
     mark_anchor.get_anchor (c->font, buffer->cur().codepoint, &mark_x, &mark_y);
     glyph_anchor.get_anchor (c->font, buffer->info[glyph_pos].codepoint, &base_x, &base_y);
 
+    buffer->unsafe_to_break (glyph_pos, buffer->idx + 1);
+
     hb_glyph_position_t &o = buffer->cur_pos();
     o.x_offset = base_x - mark_x;
     o.y_offset = base_y - mark_y;
@@ -640,6 +642,7 @@ struct PairSet
         min = mid + 1;
       else
       {
+	buffer->unsafe_to_break (buffer->idx, pos + 1);
 	valueFormats[0].apply_value (c->font, c->direction, this,
 				     &record->values[0], buffer->cur_pos());
 	valueFormats[1].apply_value (c->font, c->direction, this,
@@ -789,6 +792,7 @@ struct PairPosFormat2
     unsigned int klass2 = (this+classDef2).get_class (buffer->info[skippy_iter.idx].codepoint);
     if (unlikely (klass1 >= class1Count || klass2 >= class2Count)) return_trace (false);
 
+    buffer->unsafe_to_break (buffer->idx, skippy_iter.idx + 1);
     const Value *v = &values[record_len * (klass1 * class2Count + klass2)];
     valueFormat1.apply_value (c->font, c->direction, this,
 			      v, buffer->cur_pos());
@@ -930,6 +934,8 @@ struct CursivePosFormat1
     unsigned int i = buffer->idx;
     unsigned int j = skippy_iter.idx;
 
+    buffer->unsafe_to_break (i, j + 1);
+
     hb_position_t entry_x, entry_y, exit_x, exit_y;
     (this+this_record.exitAnchor).get_anchor (c->font, buffer->info[i].codepoint, &exit_x, &exit_y);
     (this+next_record.entryAnchor).get_anchor (c->font, buffer->info[j].codepoint, &entry_x, &entry_y);
@@ -1638,11 +1644,15 @@ template <typename context_t>
   const PosLookup &l = gpos.get_lookup (lookup_index);
   unsigned int saved_lookup_props = c->lookup_props;
   unsigned int saved_lookup_index = c->lookup_index;
+  const hb_ot_layout_lookup_accelerator_t *saved_lookup_accel = c->lookup_accel;
   c->set_lookup_index (lookup_index);
   c->set_lookup_props (l.get_props ());
-  bool ret = l.dispatch (c);
+  c->set_lookup_accel (likely (lookup_index < hb_ot_layout_from_face (c->face)->gpos_lookup_count) ?
+		       &hb_ot_layout_from_face (c->face)->gpos_accels[lookup_index] : NULL);
+  bool ret = c->apply_subtables (l);
   c->set_lookup_index (saved_lookup_index);
   c->set_lookup_props (saved_lookup_props);
+  c->set_lookup_accel (saved_lookup_accel);
   return ret;
 }
 
@@ -577,6 +577,8 @@ struct AlternateSubst
 };
 
 
+struct LigatureTrie;
+
 struct Ligature
 {
   inline void closure (hb_closure_context_t *c) const
@@ -653,6 +655,44 @@ struct Ligature
     return_trace (true);
   }
 
+  /* Same as apply(), for when the components were already matched at
+   * match_positions, eg. by LigatureTrie::match(). */
+  inline bool apply_matched (hb_apply_context_t *c,
+			     unsigned int match_positions[HB_MAX_CONTEXT_LENGTH]) const
+  {
+    TRACE_APPLY (this);
+    unsigned int count = component.len;
+
+    if (unlikely (count == 1))
+    {
+      c->replace_glyph (ligGlyph);
+      return_trace (true);
+    }
+
+    hb_buffer_t *buffer = c->buffer;
+    bool is_mark_ligature = true;
+    unsigned int total_component_count = 0;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      const hb_glyph_info_t *info = &buffer->info[match_positions[i]];
+      is_mark_ligature = is_mark_ligature && _hb_glyph_info_is_mark (info);
+      total_component_count += _hb_glyph_info_get_lig_num_comps (info);
+    }
+
+    ligate_input (c,
+		  count,
+		  match_positions,
+		  match_positions[count - 1] - buffer->idx + 1,
+		  ligGlyph,
+		  is_mark_ligature,
+		  total_component_count);
+
+    return_trace (true);
+  }
+
+  inline unsigned int get_component_count (void) const { return component.len; }
+  inline hb_codepoint_t get_component (unsigned int i) const { return component[i]; }
+
   inline bool serialize (hb_serialize_context_t *c,
 			 GlyphID ligature,
 			 Supplier<GlyphID> &components, /* Starting from second */
@@ -726,6 +766,11 @@ struct LigatureSet
     return_trace (false);
   }
 
+  inline bool apply (hb_apply_context_t *c, const LigatureTrie &trie) const;
+
+  inline unsigned int get_ligature_count (void) const { return ligature.len; }
+  inline const Ligature &get_ligature (unsigned int i) const { return this+ligature[i]; }
+
   inline bool serialize (hb_serialize_context_t *c,
 			 Supplier<GlyphID> &ligatures,
 			 Supplier<unsigned int> &component_count_list,
@@ -759,6 +804,263 @@ struct LigatureSet
   DEFINE_SIZE_ARRAY (2, ligature);
 };
 
+/* A trie over the component glyphs of the Ligatures of a LigatureSet.
+ * Matching walks the buffer once for all the Ligatures of the set, instead
+ * of once per Ligature, while still picking the first matching Ligature in
+ * the order of the font.  Not a font table; built from one at runtime. */
+struct LigatureTrie
+{
+  static const unsigned int NOT_FOUND = (unsigned int) -1;
+
+  struct node_t
+  {
+    hb_codepoint_t glyph;	/* Component glyph leading to this node. */
+    unsigned int lig_index;	/* Ligature ending at this node, or NOT_FOUND. */
+    unsigned int min_lig_index;	/* Smallest Ligature index in the subtree. */
+    unsigned int first_child;	/* Children are contiguous, sorted by glyph. */
+    unsigned int num_children;
+  };
+
+  static inline LigatureTrie *create (const LigatureSet &lig_set)
+  {
+    hb_auto_array_t<node_t> nodes;
+    hb_auto_array_t<entry_t> entries;
+
+    unsigned int num_ligs = lig_set.get_ligature_count ();
+    for (unsigned int i = 0; i < num_ligs; i++)
+    {
+      unsigned int count = lig_set.get_ligature (i).get_component_count ();
+      /* Ligature::apply() never matches these. */
+      if (unlikely (!count || count > HB_MAX_CONTEXT_LENGTH))
+	continue;
+      entry_t *entry = entries.push ();
+      if (unlikely (!entry))
+	return NULL;
+      entry->lig_index = i;
+    }
+
+    node_t *root = nodes.push ();
+    if (unlikely (!root))
+      return NULL;
+    root->glyph = 0;
+    if (unlikely (!build (lig_set, nodes, 0, entries.array, entries.len, 1)))
+      return NULL;
+
+    LigatureTrie *trie = (LigatureTrie *) malloc (sizeof (LigatureTrie) + (nodes.len - 1) * sizeof (node_t));
+    if (unlikely (!trie))
+      return NULL;
+    trie->num_nodes = nodes.len;
+    memcpy (trie->nodes, nodes.array, nodes.len * sizeof (node_t));
+    return trie;
+  }
+
+  inline void destroy (void) { free (this); }
+
+  /* Returns the index of the first Ligature of the set that matches at the
+   * current buffer position, filling in its match_positions, or NOT_FOUND.
+   * Same semantics as trying Ligature::apply() on each in order. */
+  inline unsigned int match (hb_apply_context_t *c,
+			     unsigned int match_positions[HB_MAX_CONTEXT_LENGTH]) const
+  {
+    walk_t w (c, this, match_positions);
+    w.walk (0, c->buffer->idx, 1);
+    return w.best;
+  }
+
+  private:
+  struct entry_t
+  {
+    hb_codepoint_t glyph;
+    unsigned int lig_index;
+
+    static int cmp (const entry_t *a, const entry_t *b)
+    {
+      if (a->glyph != b->glyph) return a->glyph < b->glyph ? -1 : 1;
+      return a->lig_index < b->lig_index ? -1 : a->lig_index > b->lig_index ? 1 : 0;
+    }
+  };
+
+  /* Fills in nodes[node_index] and its subtree from the entries of the
+   * Ligatures whose first depth components lead to it. */
+  static inline bool build (const LigatureSet &lig_set,
+			    hb_prealloced_array_t<node_t> &nodes,
+			    unsigned int node_index,
+			    entry_t *entries,
+			    unsigned int count,
+			    unsigned int depth)
+  {
+    unsigned int lig_index = NOT_FOUND;
+    unsigned int min_lig_index = NOT_FOUND;
+    unsigned int longer = 0;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      const Ligature &lig = lig_set.get_ligature (entries[i].lig_index);
+      min_lig_index = MIN (min_lig_index, entries[i].lig_index);
+      if (lig.get_component_count () == depth)
+	lig_index = MIN (lig_index, entries[i].lig_index);
+      else
+      {
+	entries[longer].lig_index = entries[i].lig_index;
+	entries[longer].glyph = lig.get_component (depth);
+	longer++;
+      }
+    }
+    ::qsort (entries, longer, sizeof (entry_t), (hb_compare_func_t) entry_t::cmp);
+
+    unsigned int num_children = 0;
+    for (unsigned int i = 0; i < longer; i++)
+      if (!i || entries[i].glyph != entries[i - 1].glyph)
+	num_children++;
+
+    unsigned int first_child = nodes.len;
+    for (unsigned int i = 0; i < num_children; i++)
+      if (unlikely (!nodes.push ()))
+	return false;
+
+    nodes[node_index].lig_index = lig_index;
+    nodes[node_index].min_lig_index = min_lig_index;
+    nodes[node_index].first_child = first_child;
+    nodes[node_index].num_children = num_children;
+
+    for (unsigned int i = 0, child = first_child; i < longer; child++)
+    {
+      unsigned int end = i + 1;
+      while (end < longer && entries[end].glyph == entries[i].glyph)
+	end++;
+      nodes[child].glyph = entries[i].glyph;
+      if (unlikely (!build (lig_set, nodes, child, entries + i, end - i, depth + 1)))
+	return false;
+      i = end;
+    }
+    return true;
+  }
+
+  inline const node_t *find_child (const node_t &node, hb_codepoint_t glyph) const
+  {
+    int min = 0, max = (int) node.num_children - 1;
+    const node_t *children = nodes + node.first_child;
+    while (min <= max)
+    {
+      int mid = (min + max) / 2;
+      if (glyph < children[mid].glyph)
+	max = mid - 1;
+      else if (glyph > children[mid].glyph)
+	min = mid + 1;
+      else
+	return &children[mid];
+    }
+    return NULL;
+  }
+
+  struct walk_t
+  {
+    inline walk_t (hb_apply_context_t *c_,
+		   const LigatureTrie *trie_,
+		   unsigned int *best_positions_) :
+		   c (c_),
+		   buffer (c_->buffer),
+		   trie (trie_),
+		   best (trie_->nodes[0].lig_index),
+		   best_positions (best_positions_),
+		   first_lig_id (_hb_glyph_info_get_lig_id (&c_->buffer->cur())),
+		   first_lig_comp (_hb_glyph_info_get_lig_comp (&c_->buffer->cur()))
+    {
+      /* Same setup as c->iter_input. */
+      matcher.set_lookup_props (c->lookup_props);
+      matcher.set_ignore_zwnj (c->table_index == 1);
+      matcher.set_ignore_zwj (c->table_index == 1 || c->auto_zwj);
+      matcher.set_mask (c->lookup_mask);
+      matcher.set_syllable (buffer->cur().syllable ());
+      positions[0] = best_positions[0] = buffer->idx;
+    }
+
+    /* Ligature-component attachment rules of match_input(). */
+    inline bool component_ok (const hb_glyph_info_t &info) const
+    {
+      unsigned int this_lig_id = _hb_glyph_info_get_lig_id (&info);
+      unsigned int this_lig_comp = _hb_glyph_info_get_lig_comp (&info);
+      if (first_lig_id && first_lig_comp)
+	return first_lig_id == this_lig_id && first_lig_comp == this_lig_comp;
+      return !(this_lig_id && this_lig_comp && this_lig_id != first_lig_id);
+    }
+
+    /* Whether an earlier default-ignorable glyph between from and to had
+     * the same glyph, in which case the Ligatures under that child consumed
+     * it there, and do not get to skip it. */
+    inline bool matched_earlier (unsigned int from, unsigned int to, hb_codepoint_t glyph) const
+    {
+      for (unsigned int j = from + 1; j < to; j++)
+      {
+	const hb_glyph_info_t &info = buffer->info[j];
+	if (info.codepoint == glyph &&
+	    matcher.may_skip (c, info) == hb_apply_context_t::matcher_t::SKIP_MAYBE &&
+	    matcher.may_match (info, NULL) != hb_apply_context_t::matcher_t::MATCH_NO)
+	  return true;
+      }
+      return false;
+    }
+
+    inline void walk (unsigned int node_index, unsigned int idx, unsigned int depth)
+    {
+      const node_t &node = trie->nodes[node_index];
+      bool skipped_maybe = false;
+      unsigned int count = buffer->len;
+      for (unsigned int j = idx + 1; j < count && node.min_lig_index < best; j++)
+      {
+	const hb_glyph_info_t &info = buffer->info[j];
+
+	hb_apply_context_t::matcher_t::may_skip_t skip = matcher.may_skip (c, info);
+	if (unlikely (skip == hb_apply_context_t::matcher_t::SKIP_YES))
+	  continue;
+
+	const node_t *child = NULL;
+	if (matcher.may_match (info, NULL) != hb_apply_context_t::matcher_t::MATCH_NO)
+	  child = trie->find_child (node, info.codepoint);
+	if (child && child->min_lig_index < best &&
+	    !(skipped_maybe && matched_earlier (idx, j, info.codepoint)) &&
+	    component_ok (info))
+	{
+	  positions[depth] = j;
+	  if (child->lig_index < best)
+	  {
+	    best = child->lig_index;
+	    memcpy (best_positions, positions, (depth + 1) * sizeof (positions[0]));
+	  }
+	  if (child->num_children)
+	    walk (child - trie->nodes, j, depth + 1);
+	}
+
+	if (skip == hb_apply_context_t::matcher_t::SKIP_NO)
+	  return;
+	skipped_maybe = true;
+      }
+    }
+
+    hb_apply_context_t *c;
+    hb_buffer_t *buffer;
+    const LigatureTrie *trie;
+    hb_apply_context_t::matcher_t matcher;
+    unsigned int best;
+    unsigned int *best_positions;
+    unsigned int positions[HB_MAX_CONTEXT_LENGTH];
+    unsigned int first_lig_id;
+    unsigned int first_lig_comp;
+  };
+
+  unsigned int num_nodes;
+  node_t nodes[VAR];
+};
+
+inline bool LigatureSet::apply (hb_apply_context_t *c, const LigatureTrie &trie) const
+{
+  TRACE_APPLY (this);
+  unsigned int match_positions[HB_MAX_CONTEXT_LENGTH];
+  unsigned int lig_index = trie.match (c, match_positions);
+  if (lig_index == LigatureTrie::NOT_FOUND)
+    return_trace (false);
+  return_trace (get_ligature (lig_index).apply_matched (c, match_positions));
+}
+
 struct LigatureSubstFormat1
 {
   inline void closure (hb_closure_context_t *c) const
@@ -805,9 +1107,73 @@ struct LigatureSubstFormat1
     if (likely (index == NOT_COVERED)) return_trace (false);
 
     const LigatureSet &lig_set = this+ligatureSet[index];
+    const LigatureTrie *trie = get_trie (c, index);
+    if (trie)
+      return_trace (lig_set.apply (c, *trie));
     return_trace (lig_set.apply (c));
   }
 
+  /* Per-lookup cache of the tries of this subtable. */
+  struct cache_t
+  {
+    hb_ot_layout_subtable_cache_t header;
+    unsigned int num_sets;
+    LigatureTrie *tries[VAR]; /* One per LigatureSet; NULL until built. */
+
+    static void destroy (hb_ot_layout_subtable_cache_t *header)
+    {
+      cache_t *cache = (cache_t *) header;
+      for (unsigned int i = 0; i < cache->num_sets; i++)
+	if (cache->tries[i])
+	  cache->tries[i]->destroy ();
+      free (cache);
+    }
+  };
+
+  /* Returns the trie for the index'th LigatureSet, building it on first
+   * use, or NULL if the set is too small to benefit or on failure. */
+  inline const LigatureTrie *get_trie (hb_apply_context_t *c, unsigned int index) const
+  {
+    const hb_ot_layout_lookup_accelerator_t *accel = c->lookup_accel;
+    if (!accel || unlikely (index >= ligatureSet.len))
+      return NULL;
+    const LigatureSet &lig_set = this+ligatureSet[index];
+    if (lig_set.get_ligature_count () < 2)
+      return NULL;
+
+    hb_ot_layout_subtable_cache_t *header = accel->get_cache (c->subtable_index);
+    if (unlikely (!header))
+    {
+      unsigned int num_sets = ligatureSet.len;
+      cache_t *new_cache = (cache_t *) calloc (1, sizeof (cache_t) + (num_sets - 1) * sizeof (new_cache->tries[0]));
+      if (likely (new_cache))
+      {
+	new_cache->header.destroy = cache_t::destroy;
+	new_cache->num_sets = num_sets;
+	header = accel->set_cache (c->subtable_index, &new_cache->header);
+      }
+      else
+	header = accel->set_cache (c->subtable_index, HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID);
+    }
+    if (unlikely (header == HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID))
+      return NULL;
+    cache_t *cache = (cache_t *) header;
+
+    LigatureTrie *trie = (LigatureTrie *) hb_atomic_ptr_get (&cache->tries[index]);
+    if (unlikely (!trie))
+    {
+      trie = LigatureTrie::create (lig_set);
+      if (unlikely (!trie))
+	return NULL;
+      if (!hb_atomic_ptr_cmpexch (&cache->tries[index], NULL, trie))
+      {
+	trie->destroy ();
+	trie = (LigatureTrie *) hb_atomic_ptr_get (&cache->tries[index]);
+      }
+    }
+    return trie;
+  }
+
   inline bool serialize (hb_serialize_context_t *c,
 			 Supplier<GlyphID> &first_glyphs,
 			 Supplier<unsigned int> &ligature_per_first_glyph_count_list,
@@ -979,14 +1345,17 @@ struct ReverseChainSingleSubstFormat1
     const OffsetArrayOf<Coverage> &lookahead = StructAfter<OffsetArrayOf<Coverage> > (backtrack);
     const ArrayOf<GlyphID> &substitute = StructAfter<ArrayOf<GlyphID> > (lookahead);
 
+    unsigned int start_index = 0, end_index = 0;
     if (match_backtrack (c,
 			 backtrack.len, (USHORT *) backtrack.array,
-			 match_coverage, this) &&
+			 match_coverage, this,
+			 &start_index) &&
         match_lookahead (c,
 			 lookahead.len, (USHORT *) lookahead.array,
 			 match_coverage, this,
-			 1))
+			 1, &end_index))
     {
+      c->buffer->unsafe_to_break_from_outbuffer (start_index, end_index);
       c->replace_glyph_inplace (substitute[index]);
       /* Note: We DON'T decrease buffer->idx.  The main loop does it
        * for us.  This is useful for preventing surprises if someone
@@ -1321,11 +1690,15 @@ template <typename context_t>
   const SubstLookup &l = gsub.get_lookup (lookup_index);
   unsigned int saved_lookup_props = c->lookup_props;
   unsigned int saved_lookup_index = c->lookup_index;
+  const hb_ot_layout_lookup_accelerator_t *saved_lookup_accel = c->lookup_accel;
   c->set_lookup_index (lookup_index);
   c->set_lookup_props (l.get_props ());
-  bool ret = l.dispatch (c);
+  c->set_lookup_accel (likely (lookup_index < hb_ot_layout_from_face (c->face)->gsub_lookup_count) ?
+		       &hb_ot_layout_from_face (c->face)->gsub_accels[lookup_index] : NULL);
+  bool ret = c->apply_subtables (l);
   c->set_lookup_index (saved_lookup_index);
   c->set_lookup_props (saved_lookup_props);
+  c->set_lookup_accel (saved_lookup_accel);
   return ret;
 }
 
@@ -456,6 +456,20 @@ struct hb_apply_context_t :
     nesting_level_left++;
     return ret;
   }
+  /* Same as lookup.dispatch (this), keeping subtable_index up to date. */
+  template <typename TLookup>
+  inline return_t apply_subtables (const TLookup &lookup)
+  {
+    unsigned int saved_subtable_index = subtable_index;
+    unsigned int lookup_type = lookup.get_type ();
+    unsigned int count = lookup.get_subtable_count ();
+    return_t ret = default_return_value ();
+    for (subtable_index = 0; subtable_index < count; subtable_index++)
+      if (stop_sublookup_iteration (ret = lookup.get_subtable (subtable_index).dispatch (this, lookup_type)))
+	break;
+    subtable_index = saved_subtable_index;
+    return ret;
+  }
 
   unsigned int table_index; /* GSUB/GPOS */
   hb_font_t *font;
@@ -471,6 +485,8 @@ struct hb_apply_context_t :
   bool has_glyph_classes;
   skipping_iterator_t iter_input, iter_context;
   unsigned int lookup_index;
+  const hb_ot_layout_lookup_accelerator_t *lookup_accel;
+  unsigned int subtable_index; /* Of the lookup being applied; indexes lookup_accel caches. */
   unsigned int debug_depth;
 
 
@@ -490,12 +506,16 @@ struct hb_apply_context_t :
 			iter_input (),
 			iter_context (),
 			lookup_index ((unsigned int) -1),
+			lookup_accel (NULL),
+			subtable_index (0),
 			debug_depth (0) {}
 
   inline void set_lookup_mask (hb_mask_t mask) { lookup_mask = mask; }
   inline void set_auto_zwj (bool auto_zwj_) { auto_zwj = auto_zwj_; }
   inline void set_recurse_func (recurse_func_t func) { recurse_func = func; }
   inline void set_lookup_index (unsigned int lookup_index_) { lookup_index = lookup_index_; }
+  inline void set_lookup_accel (const hb_ot_layout_lookup_accelerator_t *accel) { lookup_accel = accel; }
+  inline void set_subtable_index (unsigned int subtable_index_) { subtable_index = subtable_index_; }
   inline void set_lookup_props (unsigned int lookup_props_)
   {
     lookup_props = lookup_props_;
@@ -794,6 +814,17 @@ static inline bool ligate_input (hb_apply_context_t *c,
 
   hb_buffer_t *buffer = c->buffer;
 
+  buffer->unsafe_to_break (buffer->idx, buffer->idx + match_length);
+
+  /* The ligature takes over the flags of components starting its cluster;
+   * those of the other components are about boundaries merged away. */
+  unsigned int cluster = buffer->cur().cluster;
+  for (unsigned int i = 1; i < count; i++)
+    cluster = MIN (cluster, buffer->info[match_positions[i]].cluster);
+  for (unsigned int i = 1; i < count; i++)
+    if (buffer->info[match_positions[i]].cluster == cluster)
+      buffer->cur().mask |= buffer->info[match_positions[i]].mask & HB_GLYPH_FLAG_DEFINED;
+
   buffer->merge_clusters (buffer->idx, buffer->idx + match_length);
 
   /*
@@ -884,7 +915,8 @@ static inline bool match_backtrack (hb_apply_context_t *c,
 				    unsigned int count,
 				    const USHORT backtrack[],
 				    match_func_t match_func,
-				    const void *match_data)
+				    const void *match_data,
+				    unsigned int *match_start)
 {
   TRACE_APPLY (NULL);
 
@@ -896,6 +928,8 @@ static inline bool match_backtrack (hb_apply_context_t *c,
     if (!skippy_iter.prev ())
       return_trace (false);
 
+  *match_start = skippy_iter.idx;
+
   return_trace (true);
 }
 
@@ -904,7 +938,8 @@ static inline bool match_lookahead (hb_apply_context_t *c,
 				    const USHORT lookahead[],
 				    match_func_t match_func,
 				    const void *match_data,
-				    unsigned int offset)
+				    unsigned int offset,
+				    unsigned int *end_index)
 {
   TRACE_APPLY (NULL);
 
@@ -916,6 +951,8 @@ static inline bool match_lookahead (hb_apply_context_t *c,
     if (!skippy_iter.next ())
       return_trace (false);
 
+  *end_index = skippy_iter.idx + 1;
+
   return_trace (true);
 }
 
@@ -1105,11 +1142,14 @@ static inline bool context_apply_lookup (hb_apply_context_t *c,
 {
   unsigned int match_length = 0;
   unsigned int match_positions[HB_MAX_CONTEXT_LENGTH];
-  return match_input (c,
-		      inputCount, input,
-		      lookup_context.funcs.match, lookup_context.match_data,
-		      &match_length, match_positions)
-      && apply_lookup (c,
+  if (!match_input (c,
+		    inputCount, input,
+		    lookup_context.funcs.match, lookup_context.match_data,
+		    &match_length, match_positions))
+    return false;
+
+  c->buffer->unsafe_to_break (c->buffer->idx, c->buffer->idx + match_length);
+  return apply_lookup (c,
 		       inputCount, match_positions,
 		       lookupCount, lookupRecord,
 		       match_length);
@@ -1630,25 +1670,224 @@ static inline bool chain_context_apply_lookup (hb_apply_context_t *c,
 					       const LookupRecord lookupRecord[],
 					       ChainContextApplyLookupContext &lookup_context)
 {
-  unsigned int match_length = 0;
+  unsigned int start_index = 0, match_length = 0, end_index = 0;
   unsigned int match_positions[HB_MAX_CONTEXT_LENGTH];
-  return match_input (c,
-		      inputCount, input,
-		      lookup_context.funcs.match, lookup_context.match_data[1],
-		      &match_length, match_positions)
-      && match_backtrack (c,
-			  backtrackCount, backtrack,
-			  lookup_context.funcs.match, lookup_context.match_data[0])
-      && match_lookahead (c,
-			  lookaheadCount, lookahead,
-			  lookup_context.funcs.match, lookup_context.match_data[2],
-			  match_length)
-      && apply_lookup (c,
+  if (!(match_input (c,
+		     inputCount, input,
+		     lookup_context.funcs.match, lookup_context.match_data[1],
+		     &match_length, match_positions)
+     && match_backtrack (c,
+			 backtrackCount, backtrack,
+			 lookup_context.funcs.match, lookup_context.match_data[0],
+			 &start_index)
+     && match_lookahead (c,
+			 lookaheadCount, lookahead,
+			 lookup_context.funcs.match, lookup_context.match_data[2],
+			 match_length, &end_index)))
+    return false;
+
+  c->buffer->unsafe_to_break_from_outbuffer (start_index, end_index);
+  return apply_lookup (c,
 		       inputCount, match_positions,
 		       lookupCount, lookupRecord,
 		       match_length);
 }
 
+
+/* Pre-decoded, native-endian glyph-to-class map, compiled from a ClassDef,
+ * or from a Coverage with class 1 for covered glyphs.  Used by
+ * ChainContextCompiled. */
+struct CompiledClassDef
+{
+  inline unsigned int get_class (hb_codepoint_t glyph_id) const
+  {
+    unsigned int i = (unsigned int) (glyph_id - first);
+    if (likely (i < len))
+    {
+      if (bits)
+	return (bits[i >> 5] >> (i & 31)) & 1;
+      if (classes8)
+	return classes8[i];
+      if (classes16)
+	return classes16[i];
+      return get_original_class (glyph_id);
+    }
+    return 0;
+  }
+
+  /* The map takes its bytes out of budget, and gives them back in fini();
+   * once budget runs out, the table is queried instead. */
+  inline void init (const ClassDef &class_def_, hb_atomic_int_t *budget_)
+  {
+    class_def = &class_def_;
+    init_classes (class_def_, budget_);
+  }
+  inline void init (const Coverage &coverage_, hb_atomic_int_t *budget_)
+  {
+    coverage = &coverage_;
+    init_classes (coverage_, budget_);
+  }
+  /* Uses the map of other, which must outlive this one. */
+  inline void init_shared (const CompiledClassDef &other)
+  {
+    *this = other;
+    shared = true;
+  }
+  inline void fini (void)
+  {
+    if (shared)
+      return;
+    free (bits);
+    free (classes8);
+    free (classes16);
+    if (budget)
+      budget->add ((int) bytes);
+  }
+
+  inline bool is_compiled_from (const ClassDef &class_def_) const { return class_def == &class_def_; }
+  inline bool is_compiled_from (const Coverage &coverage_) const { return coverage == &coverage_; }
+
+  private:
+  /* Ranges longer than this, or with fewer than one glyph in
+   * MAX_SPARSENESS, keep querying the font table, but only within
+   * [first, first + len). */
+  static const unsigned int MAX_DENSE_GLYPHS = 16384;
+  static const unsigned int MAX_SPARSENESS = 8;
+
+  struct range_t
+  {
+    inline void add (hb_codepoint_t g) { add_range (g, g); }
+    inline void add_range (hb_codepoint_t a, hb_codepoint_t b)
+    {
+      if (a > b) return;
+      min = MIN (min, a);
+      max = MAX (max, b);
+      count += b - a + 1;
+    }
+    hb_codepoint_t min, max;
+    unsigned int count;
+  };
+
+  inline void *alloc (unsigned int size, hb_atomic_int_t *budget_)
+  {
+    if (budget_->add (-(int) size) < (int) size)
+    {
+      budget_->add ((int) size);
+      return NULL;
+    }
+    void *p = malloc (size);
+    if (unlikely (!p))
+    {
+      budget_->add ((int) size);
+      return NULL;
+    }
+    budget = budget_;
+    bytes += size;
+    return p;
+  }
+
+  template <typename Type>
+  inline void init_classes (const Type &table, hb_atomic_int_t *budget_)
+  {
+    range_t range = {(hb_codepoint_t) -1, 0, 0};
+    table.add_coverage (&range);
+    if (range.min > range.max)
+      return; /* Empty. */
+    first = range.min;
+    len = range.max - range.min + 1;
+    if (len > MAX_DENSE_GLYPHS || len / MAX_SPARSENESS > range.count)
+      return;
+
+    if (coverage)
+    {
+      bits = (uint32_t *) alloc (((len + 31) / 32) * sizeof (bits[0]), budget_);
+      if (bits)
+      {
+	memset (bits, 0, ((len + 31) / 32) * sizeof (bits[0]));
+	for (unsigned int i = 0; i < len; i++)
+	  if (get_original_class (first + i))
+	    bits[i >> 5] |= 1u << (i & 31);
+      }
+      return;
+    }
+
+    classes8 = (uint8_t *) alloc (len * sizeof (classes8[0]), budget_);
+    if (!classes8)
+      return;
+    for (unsigned int i = 0; i < len; i++)
+    {
+      unsigned int klass = get_original_class (first + i);
+      if (unlikely (klass > 0xFF))
+      {
+	/* Rare; start over with wider classes. */
+	free (classes8);
+	classes8 = NULL;
+	budget->add ((int) bytes);
+	bytes = 0;
+	classes16 = (uint16_t *) alloc (len * sizeof (classes16[0]), budget_);
+	if (classes16)
+	  for (unsigned int j = 0; j < len; j++)
+	    classes16[j] = get_original_class (first + j);
+	return;
+      }
+      classes8[i] = klass;
+    }
+  }
+
+  inline unsigned int get_original_class (hb_codepoint_t glyph_id) const
+  {
+    if (class_def)
+      return class_def->get_class (glyph_id);
+    return coverage->get_coverage (glyph_id) != NOT_COVERED;
+  }
+
+  /* Zero-initialized by the owner. */
+  hb_codepoint_t first;
+  unsigned int len;
+  uint32_t *bits; /* For a Coverage. */
+  uint8_t *classes8;
+  uint16_t *classes16; /* If some classes don't fit in classes8. */
+  const ClassDef *class_def;
+  const Coverage *coverage;
+  hb_atomic_int_t *budget;
+  unsigned int bytes;
+  bool shared;
+};
+
+static inline bool match_compiled_class (hb_codepoint_t glyph_id, const USHORT &value, const void *data)
+{
+  const CompiledClassDef &class_def = *reinterpret_cast<const CompiledClassDef *>(data);
+  return class_def.get_class (glyph_id) == value;
+}
+static inline bool match_compiled_coverage (hb_codepoint_t glyph_id, const USHORT &value, const void *data)
+{
+  const CompiledClassDef *coverages = reinterpret_cast<const CompiledClassDef *>(data);
+  return coverages[value].get_class (glyph_id) != 0;
+}
+
+/* A ChainRule with its arrays located. */
+struct CompiledChainRule
+{
+  inline bool apply (hb_apply_context_t *c, ChainContextApplyLookupContext &lookup_context) const
+  {
+    return chain_context_apply_lookup (c,
+				       backtrackCount, backtrack,
+				       inputCount, input,
+				       lookaheadCount, lookahead,
+				       lookupCount, lookupRecord,
+				       lookup_context);
+  }
+
+  unsigned int backtrackCount;
+  const USHORT *backtrack;
+  unsigned int inputCount; /* Including the first glyph (not matched) */
+  const USHORT *input; /* Array of input values--start with second glyph */
+  unsigned int lookaheadCount;
+  const USHORT *lookahead;
+  unsigned int lookupCount;
+  const LookupRecord *lookupRecord;
+};
+
 struct ChainRule
 {
   inline void closure (hb_closure_context_t *c, ChainContextClosureLookupContext &lookup_context) const
@@ -1705,6 +1944,21 @@ struct ChainRule
 					      lookup.array, lookup_context));
   }
 
+  inline void compile (CompiledChainRule *rule) const
+  {
+    const HeadlessArrayOf<USHORT> &input = StructAfter<HeadlessArrayOf<USHORT> > (backtrack);
+    const ArrayOf<USHORT> &lookahead = StructAfter<ArrayOf<USHORT> > (input);
+    const ArrayOf<LookupRecord> &lookup = StructAfter<ArrayOf<LookupRecord> > (lookahead);
+    rule->backtrackCount = backtrack.len;
+    rule->backtrack = backtrack.array;
+    rule->inputCount = input.len;
+    rule->input = input.array;
+    rule->lookaheadCount = lookahead.len;
+    rule->lookahead = lookahead.array;
+    rule->lookupCount = lookup.len;
+    rule->lookupRecord = lookup.array;
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -1775,6 +2029,19 @@ struct ChainRuleSet
     return_trace (false);
   }
 
+  inline bool compile (hb_prealloced_array_t<CompiledChainRule> &rules) const
+  {
+    unsigned int num_rules = rule.len;
+    for (unsigned int i = 0; i < num_rules; i++)
+    {
+      CompiledChainRule *compiled = rules.push ();
+      if (unlikely (!compiled))
+        return false;
+      (this+rule[i]).compile (compiled);
+    }
+    return true;
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -1789,6 +2056,106 @@ struct ChainRuleSet
   DEFINE_SIZE_ARRAY (2, rule);
 };
 
+/* Matching data for a ChainContextFormat2 or ChainContextFormat3 subtable
+ * with its ClassDef and Coverage tables pre-decoded and its rules located,
+ * so that matching does not chase offsets or walk big-endian tables.  Built
+ * the first time the subtable is applied, and kept with the lookup
+ * accelerator. */
+struct ChainContextCompiled
+{
+  template <typename Subtable>
+  static inline const ChainContextCompiled *get (hb_apply_context_t *c, const Subtable *subtable)
+  {
+    const hb_ot_layout_lookup_accelerator_t *accel = c->lookup_accel;
+    if (!accel)
+      return NULL;
+
+    hb_ot_layout_subtable_cache_t *cache = accel->get_cache (c->subtable_index);
+    if (likely (cache))
+      return cache != HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID ? (const ChainContextCompiled *) cache : NULL;
+
+    ChainContextCompiled *compiled = (ChainContextCompiled *) calloc (1, sizeof (ChainContextCompiled));
+    if (likely (compiled))
+    {
+      compiled->header.destroy = destroy;
+      compiled->budget = &hb_ot_layout_from_face (c->face)->compiled_bytes_left;
+      if (likely (subtable->compile (compiled)))
+	cache = &compiled->header;
+      else
+	destroy (&compiled->header);
+    }
+    if (!cache)
+      cache = HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID;
+    cache = accel->set_cache (c->subtable_index, cache);
+    return cache != HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID ? (const ChainContextCompiled *) cache : NULL;
+  }
+
+  /* Compiles class_defs[i], sharing the map of an earlier one compiled
+   * from the same table. */
+  template <typename Type>
+  inline void init_class_def (unsigned int i, const Type &table)
+  {
+    for (unsigned int j = 0; j < i; j++)
+      if (class_defs[j].is_compiled_from (table))
+      {
+	class_defs[i].init_shared (class_defs[j]);
+	return;
+      }
+    class_defs[i].init (table, budget);
+  }
+
+  inline bool apply (hb_apply_context_t *c) const
+  {
+    TRACE_APPLY (this);
+    hb_codepoint_t glyph_id = c->buffer->cur().codepoint;
+    if (likely (!coverage.get_class (glyph_id))) return_trace (false);
+
+    unsigned int index = input_class_def ? input_class_def->get_class (glyph_id) : 0;
+    if (unlikely (index >= num_rule_sets)) return_trace (false);
+
+    struct ChainContextApplyLookupContext lookup_context = {
+      {match},
+      {match_data[0],
+       match_data[1],
+       match_data[2]}
+    };
+    unsigned int end = rule_set_starts[index + 1];
+    for (unsigned int i = rule_set_starts[index]; i < end; i++)
+      if (rules[i].apply (c, lookup_context))
+        return_trace (true);
+
+    return_trace (false);
+  }
+
+  static void destroy (hb_ot_layout_subtable_cache_t *header)
+  {
+    ChainContextCompiled *compiled = (ChainContextCompiled *) header;
+    compiled->coverage.fini ();
+    for (unsigned int i = 0; i < compiled->num_class_defs; i++)
+      compiled->class_defs[i].fini ();
+    free (compiled->class_defs);
+    free (compiled->values);
+    free (compiled->rule_set_starts);
+    free (compiled->rules);
+    free (compiled);
+  }
+
+  hb_ot_layout_subtable_cache_t header;
+  hb_atomic_int_t *budget; /* For the glyph maps; see CompiledClassDef. */
+
+  /* Filled in by the subtable's compile(). */
+  CompiledClassDef coverage;
+  const CompiledClassDef *input_class_def; /* Selects the rule set; NULL if only one. */
+  unsigned int num_class_defs;
+  CompiledClassDef *class_defs;
+  USHORT *values; /* Rule values, when not in the font. */
+  match_func_t match;
+  const void *match_data[3];
+  unsigned int num_rule_sets;
+  unsigned int *rule_set_starts; /* num_rule_sets + 1 entries. */
+  CompiledChainRule *rules;
+};
+
 struct ChainContextFormat1
 {
   inline void closure (hb_closure_context_t *c) const
@@ -1948,6 +2315,10 @@ struct ChainContextFormat2
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
+    const ChainContextCompiled *compiled = ChainContextCompiled::get (c, this);
+    if (likely (compiled))
+      return_trace (compiled->apply (c));
+
     unsigned int index = (this+coverage).get_coverage (c->buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return_trace (false);
 
@@ -1966,6 +2337,42 @@ struct ChainContextFormat2
     return_trace (rule_set.apply (c, lookup_context));
   }
 
+  inline bool compile (ChainContextCompiled *compiled) const
+  {
+    compiled->class_defs = (CompiledClassDef *) calloc (3, sizeof (CompiledClassDef));
+    if (unlikely (!compiled->class_defs)) return false;
+    compiled->num_class_defs = 3;
+    compiled->coverage.init (this+coverage, compiled->budget);
+    compiled->init_class_def (0, this+backtrackClassDef);
+    compiled->init_class_def (1, this+inputClassDef);
+    compiled->init_class_def (2, this+lookaheadClassDef);
+    compiled->input_class_def = &compiled->class_defs[1];
+    compiled->match = match_compiled_class;
+    for (unsigned int i = 0; i < 3; i++)
+      compiled->match_data[i] = &compiled->class_defs[i];
+
+    unsigned int count = ruleSet.len;
+    compiled->rule_set_starts = (unsigned int *) calloc (count + 1, sizeof (unsigned int));
+    if (unlikely (!compiled->rule_set_starts)) return false;
+    compiled->num_rule_sets = count;
+
+    hb_auto_array_t<CompiledChainRule> rules;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      compiled->rule_set_starts[i] = rules.len;
+      if (unlikely (!(this+ruleSet[i]).compile (rules))) return false;
+    }
+    compiled->rule_set_starts[count] = rules.len;
+
+    if (rules.len)
+    {
+      compiled->rules = (CompiledChainRule *) malloc (rules.len * sizeof (CompiledChainRule));
+      if (unlikely (!compiled->rules)) return false;
+      memcpy (compiled->rules, rules.array, rules.len * sizeof (CompiledChainRule));
+    }
+    return true;
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -2072,6 +2479,10 @@ struct ChainContextFormat3
   inline bool apply (hb_apply_context_t *c) const
   {
     TRACE_APPLY (this);
+    const ChainContextCompiled *compiled = ChainContextCompiled::get (c, this);
+    if (likely (compiled))
+      return_trace (compiled->apply (c));
+
     const OffsetArrayOf<Coverage> &input = StructAfter<OffsetArrayOf<Coverage> > (backtrack);
 
     unsigned int index = (this+input[0]).get_coverage (c->buffer->cur().codepoint);
@@ -2090,6 +2501,60 @@ struct ChainContextFormat3
 					      lookup.len, lookup.array, lookup_context));
   }
 
+  /* The single rule matches coverages by index into class_defs, which
+   * holds backtrack, input (from the second glyph) and lookahead coverages
+   * in that order. */
+  inline bool compile (ChainContextCompiled *compiled) const
+  {
+    const OffsetArrayOf<Coverage> &input = StructAfter<OffsetArrayOf<Coverage> > (backtrack);
+    const OffsetArrayOf<Coverage> &lookahead = StructAfter<OffsetArrayOf<Coverage> > (input);
+    const ArrayOf<LookupRecord> &lookup = StructAfter<ArrayOf<LookupRecord> > (lookahead);
+    if (unlikely (!input.len)) return false;
+
+    unsigned int backtrack_count = backtrack.len;
+    unsigned int input_count = input.len;
+    unsigned int lookahead_count = lookahead.len;
+    unsigned int count = backtrack_count + input_count - 1 + lookahead_count;
+
+    compiled->coverage.init (this+input[0], compiled->budget);
+
+    compiled->class_defs = (CompiledClassDef *) calloc (count, sizeof (CompiledClassDef));
+    compiled->values = (USHORT *) calloc (count, sizeof (USHORT));
+    compiled->rule_set_starts = (unsigned int *) calloc (2, sizeof (unsigned int));
+    compiled->rules = (CompiledChainRule *) calloc (1, sizeof (CompiledChainRule));
+    if (unlikely ((count && (!compiled->class_defs || !compiled->values)) ||
+		  !compiled->rule_set_starts || !compiled->rules))
+      return false;
+    compiled->num_class_defs = count;
+
+    unsigned int j = 0;
+    for (unsigned int i = 0; i < backtrack_count; i++, j++)
+      compiled->init_class_def (j, this+backtrack[i]);
+    for (unsigned int i = 1; i < input_count; i++, j++)
+      compiled->init_class_def (j, this+input[i]);
+    for (unsigned int i = 0; i < lookahead_count; i++, j++)
+      compiled->init_class_def (j, this+lookahead[i]);
+    for (unsigned int i = 0; i < count; i++)
+      compiled->values[i].set (i);
+
+    compiled->match = match_compiled_coverage;
+    for (unsigned int i = 0; i < 3; i++)
+      compiled->match_data[i] = compiled->class_defs;
+
+    compiled->num_rule_sets = 1;
+    compiled->rule_set_starts[1] = 1;
+    CompiledChainRule &rule = compiled->rules[0];
+    rule.backtrackCount = backtrack_count;
+    rule.backtrack = compiled->values;
+    rule.inputCount = input_count;
+    rule.input = compiled->values + backtrack_count;
+    rule.lookaheadCount = lookahead_count;
+    rule.lookahead = compiled->values + backtrack_count + input_count - 1;
+    rule.lookupCount = lookup.len;
+    rule.lookupRecord = lookup.array;
+    return true;
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -34,6 +34,7 @@
 #include "hb-font-private.hh"
 #include "hb-buffer-private.hh"
 #include "hb-set-private.hh"
+#include "hb-atomic-private.hh"
 
 
 /* Private API corresponding to hb-ot-layout.h: */
@@ -126,6 +127,24 @@ namespace OT {
   struct GPOS;
 }
 
+/* Defined with the Arabic shaper; see hb-ot-shape-complex-arabic-fallback.hh. */
+struct arabic_fallback_face_t;
+
+HB_INTERNAL void
+arabic_fallback_face_destroy (arabic_fallback_face_t *fallback_face);
+
+/* Matching data derived from one subtable of a lookup, built lazily the
+ * first time the subtable is applied, and kept with the lookup accelerator.
+ * Subtable-specific data follows the header; see eg.
+ * OT::LigatureSubstFormat1::get_trie(). */
+struct hb_ot_layout_subtable_cache_t
+{
+  void (*destroy) (hb_ot_layout_subtable_cache_t *cache);
+};
+
+/* Cached for subtables that can't be compiled, so they aren't retried. */
+#define HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID ((hb_ot_layout_subtable_cache_t *) -1)
+
 struct hb_ot_layout_lookup_accelerator_t
 {
   template <typename TLookup>
@@ -133,10 +152,47 @@ struct hb_ot_layout_lookup_accelerator_t
   {
     digest.init ();
     lookup.add_coverage (&digest);
+
+    subtable_count = lookup.get_subtable_count ();
+    subtable_caches = (hb_ot_layout_subtable_cache_t **) calloc (subtable_count, sizeof (subtable_caches[0]));
+    if (unlikely (!subtable_caches))
+      subtable_count = 0;
   }
 
   inline void fini (void)
   {
+    for (unsigned int i = 0; i < subtable_count; i++)
+    {
+      hb_ot_layout_subtable_cache_t *cache = subtable_caches[i];
+      if (cache && cache != HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID)
+	cache->destroy (cache);
+    }
+    free (subtable_caches);
+    subtable_caches = NULL;
+    subtable_count = 0;
+  }
+
+  /* Returns the cache of the i'th subtable, NULL if not built yet, or
+   * HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID if it can't be. */
+  inline hb_ot_layout_subtable_cache_t *get_cache (unsigned int i) const
+  {
+    if (unlikely (i >= subtable_count))
+      return HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID;
+    return (hb_ot_layout_subtable_cache_t *) hb_atomic_ptr_get (&subtable_caches[i]);
+  }
+
+  /* Racing threads may each build a cache for the same subtable; the first
+   * one set is kept and returned, and the others destroyed. */
+  inline hb_ot_layout_subtable_cache_t *set_cache (unsigned int i, hb_ot_layout_subtable_cache_t *cache) const
+  {
+    if (unlikely (i >= subtable_count) ||
+	!hb_atomic_ptr_cmpexch (&subtable_caches[i], NULL, cache))
+    {
+      if (cache != HB_OT_LAYOUT_SUBTABLE_CACHE_INVALID)
+	cache->destroy (cache);
+      cache = get_cache (i);
+    }
+    return cache;
   }
 
   inline bool may_have (hb_codepoint_t g) const {
@@ -145,6 +201,57 @@ struct hb_ot_layout_lookup_accelerator_t
 
   private:
   hb_set_digest_t digest;
+
+  /* One per subtable of the lookup, set at most once until fini(). */
+  unsigned int subtable_count;
+  mutable hb_ot_layout_subtable_cache_t **subtable_caches;
+};
+
+/* Lookup statistics.  Counters are 64-bit, built out of two 32-bit atomic
+ * halves; readers may observe a torn value while a shaping call is in
+ * flight, which is fine for profiling purposes. */
+struct hb_ot_layout_lookup_counter_t
+{
+  inline void add (uint64_t v)
+  {
+    unsigned int v_lo = (unsigned int) v;
+    unsigned int old_lo = (unsigned int) lo.add ((int) v_lo);
+    unsigned int v_hi = (unsigned int) (v >> 32) + (old_lo + v_lo < old_lo ? 1 : 0);
+    if (unlikely (v_hi))
+      hi.add ((int) v_hi);
+  }
+
+  inline uint64_t get (void) const
+  {
+    return ((uint64_t) (unsigned int) hi.get_unsafe () << 32) |
+	   (uint64_t) (unsigned int) lo.get_unsafe ();
+  }
+
+  inline void reset (void)
+  {
+    lo.set_unsafe (0);
+    hi.set_unsafe (0);
+  }
+
+  private:
+  hb_atomic_int_t lo;
+  hb_atomic_int_t hi;
+};
+
+struct hb_ot_layout_lookup_counters_t
+{
+  inline void reset (void)
+  {
+    applications.reset ();
+    glyphs_examined.reset ();
+    glyphs_matched.reset ();
+    cycles.reset ();
+  }
+
+  hb_ot_layout_lookup_counter_t applications;
+  hb_ot_layout_lookup_counter_t glyphs_examined;
+  hb_ot_layout_lookup_counter_t glyphs_matched;
+  hb_ot_layout_lookup_counter_t cycles;
 };
 
 struct hb_ot_layout_t
@@ -162,6 +269,19 @@ struct hb_ot_layout_t
 
   hb_ot_layout_lookup_accelerator_t *gsub_accels;
   hb_ot_layout_lookup_accelerator_t *gpos_accels;
+
+  /* Bytes left for the glyph maps of compiled subtables; see
+   * OT::CompiledClassDef. */
+  hb_atomic_int_t compiled_bytes_left;
+
+  /* NULL unless hb_ot_layout_lookup_stats_enable() was called on the face.
+   * GSUB counters come first, followed by GPOS ones. */
+  hb_ot_layout_lookup_counters_t *lookup_counters;
+
+  /* Synthesized Arabic presentation-forms lookups, for fonts without
+   * GSUB Arabic features.  Built lazily by the Arabic shaper, or by
+   * hb_ot_shape_fallback_prepare(). */
+  arabic_fallback_face_t *arabic_fallback;
 };
 
 
@@ -40,10 +40,17 @@
 
 #include <stdlib.h>
 #include <string.h>
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h> /* For __rdtsc(). */
+#endif
 
 
 HB_SHAPER_DATA_ENSURE_DECLARE(ot, face)
 
+#ifndef HB_OT_LAYOUT_MAX_COMPILED_BYTES
+#define HB_OT_LAYOUT_MAX_COMPILED_BYTES (1 << 20)
+#endif
+
 hb_ot_layout_t *
 _hb_ot_layout_create (hb_face_t *face)
 {
@@ -51,6 +58,8 @@ _hb_ot_layout_create (hb_face_t *face)
   if (unlikely (!layout))
     return NULL;
 
+  layout->compiled_bytes_left.set_unsafe (HB_OT_LAYOUT_MAX_COMPILED_BYTES);
+
   layout->gdef_blob = OT::Sanitizer<OT::GDEF>::sanitize (face->reference_table (HB_OT_TAG_GDEF));
   layout->gdef = OT::Sanitizer<OT::GDEF>::lock_instance (layout->gdef_blob);
 
@@ -118,6 +127,8 @@ _hb_ot_layout_destroy (hb_ot_layout_t *layout)
 
   free (layout->gsub_accels);
   free (layout->gpos_accels);
+  free (layout->lookup_counters);
+  arabic_fallback_face_destroy (layout->arabic_fallback);
 
   hb_blob_destroy (layout->gdef_blob);
   hb_blob_destroy (layout->gsub_blob);
@@ -894,6 +905,148 @@ hb_ot_layout_get_size_params (hb_face_t    *face,
 }
 
 
+/*
+ * Lookup statistics
+ */
+
+static inline uint64_t
+_hb_ot_layout_cycles (void)
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+  return __builtin_ia32_rdtsc ();
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  return __rdtsc ();
+#else
+  return 0;
+#endif
+}
+
+static inline hb_ot_layout_lookup_counters_t *
+_get_lookup_counters (hb_face_t *face, unsigned int table_index)
+{
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (face);
+  hb_ot_layout_lookup_counters_t *counters = (hb_ot_layout_lookup_counters_t *) hb_atomic_ptr_get (&layout->lookup_counters);
+  if (likely (!counters))
+    return NULL;
+  return table_index ? counters + layout->gsub_lookup_count : counters;
+}
+
+/**
+ * hb_ot_layout_lookup_stats_enable:
+ * @face: a face.
+ *
+ * Starts collecting per-lookup statistics for all GSUB and GPOS lookups
+ * applied when shaping with @face.  Statistics are accumulated across all
+ * fonts, shape plans and threads using the face, until the face is
+ * destroyed.  When not enabled, collecting statistics costs nothing.
+ *
+ * Return value: %true if statistics are being collected, %false on
+ * allocation failure.
+ *
+ * Since: 1.2.4
+ **/
+hb_bool_t
+hb_ot_layout_lookup_stats_enable (hb_face_t *face)
+{
+  if (unlikely (!hb_ot_shaper_face_data_ensure (face))) return false;
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (face);
+
+retry:
+  hb_ot_layout_lookup_counters_t *counters = (hb_ot_layout_lookup_counters_t *) hb_atomic_ptr_get (&layout->lookup_counters);
+  if (counters)
+    return true;
+
+  counters = (hb_ot_layout_lookup_counters_t *) calloc (MAX (1u, layout->gsub_lookup_count + layout->gpos_lookup_count),
+							 sizeof (hb_ot_layout_lookup_counters_t));
+  if (unlikely (!counters))
+    return false;
+
+  if (!hb_atomic_ptr_cmpexch (&layout->lookup_counters, NULL, counters))
+  {
+    free (counters);
+    goto retry;
+  }
+  return true;
+}
+
+/**
+ * hb_ot_layout_lookup_stats_reset:
+ * @face: a face.
+ *
+ * Resets all lookup statistics collected for @face to zero.  Does nothing
+ * if statistics were not enabled with hb_ot_layout_lookup_stats_enable().
+ *
+ * Since: 1.2.4
+ **/
+void
+hb_ot_layout_lookup_stats_reset (hb_face_t *face)
+{
+  if (unlikely (!hb_ot_shaper_face_data_ensure (face))) return;
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (face);
+  hb_ot_layout_lookup_counters_t *counters = _get_lookup_counters (face, 0);
+  if (!counters)
+    return;
+
+  unsigned int count = layout->gsub_lookup_count + layout->gpos_lookup_count;
+  for (unsigned int i = 0; i < count; i++)
+    counters[i].reset ();
+}
+
+/**
+ * hb_ot_layout_lookup_get_stats:
+ * @face: a face.
+ * @table_tag: %HB_OT_TAG_GSUB or %HB_OT_TAG_GPOS.
+ * @lookup_index: index of the lookup in the table.
+ * @stats: (out): statistics collected for the lookup.
+ *
+ * Fetches the statistics collected for a lookup since
+ * hb_ot_layout_lookup_stats_enable() or the last
+ * hb_ot_layout_lookup_stats_reset().  The cycles field is only available on
+ * x86 architectures and reads zero elsewhere.
+ *
+ * Return value: %true if statistics are enabled and @lookup_index is valid,
+ * %false otherwise, in which case @stats is zeroed.
+ *
+ * Since: 1.2.4
+ **/
+hb_bool_t
+hb_ot_layout_lookup_get_stats (hb_face_t                   *face,
+			       hb_tag_t                     table_tag,
+			       unsigned int                 lookup_index,
+			       hb_ot_layout_lookup_stats_t *stats /* OUT */)
+{
+  memset (stats, 0, sizeof (*stats));
+  if (unlikely (!hb_ot_shaper_face_data_ensure (face))) return false;
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (face);
+
+  unsigned int table_index;
+  switch (table_tag)
+  {
+    case HB_OT_TAG_GSUB:
+      if (lookup_index >= layout->gsub_lookup_count) return false;
+      table_index = 0;
+      break;
+    case HB_OT_TAG_GPOS:
+      if (lookup_index >= layout->gpos_lookup_count) return false;
+      table_index = 1;
+      break;
+    default:
+      return false;
+  }
+
+  const hb_ot_layout_lookup_counters_t *counters = _get_lookup_counters (face, table_index);
+  if (!counters)
+    return false;
+  counters += lookup_index;
+
+  stats->applications    = counters->applications.get ();
+  stats->glyphs_examined = counters->glyphs_examined.get ();
+  stats->glyphs_matched  = counters->glyphs_matched.get ();
+  stats->cycles          = counters->cycles.get ();
+  return true;
+}
+
+
 /*
  * Parts of different types are implemented here such that they have direct
  * access to GSUB/GPOS lookups.
@@ -908,10 +1061,12 @@ struct GSUBProxy
 
   GSUBProxy (hb_face_t *face) :
     table (*hb_ot_layout_from_face (face)->gsub),
-    accels (hb_ot_layout_from_face (face)->gsub_accels) {}
+    accels (hb_ot_layout_from_face (face)->gsub_accels),
+    counters (_get_lookup_counters (face, table_index)) {}
 
   const OT::GSUB &table;
   const hb_ot_layout_lookup_accelerator_t *accels;
+  hb_ot_layout_lookup_counters_t *counters;
 };
 
 struct GPOSProxy
@@ -922,10 +1077,12 @@ struct GPOSProxy
 
   GPOSProxy (hb_face_t *face) :
     table (*hb_ot_layout_from_face (face)->gpos),
-    accels (hb_ot_layout_from_face (face)->gpos_accels) {}
+    accels (hb_ot_layout_from_face (face)->gpos_accels),
+    counters (_get_lookup_counters (face, table_index)) {}
 
   const OT::GPOS &table;
   const hb_ot_layout_lookup_accelerator_t *accels;
+  hb_ot_layout_lookup_counters_t *counters;
 };
 
 
@@ -943,17 +1100,23 @@ struct hb_get_subtables_context_t :
 
   struct hb_applicable_t
   {
-    inline void init (const void *obj_, hb_apply_func_t apply_func_)
+    inline void init (const void *obj_, hb_apply_func_t apply_func_, unsigned int subtable_index_)
     {
       obj = obj_;
       apply_func = apply_func_;
+      subtable_index = subtable_index_;
     }
 
-    inline bool apply (OT::hb_apply_context_t *c) const { return apply_func (obj, c); }
+    inline bool apply (OT::hb_apply_context_t *c) const
+    {
+      c->set_subtable_index (subtable_index);
+      return apply_func (obj, c);
+    }
 
     private:
     const void *obj;
     hb_apply_func_t apply_func;
+    unsigned int subtable_index;
   };
 
   typedef hb_auto_array_t<hb_applicable_t> array_t;
@@ -965,24 +1128,37 @@ struct hb_get_subtables_context_t :
   {
     hb_applicable_t *entry = array.push();
     if (likely (entry))
-      entry->init (&obj, apply_to<T>);
+      entry->init (&obj, apply_to<T>, subtable_index);
     return HB_VOID;
   }
   static return_t default_return_value (void) { return HB_VOID; }
   bool stop_sublookup_iteration (return_t r HB_UNUSED) const { return false; }
 
+  template <typename TLookup>
+  inline void get_subtables (const TLookup &lookup)
+  {
+    unsigned int lookup_type = lookup.get_type ();
+    unsigned int count = lookup.get_subtable_count ();
+    for (subtable_index = 0; subtable_index < count; subtable_index++)
+      lookup.get_subtable (subtable_index).dispatch (this, lookup_type);
+  }
+
   hb_get_subtables_context_t (array_t &array_) :
 			      array (array_),
+			      subtable_index (0),
 			      debug_depth (0) {}
 
   array_t &array;
+  unsigned int subtable_index;
   unsigned int debug_depth;
 };
 
 static inline bool
 apply_forward (OT::hb_apply_context_t *c,
 	       const hb_ot_layout_lookup_accelerator_t &accel,
-	       const hb_get_subtables_context_t::array_t &subtables)
+	       const hb_get_subtables_context_t::array_t &subtables,
+	       unsigned int &examined,
+	       unsigned int &matched)
 {
   bool ret = false;
   hb_buffer_t *buffer = c->buffer;
@@ -993,6 +1169,7 @@ apply_forward (OT::hb_apply_context_t *c,
 	(buffer->cur().mask & c->lookup_mask) &&
 	c->check_glyph_property (&buffer->cur(), c->lookup_props))
      {
+       examined++;
        for (unsigned int i = 0; i < subtables.len; i++)
          if (subtables[i].apply (c))
 	 {
@@ -1002,7 +1179,10 @@ apply_forward (OT::hb_apply_context_t *c,
      }
 
     if (applied)
+    {
+      matched++;
       ret = true;
+    }
     else
       buffer->next_glyph ();
   }
@@ -1012,7 +1192,9 @@ apply_forward (OT::hb_apply_context_t *c,
 static inline bool
 apply_backward (OT::hb_apply_context_t *c,
 	       const hb_ot_layout_lookup_accelerator_t &accel,
-	       const hb_get_subtables_context_t::array_t &subtables)
+	       const hb_get_subtables_context_t::array_t &subtables,
+	       unsigned int &examined,
+	       unsigned int &matched)
 {
   bool ret = false;
   hb_buffer_t *buffer = c->buffer;
@@ -1022,9 +1204,11 @@ apply_backward (OT::hb_apply_context_t *c,
 	(buffer->cur().mask & c->lookup_mask) &&
 	c->check_glyph_property (&buffer->cur(), c->lookup_props))
     {
+     examined++;
      for (unsigned int i = 0; i < subtables.len; i++)
        if (subtables[i].apply (c))
        {
+	 matched++;
 	 ret = true;
 	 break;
        }
@@ -1041,18 +1225,23 @@ template <typename Proxy>
 static inline void
 apply_string (OT::hb_apply_context_t *c,
 	      const typename Proxy::Lookup &lookup,
-	      const hb_ot_layout_lookup_accelerator_t &accel)
+	      const hb_ot_layout_lookup_accelerator_t &accel,
+	      hb_ot_layout_lookup_counters_t *counters = NULL)
 {
   hb_buffer_t *buffer = c->buffer;
 
   if (unlikely (!buffer->len || !c->lookup_mask))
     return;
 
+  uint64_t start_cycles = unlikely (counters) ? _hb_ot_layout_cycles () : 0;
+  unsigned int examined = 0, matched = 0;
+
   c->set_lookup_props (lookup.get_props ());
+  c->set_lookup_accel (&accel);
 
   hb_get_subtables_context_t::array_t subtables;
   hb_get_subtables_context_t c_get_subtables (subtables);
-  lookup.dispatch (&c_get_subtables);
+  c_get_subtables.get_subtables (lookup);
 
   if (likely (!lookup.is_reverse ()))
   {
@@ -1062,7 +1251,7 @@ apply_string (OT::hb_apply_context_t *c,
     buffer->idx = 0;
 
     bool ret;
-    ret = apply_forward (c, accel, subtables);
+    ret = apply_forward (c, accel, subtables, examined, matched);
     if (ret)
     {
       if (!Proxy::inplace)
@@ -1078,10 +1267,29 @@ apply_string (OT::hb_apply_context_t *c,
       buffer->remove_output ();
     buffer->idx = buffer->len - 1;
 
-    apply_backward (c, accel, subtables);
+    apply_backward (c, accel, subtables, examined, matched);
+  }
+
+  if (unlikely (counters))
+  {
+    counters->applications.add (1);
+    counters->glyphs_examined.add (examined);
+    counters->glyphs_matched.add (matched);
+    counters->cycles.add (_hb_ot_layout_cycles () - start_cycles);
   }
 }
 
+static inline hb_mask_t
+collect_buffer_mask (const hb_buffer_t *buffer)
+{
+  hb_mask_t mask = 0;
+  unsigned int count = buffer->len;
+  const hb_glyph_info_t *info = buffer->info;
+  for (unsigned int i = 0; i < count; i++)
+    mask |= info[i].mask;
+  return mask;
+}
+
 template <typename Proxy>
 inline void hb_ot_map_t::apply (const Proxy &proxy,
 				const hb_ot_shape_plan_t *plan,
@@ -1093,10 +1301,19 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
   OT::hb_apply_context_t c (table_index, font, buffer);
   c.set_recurse_func (Proxy::Lookup::apply_recurse_func);
 
+  /* A lookup can only apply to glyphs having one of its mask bits set.
+   * Lookups do not set mask bits, only pause functions may; so collect
+   * the bits set in the buffer, again after each pause, and skip lookups
+   * of features no glyph has; eg. the jamo features for precomposed
+   * Hangul. */
+  hb_mask_t buffer_mask = collect_buffer_mask (buffer);
+
   for (unsigned int stage_index = 0; stage_index < stages[table_index].len; stage_index++) {
     const stage_map_t *stage = &stages[table_index][stage_index];
     for (; i < stage->last_lookup; i++)
     {
+      if (!(lookups[table_index][i].mask & buffer_mask))
+	continue;
       unsigned int lookup_index = lookups[table_index][i].index;
       if (!buffer->message (font, "start lookup %d", lookup_index)) continue;
       c.set_lookup_index (lookup_index);
@@ -1104,7 +1321,8 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
       c.set_auto_zwj (lookups[table_index][i].auto_zwj);
       apply_string<Proxy> (&c,
 			   proxy.table.get_lookup (lookup_index),
-			   proxy.accels[lookup_index]);
+			   proxy.accels[lookup_index],
+			   proxy.counters ? &proxy.counters[lookup_index] : NULL);
       (void) buffer->message (font, "end lookup %d", lookup_index);
     }
 
@@ -1112,6 +1330,7 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
     {
       buffer->clear_output ();
       stage->pause_func (plan, font, buffer);
+      buffer_mask = collect_buffer_mask (buffer);
     }
   }
 }
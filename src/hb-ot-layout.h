@@ -297,6 +297,30 @@ hb_ot_layout_get_size_params (hb_face_t    *face,
 			      unsigned int *range_end          /* OUT.  May be NULL */);
 
 
+/*
+ * Lookup statistics
+ */
+
+typedef struct hb_ot_layout_lookup_stats_t {
+  uint64_t applications;    /* Number of times the lookup was run over a buffer. */
+  uint64_t glyphs_examined; /* Glyphs the lookup's subtables were tried on. */
+  uint64_t glyphs_matched;  /* Glyphs at which a subtable applied. */
+  uint64_t cycles;          /* CPU timestamp-counter ticks spent; x86 only. */
+} hb_ot_layout_lookup_stats_t;
+
+HB_EXTERN hb_bool_t
+hb_ot_layout_lookup_stats_enable (hb_face_t *face);
+
+HB_EXTERN void
+hb_ot_layout_lookup_stats_reset (hb_face_t *face);
+
+HB_EXTERN hb_bool_t
+hb_ot_layout_lookup_get_stats (hb_face_t                   *face,
+			       hb_tag_t                     table_tag,
+			       unsigned int                 lookup_index,
+			       hb_ot_layout_lookup_stats_t *stats /* OUT */);
+
+
 HB_END_DECLS
 
 #endif /* HB_OT_LAYOUT_H */
@@ -130,7 +130,11 @@ void hb_ot_map_builder_t::add_pause (unsigned int table_index, hb_ot_map_t::paus
 void
 hb_ot_map_builder_t::compile (hb_ot_map_t &m)
 {
-  m.global_mask = 1;
+  /* The global bit sits right above the glyph flags. */
+  const unsigned int global_bit_shift = _hb_popcount32 (HB_GLYPH_FLAG_DEFINED);
+  const hb_mask_t global_bit_mask = HB_GLYPH_FLAG_DEFINED + 1;
+
+  m.global_mask = global_bit_mask;
 
   unsigned int required_feature_index[2];
   hb_tag_t required_feature_tag[2];
@@ -182,7 +186,7 @@ hb_ot_map_builder_t::compile (hb_ot_map_t &m)
 
 
   /* Allocate bits now */
-  unsigned int next_bit = 1;
+  unsigned int next_bit = global_bit_shift + 1;
   for (unsigned int i = 0; i < feature_infos.len; i++)
   {
     const feature_info_t *info = &feature_infos[i];
@@ -242,8 +246,8 @@ hb_ot_map_builder_t::compile (hb_ot_map_t &m)
     map->auto_zwj = !(info->flags & F_MANUAL_ZWJ);
     if ((info->flags & F_GLOBAL) && info->max_value == 1) {
       /* Uses the global bit */
-      map->shift = 0;
-      map->mask = 1;
+      map->shift = global_bit_shift;
+      map->mask = global_bit_mask;
     } else {
       map->shift = next_bit;
       map->mask = (1 << (next_bit + bits_needed)) - (1 << next_bit);
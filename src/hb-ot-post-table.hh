@@ -0,0 +1,192 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef HB_OT_POST_TABLE_HH
+#define HB_OT_POST_TABLE_HH
+
+#include "hb-open-type-private.hh"
+
+
+namespace OT {
+
+
+/*
+ * post -- PostScript
+ */
+
+#define HB_OT_TAG_post HB_TAG('p','o','s','t')
+
+
+/* The 258 glyph names of the standard Macintosh character set, in the
+ * order glyph name indices 0..257 refer to them. */
+#define HB_OT_POST_NUM_MAC_GLYPH_NAMES 258
+static const char * const _hb_ot_post_mac_glyph_names[HB_OT_POST_NUM_MAC_GLYPH_NAMES] =
+{
+  /*   0 */ ".notdef", ".null", "nonmarkingreturn", "space",
+  /*   4 */ "exclam", "quotedbl", "numbersign", "dollar",
+  /*   8 */ "percent", "ampersand", "quotesingle", "parenleft",
+  /*  12 */ "parenright", "asterisk", "plus", "comma",
+  /*  16 */ "hyphen", "period", "slash", "zero",
+  /*  20 */ "one", "two", "three", "four",
+  /*  24 */ "five", "six", "seven", "eight",
+  /*  28 */ "nine", "colon", "semicolon", "less",
+  /*  32 */ "equal", "greater", "question", "at",
+  /*  36 */ "A", "B", "C", "D",
+  /*  40 */ "E", "F", "G", "H",
+  /*  44 */ "I", "J", "K", "L",
+  /*  48 */ "M", "N", "O", "P",
+  /*  52 */ "Q", "R", "S", "T",
+  /*  56 */ "U", "V", "W", "X",
+  /*  60 */ "Y", "Z", "bracketleft", "backslash",
+  /*  64 */ "bracketright", "asciicircum", "underscore", "grave",
+  /*  68 */ "a", "b", "c", "d",
+  /*  72 */ "e", "f", "g", "h",
+  /*  76 */ "i", "j", "k", "l",
+  /*  80 */ "m", "n", "o", "p",
+  /*  84 */ "q", "r", "s", "t",
+  /*  88 */ "u", "v", "w", "x",
+  /*  92 */ "y", "z", "braceleft", "bar",
+  /*  96 */ "braceright", "asciitilde", "Adieresis", "Aring",
+  /* 100 */ "Ccedilla", "Eacute", "Ntilde", "Odieresis",
+  /* 104 */ "Udieresis", "aacute", "agrave", "acircumflex",
+  /* 108 */ "adieresis", "atilde", "aring", "ccedilla",
+  /* 112 */ "eacute", "egrave", "ecircumflex", "edieresis",
+  /* 116 */ "iacute", "igrave", "icircumflex", "idieresis",
+  /* 120 */ "ntilde", "oacute", "ograve", "ocircumflex",
+  /* 124 */ "odieresis", "otilde", "uacute", "ugrave",
+  /* 128 */ "ucircumflex", "udieresis", "dagger", "degree",
+  /* 132 */ "cent", "sterling", "section", "bullet",
+  /* 136 */ "paragraph", "germandbls", "registered", "copyright",
+  /* 140 */ "trademark", "acute", "dieresis", "notequal",
+  /* 144 */ "AE", "Oslash", "infinity", "plusminus",
+  /* 148 */ "lessequal", "greaterequal", "yen", "mu",
+  /* 152 */ "partialdiff", "summation", "product", "pi",
+  /* 156 */ "integral", "ordfeminine", "ordmasculine", "Omega",
+  /* 160 */ "ae", "oslash", "questiondown", "exclamdown",
+  /* 164 */ "logicalnot", "radical", "florin", "approxequal",
+  /* 168 */ "Delta", "guillemotleft", "guillemotright", "ellipsis",
+  /* 172 */ "nonbreakingspace", "Agrave", "Atilde", "Otilde",
+  /* 176 */ "OE", "oe", "endash", "emdash",
+  /* 180 */ "quotedblleft", "quotedblright", "quoteleft", "quoteright",
+  /* 184 */ "divide", "lozenge", "ydieresis", "Ydieresis",
+  /* 188 */ "fraction", "currency", "guilsinglleft", "guilsinglright",
+  /* 192 */ "fi", "fl", "daggerdbl", "periodcentered",
+  /* 196 */ "quotesinglbase", "quotedblbase", "perthousand", "Acircumflex",
+  /* 200 */ "Ecircumflex", "Aacute", "Edieresis", "Egrave",
+  /* 204 */ "Iacute", "Icircumflex", "Idieresis", "Igrave",
+  /* 208 */ "Oacute", "Ocircumflex", "apple", "Ograve",
+  /* 212 */ "Uacute", "Ucircumflex", "Ugrave", "dotlessi",
+  /* 216 */ "circumflex", "tilde", "macron", "breve",
+  /* 220 */ "dotaccent", "ring", "cedilla", "hungarumlaut",
+  /* 224 */ "ogonek", "caron", "Lslash", "lslash",
+  /* 228 */ "Scaron", "scaron", "Zcaron", "zcaron",
+  /* 232 */ "brokenbar", "Eth", "eth", "Yacute",
+  /* 236 */ "yacute", "Thorn", "thorn", "minus",
+  /* 240 */ "multiply", "onesuperior", "twosuperior", "threesuperior",
+  /* 244 */ "onehalf", "onequarter", "threequarters", "franc",
+  /* 248 */ "Gbreve", "gbreve", "Idotaccent", "Scedilla",
+  /* 252 */ "scedilla", "Cacute", "cacute", "Ccaron",
+  /* 256 */ "ccaron", "dcroat",
+};
+
+struct postV2Tail
+{
+  inline bool sanitize (hb_sanitize_context_t *c) const
+  {
+    TRACE_SANITIZE (this);
+    return_trace (glyphNameIndex.sanitize (c));
+  }
+
+  ArrayOf<USHORT>glyphNameIndex;	/* This is not an offset, but is the
+					 * ordinal number of the glyph in 'post'
+					 * string tables.  Indices below 258
+					 * are standard Macintosh names. */
+  BYTE		namesX[VAR];		/* Glyph names with length bytes [variable]
+					 * (a Pascal string). */
+
+  DEFINE_SIZE_ARRAY2 (2, glyphNameIndex, namesX);
+};
+
+struct post
+{
+  static const hb_tag_t tableTag = HB_OT_TAG_post;
+
+  inline bool sanitize (hb_sanitize_context_t *c) const
+  {
+    TRACE_SANITIZE (this);
+    if (unlikely (!c->check_struct (this)))
+      return_trace (false);
+    if (version.major == 2 && version.minor == 0)
+      return_trace (StructAtOffset<postV2Tail> (this, min_size).sanitize (c));
+    return_trace (true);
+  }
+
+  /* Returns the glyph name index table for version 2.0 tables, NULL
+   * otherwise.  The Pascal strings follow it up to the end of the table. */
+  inline const ArrayOf<USHORT> *get_v2_glyph_name_index (void) const
+  {
+    if (version.major != 2 || version.minor != 0)
+      return NULL;
+    return &StructAtOffset<postV2Tail> (this, min_size).glyphNameIndex;
+  }
+
+  public:
+  FixedVersion<>version;		/* 0x00010000 for version 1.0
+					 * 0x00020000 for version 2.0
+					 * 0x00025000 for version 2.5 (deprecated)
+					 * 0x00030000 for version 3.0 */
+  LONG		italicAngle;		/* Italic angle in counter-clockwise degrees
+					 * from the vertical. Zero for upright text,
+					 * negative for text that leans to the right
+					 * (forward). */
+  FWORD		underlinePosition;	/* This is the suggested distance of the top
+					 * of the underline from the baseline
+					 * (negative values indicate below baseline).
+					 * The PostScript definition of this FontInfo
+					 * dictionary key (the y coordinate of the
+					 * center of the stroke) is not used for
+					 * historical reasons. The value of the
+					 * PostScript key may be calculated by
+					 * subtracting half the underlineThickness
+					 * from the value of this field. */
+  FWORD		underlineThickness;	/* Suggested values for the underline
+					 * thickness. */
+  ULONG		isFixedPitch;		/* Set to 0 if the font is proportionally
+					 * spaced, non-zero if the font is not
+					 * proportionally spaced (i.e. monospaced). */
+  ULONG		minMemType42;		/* Minimum memory usage when an OpenType font
+					 * is downloaded. */
+  ULONG		maxMemType42;		/* Maximum memory usage when an OpenType font
+					 * is downloaded. */
+  ULONG		minMemType1;		/* Minimum memory usage when an OpenType font
+					 * is downloaded as a Type 1 font. */
+  ULONG		maxMemType1;		/* Maximum memory usage when an OpenType font
+					 * is downloaded as a Type 1 font. */
+  DEFINE_SIZE_STATIC (32);
+};
+
+} /* namespace OT */
+
+
+#endif /* HB_OT_POST_TABLE_HH */
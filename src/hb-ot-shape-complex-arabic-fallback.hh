@@ -44,310 +44,405 @@ static const hb_tag_t arabic_fallback_features[] =
   HB_TAG('r','l','i','g'),
 };
 
-static OT::SubstLookup *
-arabic_fallback_synthesize_lookup_single (const hb_ot_shape_plan_t *plan HB_UNUSED,
-					  hb_font_t *font,
-					  unsigned int feature_index)
-{
-  OT::GlyphID glyphs[SHAPING_TABLE_LAST - SHAPING_TABLE_FIRST + 1];
-  OT::GlyphID substitutes[SHAPING_TABLE_LAST - SHAPING_TABLE_FIRST + 1];
-  unsigned int num_glyphs = 0;
+#define ARABIC_FALLBACK_MAX_LOOKUPS 5
+#define ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS 4
+#define ARABIC_FALLBACK_MAX_SINGLES (SHAPING_TABLE_LAST - SHAPING_TABLE_FIRST + 1)
+/* We know that all our ligatures are 2-component. */
+#define ARABIC_FALLBACK_MAX_LIGATURES (ARRAY_LENGTH_CONST (ligature_table) * ARRAY_LENGTH_CONST (ligature_table[0].ligatures))
 
-  /* Populate arrays */
-  for (hb_codepoint_t u = SHAPING_TABLE_FIRST; u < SHAPING_TABLE_LAST + 1; u++)
-  {
-    hb_codepoint_t s = shaping_table[u - SHAPING_TABLE_FIRST][feature_index];
-    hb_codepoint_t u_glyph, s_glyph;
-
-    if (!s ||
-	!hb_font_get_glyph (font, u, 0, &u_glyph) ||
-	!hb_font_get_glyph (font, s, 0, &s_glyph) ||
-	u_glyph == s_glyph ||
-	u_glyph > 0xFFFFu || s_glyph > 0xFFFFu)
-      continue;
+#if (defined(_WIN32) || defined(__CYGWIN__)) && !defined(HB_NO_WIN1256)
+#define HB_WITH_WIN1256
+#endif
 
-    glyphs[num_glyphs].set (u_glyph);
-    substitutes[num_glyphs].set (s_glyph);
+#ifdef HB_WITH_WIN1256
+#include "hb-ot-shape-complex-arabic-win1256.hh"
+#endif
 
-    num_glyphs++;
-  }
+struct arabic_fallback_single_t
+{
+  uint16_t glyph;
+  uint16_t substitute;
 
-  if (!num_glyphs)
-    return NULL;
-
-  /* Bubble-sort or something equally good!
-   * May not be good-enough for presidential candidate interviews, but good-enough for us... */
-  hb_stable_sort (&glyphs[0], num_glyphs, OT::GlyphID::cmp, &substitutes[0]);
-
-  OT::Supplier<OT::GlyphID> glyphs_supplier      (glyphs, num_glyphs);
-  OT::Supplier<OT::GlyphID> substitutes_supplier (substitutes, num_glyphs);
-
-  /* Each glyph takes four bytes max, and there's some overhead. */
-  char buf[(SHAPING_TABLE_LAST - SHAPING_TABLE_FIRST + 1) * 4 + 128];
-  OT::hb_serialize_context_t c (buf, sizeof (buf));
-  OT::SubstLookup *lookup = c.start_serialize<OT::SubstLookup> ();
-  bool ret = lookup->serialize_single (&c,
-				       OT::LookupFlag::IgnoreMarks,
-				       glyphs_supplier,
-				       substitutes_supplier,
-				       num_glyphs);
-  c.end_serialize ();
-  /* TODO sanitize the results? */
-
-  return ret ? c.copy<OT::SubstLookup> () : NULL;
-}
+  static inline int cmp (const arabic_fallback_single_t *a, const arabic_fallback_single_t *b)
+  { return (int) a->glyph - (int) b->glyph; }
+};
 
-static OT::SubstLookup *
-arabic_fallback_synthesize_lookup_ligature (const hb_ot_shape_plan_t *plan HB_UNUSED,
-					    hb_font_t *font)
+struct arabic_fallback_ligature_t
 {
-  OT::GlyphID first_glyphs[ARRAY_LENGTH_CONST (ligature_table)];
-  unsigned int first_glyphs_indirection[ARRAY_LENGTH_CONST (ligature_table)];
-  unsigned int ligature_per_first_glyph_count_list[ARRAY_LENGTH_CONST (first_glyphs)];
-  unsigned int num_first_glyphs = 0;
+  uint16_t first;
+  uint16_t second;
+  uint16_t ligature;
 
-  /* We know that all our ligatures are 2-component */
-  OT::GlyphID ligature_list[ARRAY_LENGTH_CONST (first_glyphs) * ARRAY_LENGTH_CONST(ligature_table[0].ligatures)];
-  unsigned int component_count_list[ARRAY_LENGTH_CONST (ligature_list)];
-  OT::GlyphID component_list[ARRAY_LENGTH_CONST (ligature_list) * 1/* One extra component per ligature */];
-  unsigned int num_ligatures = 0;
+  static inline int cmp (const arabic_fallback_ligature_t *a, const arabic_fallback_ligature_t *b)
+  { return (int) a->first - (int) b->first; }
+};
 
-  /* Populate arrays */
+/*
+ * The fallback lookups only depend on the glyphs the font maps the Arabic
+ * characters and presentation forms to, so they are built once per face,
+ * from the first font shaped with (or passed to hb_ot_shape_fallback_prepare()),
+ * and shared by all shape plans and fonts of the face.  Fonts of one face
+ * are assumed to map characters to glyphs the same way.
+ *
+ * Instead of serializing OpenType lookups and building accelerators for
+ * them, the synthesized single substitutions are kept as sorted
+ * glyph/substitute pairs, and the ligatures as sorted first/second/ligature
+ * triplets, both applied directly below.
+ */
+struct arabic_fallback_face_t
+{
+  ASSERT_POD ();
+
+  unsigned int num_singles[ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS];
+  unsigned int num_ligatures;
+  hb_set_digest_t digests[ARABIC_FALLBACK_MAX_LOOKUPS];
 
-  /* Sort out the first-glyphs */
-  for (unsigned int first_glyph_idx = 0; first_glyph_idx < ARRAY_LENGTH (first_glyphs); first_glyph_idx++)
+  arabic_fallback_single_t singles[ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS][ARABIC_FALLBACK_MAX_SINGLES];
+  arabic_fallback_ligature_t ligatures[ARABIC_FALLBACK_MAX_LIGATURES];
+
+#ifdef HB_WITH_WIN1256
+  /* Only used if the font has none of the presentation forms. */
+  unsigned int num_win1256_lookups;
+  hb_tag_t win1256_tags[ARABIC_FALLBACK_MAX_LOOKUPS];
+  const OT::SubstLookup *win1256_lookups[ARABIC_FALLBACK_MAX_LOOKUPS];
+  hb_ot_layout_lookup_accelerator_t win1256_accels[ARABIC_FALLBACK_MAX_LOOKUPS];
+#endif
+
+  inline bool has_unicode_lookups (void) const
   {
-    hb_codepoint_t first_u = ligature_table[first_glyph_idx].first;
-    hb_codepoint_t first_glyph;
-    if (!hb_font_get_glyph (font, first_u, 0, &first_glyph))
-      continue;
-    first_glyphs[num_first_glyphs].set (first_glyph);
-    ligature_per_first_glyph_count_list[num_first_glyphs] = 0;
-    first_glyphs_indirection[num_first_glyphs] = first_glyph_idx;
-    num_first_glyphs++;
+    for (unsigned int i = 0; i < ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS; i++)
+      if (num_singles[i])
+        return true;
+    return num_ligatures;
   }
-  hb_stable_sort (&first_glyphs[0], num_first_glyphs, OT::GlyphID::cmp, &first_glyphs_indirection[0]);
+};
+
+static const arabic_fallback_face_t arabic_fallback_face_nil = {};
+
 
-  /* Now that the first-glyphs are sorted, walk again, populate ligatures. */
-  for (unsigned int i = 0; i < num_first_glyphs; i++)
+static void
+arabic_fallback_synthesize_single (arabic_fallback_face_t *fallback_face,
+				   hb_font_t *font)
+{
+  for (hb_codepoint_t u = SHAPING_TABLE_FIRST; u < SHAPING_TABLE_LAST + 1; u++)
   {
-    unsigned int first_glyph_idx = first_glyphs_indirection[i];
+    hb_codepoint_t u_glyph;
+    if (!font->get_nominal_glyph (u, &u_glyph) || u_glyph > 0xFFFFu)
+      continue;
 
-    for (unsigned int second_glyph_idx = 0; second_glyph_idx < ARRAY_LENGTH (ligature_table[0].ligatures); second_glyph_idx++)
+    for (unsigned int i = 0; i < ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS; i++)
     {
-      hb_codepoint_t second_u   = ligature_table[first_glyph_idx].ligatures[second_glyph_idx].second;
-      hb_codepoint_t ligature_u = ligature_table[first_glyph_idx].ligatures[second_glyph_idx].ligature;
-      hb_codepoint_t second_glyph, ligature_glyph;
-      if (!second_u ||
-	  !hb_font_get_glyph (font, second_u,   0, &second_glyph) ||
-	  !hb_font_get_glyph (font, ligature_u, 0, &ligature_glyph))
-	continue;
+      hb_codepoint_t s = shaping_table[u - SHAPING_TABLE_FIRST][i];
+      hb_codepoint_t s_glyph;
 
-      ligature_per_first_glyph_count_list[i]++;
+      if (!s ||
+	  !font->get_nominal_glyph (s, &s_glyph) ||
+	  u_glyph == s_glyph ||
+	  s_glyph > 0xFFFFu)
+	continue;
 
-      ligature_list[num_ligatures].set (ligature_glyph);
-      component_count_list[num_ligatures] = 2;
-      component_list[num_ligatures].set (second_glyph);
-      num_ligatures++;
+      arabic_fallback_single_t *single = &fallback_face->singles[i][fallback_face->num_singles[i]++];
+      single->glyph = u_glyph;
+      single->substitute = s_glyph;
+      fallback_face->digests[i].add (u_glyph);
     }
   }
 
-  if (!num_ligatures)
-    return NULL;
-
-  OT::Supplier<OT::GlyphID>   first_glyphs_supplier                      (first_glyphs, num_first_glyphs);
-  OT::Supplier<unsigned int > ligature_per_first_glyph_count_supplier    (ligature_per_first_glyph_count_list, num_first_glyphs);
-  OT::Supplier<OT::GlyphID>   ligatures_supplier                         (ligature_list, num_ligatures);
-  OT::Supplier<unsigned int > component_count_supplier                   (component_count_list, num_ligatures);
-  OT::Supplier<OT::GlyphID>   component_supplier                         (component_list, num_ligatures);
-
-  /* 16 bytes per ligature ought to be enough... */
-  char buf[ARRAY_LENGTH_CONST (ligature_list) * 16 + 128];
-  OT::hb_serialize_context_t c (buf, sizeof (buf));
-  OT::SubstLookup *lookup = c.start_serialize<OT::SubstLookup> ();
-  bool ret = lookup->serialize_ligature (&c,
-					 OT::LookupFlag::IgnoreMarks,
-					 first_glyphs_supplier,
-					 ligature_per_first_glyph_count_supplier,
-					 num_first_glyphs,
-					 ligatures_supplier,
-					 component_count_supplier,
-					 component_supplier);
-
-  c.end_serialize ();
-  /* TODO sanitize the results? */
-
-  return ret ? c.copy<OT::SubstLookup> () : NULL;
+  for (unsigned int i = 0; i < ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS; i++)
+    hb_stable_sort (fallback_face->singles[i], fallback_face->num_singles[i], arabic_fallback_single_t::cmp);
 }
 
-static OT::SubstLookup *
-arabic_fallback_synthesize_lookup (const hb_ot_shape_plan_t *plan,
-				   hb_font_t *font,
-				   unsigned int feature_index)
-{
-  if (feature_index < 4)
-    return arabic_fallback_synthesize_lookup_single (plan, font, feature_index);
-  else
-    return arabic_fallback_synthesize_lookup_ligature (plan, font);
-}
-
-#define ARABIC_FALLBACK_MAX_LOOKUPS 5
-
-struct arabic_fallback_plan_t
+static void
+arabic_fallback_synthesize_ligature (arabic_fallback_face_t *fallback_face,
+				     hb_font_t *font)
 {
-  ASSERT_POD ();
-
-  unsigned int num_lookups;
-  bool free_lookups;
+  for (unsigned int first_idx = 0; first_idx < ARRAY_LENGTH (ligature_table); first_idx++)
+  {
+    hb_codepoint_t first_glyph;
+    if (!font->get_nominal_glyph (ligature_table[first_idx].first, &first_glyph) ||
+	first_glyph > 0xFFFFu)
+      continue;
 
-  hb_mask_t mask_array[ARABIC_FALLBACK_MAX_LOOKUPS];
-  OT::SubstLookup *lookup_array[ARABIC_FALLBACK_MAX_LOOKUPS];
-  hb_ot_layout_lookup_accelerator_t accel_array[ARABIC_FALLBACK_MAX_LOOKUPS];
-};
+    for (unsigned int second_idx = 0; second_idx < ARRAY_LENGTH (ligature_table[0].ligatures); second_idx++)
+    {
+      hb_codepoint_t second_u   = ligature_table[first_idx].ligatures[second_idx].second;
+      hb_codepoint_t ligature_u = ligature_table[first_idx].ligatures[second_idx].ligature;
+      hb_codepoint_t second_glyph, ligature_glyph;
+      if (!second_u ||
+	  !font->get_nominal_glyph (second_u,   &second_glyph) ||
+	  !font->get_nominal_glyph (ligature_u, &ligature_glyph) ||
+	  second_glyph > 0xFFFFu || ligature_glyph > 0xFFFFu)
+	continue;
 
-static const arabic_fallback_plan_t arabic_fallback_plan_nil = {};
+      arabic_fallback_ligature_t *ligature = &fallback_face->ligatures[fallback_face->num_ligatures++];
+      ligature->first = first_glyph;
+      ligature->second = second_glyph;
+      ligature->ligature = ligature_glyph;
+      fallback_face->digests[ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS].add (first_glyph);
+    }
+  }
 
-#if (defined(_WIN32) || defined(__CYGWIN__)) && !defined(HB_NO_WIN1256)
-#define HB_WITH_WIN1256
-#endif
+  /* Stable, so ligatures of one first glyph are tried in table order. */
+  hb_stable_sort (fallback_face->ligatures, fallback_face->num_ligatures, arabic_fallback_ligature_t::cmp);
+}
 
 #ifdef HB_WITH_WIN1256
-#include "hb-ot-shape-complex-arabic-win1256.hh"
-#endif
-
 struct ManifestLookup {
   OT::Tag tag;
   OT::OffsetTo<OT::SubstLookup> lookupOffset;
 };
 typedef OT::ArrayOf<ManifestLookup> Manifest;
 
-static bool
-arabic_fallback_plan_init_win1256 (arabic_fallback_plan_t *fallback_plan,
-				   const hb_ot_shape_plan_t *plan,
-				   hb_font_t *font)
+static void
+arabic_fallback_init_win1256 (arabic_fallback_face_t *fallback_face,
+			      hb_font_t *font)
 {
-#ifdef HB_WITH_WIN1256
   /* Does this font look like it's Windows-1256-encoded? */
   hb_codepoint_t g;
-  if (!(hb_font_get_glyph (font, 0x0627u, 0, &g) && g == 199 /* ALEF */ &&
-	hb_font_get_glyph (font, 0x0644u, 0, &g) && g == 225 /* LAM */ &&
-	hb_font_get_glyph (font, 0x0649u, 0, &g) && g == 236 /* ALEF MAKSURA */ &&
-	hb_font_get_glyph (font, 0x064Au, 0, &g) && g == 237 /* YEH */ &&
-	hb_font_get_glyph (font, 0x0652u, 0, &g) && g == 250 /* SUKUN */))
-    return false;
+  if (!(font->get_nominal_glyph (0x0627u, &g) && g == 199 /* ALEF */ &&
+	font->get_nominal_glyph (0x0644u, &g) && g == 225 /* LAM */ &&
+	font->get_nominal_glyph (0x0649u, &g) && g == 236 /* ALEF MAKSURA */ &&
+	font->get_nominal_glyph (0x064Au, &g) && g == 237 /* YEH */ &&
+	font->get_nominal_glyph (0x0652u, &g) && g == 250 /* SUKUN */))
+    return;
 
   const Manifest &manifest = reinterpret_cast<const Manifest&> (arabic_win1256_gsub_lookups.manifest);
   ASSERT_STATIC (sizeof (arabic_win1256_gsub_lookups.manifestData) / sizeof (ManifestLookup)
 		 <= ARABIC_FALLBACK_MAX_LOOKUPS);
   /* TODO sanitize the table? */
 
-  unsigned j = 0;
+  unsigned int j = 0;
   unsigned int count = manifest.len;
   for (unsigned int i = 0; i < count; i++)
   {
-    fallback_plan->mask_array[j] = plan->map.get_1_mask (manifest[i].tag);
-    if (fallback_plan->mask_array[j])
-    {
-      fallback_plan->lookup_array[j] = const_cast<OT::SubstLookup*> (&(&manifest+manifest[i].lookupOffset));
-      if (fallback_plan->lookup_array[j])
-      {
-	fallback_plan->accel_array[j].init (*fallback_plan->lookup_array[j]);
-	j++;
-      }
-    }
+    const OT::SubstLookup &lookup = &manifest+manifest[i].lookupOffset;
+    fallback_face->win1256_tags[j] = manifest[i].tag;
+    fallback_face->win1256_lookups[j] = &lookup;
+    fallback_face->win1256_accels[j].init (lookup);
+    j++;
   }
+  fallback_face->num_win1256_lookups = j;
+}
+#endif
 
-  fallback_plan->num_lookups = j;
-  fallback_plan->free_lookups = false;
+static arabic_fallback_face_t *
+arabic_fallback_face_create (hb_font_t *font)
+{
+  arabic_fallback_face_t *fallback_face = (arabic_fallback_face_t *) calloc (1, sizeof (arabic_fallback_face_t));
+  if (unlikely (!fallback_face))
+    return const_cast<arabic_fallback_face_t *> (&arabic_fallback_face_nil);
 
-  return j > 0;
-#else
-  return false;
+  for (unsigned int i = 0; i < ARABIC_FALLBACK_MAX_LOOKUPS; i++)
+    fallback_face->digests[i].init ();
+
+  /* Try synthesizing GSUB lookups using Unicode Arabic Presentation Forms,
+   * in case the font has cmap entries for the presentation-forms characters. */
+  arabic_fallback_synthesize_single (fallback_face, font);
+  arabic_fallback_synthesize_ligature (fallback_face, font);
+
+#ifdef HB_WITH_WIN1256
+  /* See if this looks like a Windows-1256-encoded font.  If it does, use a
+   * hand-coded GSUB table. */
+  if (!fallback_face->has_unicode_lookups ())
+    arabic_fallback_init_win1256 (fallback_face, font);
 #endif
+
+  return fallback_face;
 }
 
-static bool
-arabic_fallback_plan_init_unicode (arabic_fallback_plan_t *fallback_plan,
-				   const hb_ot_shape_plan_t *plan,
-				   hb_font_t *font)
+void
+arabic_fallback_face_destroy (arabic_fallback_face_t *fallback_face)
 {
-  ASSERT_STATIC (ARRAY_LENGTH_CONST(arabic_fallback_features) <= ARABIC_FALLBACK_MAX_LOOKUPS);
-  unsigned int j = 0;
-  for (unsigned int i = 0; i < ARRAY_LENGTH(arabic_fallback_features) ; i++)
+  if (!fallback_face || fallback_face == &arabic_fallback_face_nil)
+    return;
+
+#ifdef HB_WITH_WIN1256
+  for (unsigned int i = 0; i < fallback_face->num_win1256_lookups; i++)
+    fallback_face->win1256_accels[i].fini ();
+#endif
+
+  free (fallback_face);
+}
+
+/* The ot shaper data of the face must have been created already. */
+static const arabic_fallback_face_t *
+arabic_fallback_face_get (hb_font_t *font)
+{
+  hb_ot_layout_t *layout = hb_ot_layout_from_face (font->face);
+
+retry:
+  arabic_fallback_face_t *fallback_face = (arabic_fallback_face_t *) hb_atomic_ptr_get (&layout->arabic_fallback);
+  if (unlikely (!fallback_face))
   {
-    fallback_plan->mask_array[j] = plan->map.get_1_mask (arabic_fallback_features[i]);
-    if (fallback_plan->mask_array[j])
-    {
-      fallback_plan->lookup_array[j] = arabic_fallback_synthesize_lookup (plan, font, i);
-      if (fallback_plan->lookup_array[j])
-      {
-	fallback_plan->accel_array[j].init (*fallback_plan->lookup_array[j]);
-	j++;
-      }
+    fallback_face = arabic_fallback_face_create (font);
+    if (unlikely (!hb_atomic_ptr_cmpexch (&layout->arabic_fallback, NULL, fallback_face))) {
+      arabic_fallback_face_destroy (fallback_face);
+      goto retry;
     }
   }
 
-  fallback_plan->num_lookups = j;
-  fallback_plan->free_lookups = true;
-
-  return j > 0;
+  return fallback_face;
 }
 
-static arabic_fallback_plan_t *
-arabic_fallback_plan_create (const hb_ot_shape_plan_t *plan,
-			     hb_font_t *font)
+
+static void
+arabic_fallback_apply_single (OT::hb_apply_context_t *c,
+			      const arabic_fallback_face_t *fallback_face,
+			      unsigned int lookup_index)
 {
-  arabic_fallback_plan_t *fallback_plan = (arabic_fallback_plan_t *) calloc (1, sizeof (arabic_fallback_plan_t));
-  if (unlikely (!fallback_plan))
-    return const_cast<arabic_fallback_plan_t *> (&arabic_fallback_plan_nil);
+  const arabic_fallback_single_t *singles = fallback_face->singles[lookup_index];
+  unsigned int num_singles = fallback_face->num_singles[lookup_index];
+  const hb_set_digest_t &digest = fallback_face->digests[lookup_index];
+
+  /* Single substitutions are done in-place, without going through the
+   * output buffer. */
+  hb_buffer_t *buffer = c->buffer;
+  unsigned int count = buffer->len;
+  for (buffer->idx = 0; buffer->idx < count; buffer->idx++)
+  {
+    const hb_glyph_info_t &cur = buffer->cur();
+    if (!digest.may_have (cur.codepoint) ||
+	!(cur.mask & c->lookup_mask) ||
+	!c->check_glyph_property (&cur, c->lookup_props))
+      continue;
+
+    unsigned int lo = 0, hi = num_singles;
+    while (lo < hi)
+    {
+      unsigned int mid = (lo + hi) / 2;
+      if (singles[mid].glyph < cur.codepoint)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+    if (lo < num_singles && singles[lo].glyph == cur.codepoint)
+      c->replace_glyph_inplace (singles[lo].substitute);
+  }
+  buffer->idx = 0;
+}
 
-  fallback_plan->num_lookups = 0;
-  fallback_plan->free_lookups = false;
+static bool
+arabic_fallback_ligate (OT::hb_apply_context_t *c,
+			const arabic_fallback_ligature_t *ligatures,
+			unsigned int num_ligatures)
+{
+  hb_codepoint_t first = c->buffer->cur().codepoint;
 
-  /* Try synthesizing GSUB table using Unicode Arabic Presentation Forms,
-   * in case the font has cmap entries for the presentation-forms characters. */
-  if (arabic_fallback_plan_init_unicode (fallback_plan, plan, font))
-    return fallback_plan;
+  unsigned int lo = 0, hi = num_ligatures;
+  while (lo < hi)
+  {
+    unsigned int mid = (lo + hi) / 2;
+    if (ligatures[mid].first < first)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
 
-  /* See if this looks like a Windows-1256-encoded font.  If it does, use a
-   * hand-coded GSUB table. */
-  if (arabic_fallback_plan_init_win1256 (fallback_plan, plan, font))
-    return fallback_plan;
+  /* Same as OT::Ligature::apply(). */
+  for (unsigned int i = lo; i < num_ligatures && ligatures[i].first == first; i++)
+  {
+    OT::USHORT second;
+    second.set (ligatures[i].second);
+
+    bool is_mark_ligature = false;
+    unsigned int total_component_count = 0;
+    unsigned int match_length = 0;
+    unsigned int match_positions[HB_MAX_CONTEXT_LENGTH];
+
+    if (OT::match_input (c, 2,
+			 &second,
+			 OT::match_glyph,
+			 NULL,
+			 &match_length,
+			 match_positions,
+			 &is_mark_ligature,
+			 &total_component_count))
+    {
+      OT::ligate_input (c,
+			2,
+			match_positions,
+			match_length,
+			ligatures[i].ligature,
+			is_mark_ligature,
+			total_component_count);
+      return true;
+    }
+  }
 
-  free (fallback_plan);
-  return const_cast<arabic_fallback_plan_t *> (&arabic_fallback_plan_nil);
+  return false;
 }
 
 static void
-arabic_fallback_plan_destroy (arabic_fallback_plan_t *fallback_plan)
+arabic_fallback_apply_ligature (OT::hb_apply_context_t *c,
+				const arabic_fallback_face_t *fallback_face)
 {
-  if (!fallback_plan || fallback_plan == &arabic_fallback_plan_nil)
-    return;
+  const hb_set_digest_t &digest = fallback_face->digests[ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS];
 
-  for (unsigned int i = 0; i < fallback_plan->num_lookups; i++)
-    if (fallback_plan->lookup_array[i])
-    {
-      fallback_plan->accel_array[i].fini ();
-      if (fallback_plan->free_lookups)
-	free (fallback_plan->lookup_array[i]);
-    }
+  hb_buffer_t *buffer = c->buffer;
+  buffer->clear_output ();
+  buffer->idx = 0;
+
+  bool ret = false;
+  while (buffer->idx < buffer->len && !buffer->in_error)
+  {
+    const hb_glyph_info_t &cur = buffer->cur();
+    if (digest.may_have (cur.codepoint) &&
+	(cur.mask & c->lookup_mask) &&
+	c->check_glyph_property (&cur, c->lookup_props) &&
+	arabic_fallback_ligate (c, fallback_face->ligatures, fallback_face->num_ligatures))
+      ret = true;
+    else
+      buffer->next_glyph ();
+  }
 
-  free (fallback_plan);
+  if (ret)
+    buffer->swap_buffers ();
 }
 
+/* mask_array has the plan's masks for arabic_fallback_features. */
 static void
-arabic_fallback_plan_shape (arabic_fallback_plan_t *fallback_plan,
+arabic_fallback_shape_face (const arabic_fallback_face_t *fallback_face,
+			    const hb_ot_shape_plan_t *plan HB_UNUSED,
+			    const hb_mask_t mask_array[ARABIC_FALLBACK_MAX_LOOKUPS],
 			    hb_font_t *font,
 			    hb_buffer_t *buffer)
 {
+  if (unlikely (!buffer->len))
+    return;
+
   OT::hb_apply_context_t c (0, font, buffer);
-  for (unsigned int i = 0; i < fallback_plan->num_lookups; i++)
-    if (fallback_plan->lookup_array[i]) {
-      c.set_lookup_mask (fallback_plan->mask_array[i]);
-      hb_ot_layout_substitute_lookup (&c,
-				      *fallback_plan->lookup_array[i],
-				      fallback_plan->accel_array[i]);
+
+  if (fallback_face->has_unicode_lookups ())
+  {
+    for (unsigned int i = 0; i < ARABIC_FALLBACK_MAX_LOOKUPS; i++)
+    {
+      if (!mask_array[i])
+	continue;
+      c.set_lookup_mask (mask_array[i]);
+      c.set_lookup_props (OT::LookupFlag::IgnoreMarks);
+      if (i < ARABIC_FALLBACK_NUM_SINGLE_LOOKUPS)
+      {
+	if (fallback_face->num_singles[i])
+	  arabic_fallback_apply_single (&c, fallback_face, i);
+      }
+      else if (fallback_face->num_ligatures)
+	arabic_fallback_apply_ligature (&c, fallback_face);
     }
+    return;
+  }
+
+#ifdef HB_WITH_WIN1256
+  for (unsigned int i = 0; i < fallback_face->num_win1256_lookups; i++)
+  {
+    hb_mask_t mask = plan->map.get_1_mask (fallback_face->win1256_tags[i]);
+    if (!mask)
+      continue;
+    c.set_lookup_mask (mask);
+    hb_ot_layout_substitute_lookup (&c,
+				    *fallback_face->win1256_lookups[i],
+				    fallback_face->win1256_accels[i]);
+  }
+#endif
 }
 
 
@@ -47,4 +47,9 @@ setup_masks_arabic_plan (const arabic_shape_plan_t *arabic_plan,
 			 hb_buffer_t               *buffer,
 			 hb_script_t                script);
 
+/* Builds the fallback lookups for the face of font, if not built yet.
+ * Returns false on allocation failure. */
+HB_INTERNAL bool
+arabic_fallback_prepare (hb_font_t *font);
+
 #endif /* HB_OT_SHAPE_COMPLEX_ARABIC_PRIVATE_HH */
@@ -26,136 +26,144 @@
 #define C	JOINING_TYPE_C
 #define D	JOINING_TYPE_D
 
+#define _(A,B)	((A) | ((B) << 4))
+
 static const uint8_t joining_table[] =
 {
 
-#define joining_offset_0x0600u 0
+  /* 0000 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0020 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0040 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0060 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* Arabic */
 
-  /* 0600 */ U,U,U,U,U,U,X,X,U,X,X,U,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 0620 */ D,U,R,R,R,R,D,R,D,R,D,D,D,D,D,R,R,R,R,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* 0640 */ C,D,D,D,D,D,D,D,R,D,D,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 0660 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,D,D,X,R,R,R,U,R,R,R,D,D,D,D,D,D,D,D,
-  /* 0680 */ D,D,D,D,D,D,D,D,R,R,R,R,R,R,R,R,R,R,R,R,R,R,R,R,R,R,D,D,D,D,D,D,
-  /* 06A0 */ D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* 06C0 */ R,D,D,R,R,R,R,R,R,R,R,R,D,R,D,R,D,D,R,R,X,R,X,X,X,X,X,X,X,U,X,X,
-  /* 06E0 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,R,R,X,X,X,X,X,X,X,X,X,X,D,D,D,X,X,D,
-
-  /* Syriac */
-
-  /* 0700 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,A,X,D,D,D,DR,DR,R,R,R,D,D,D,D,R,D,
-  /* 0720 */ D,D,D,D,D,D,D,D,R,D,DR,D,R,D,D,DR,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 0740 */ X,X,X,X,X,X,X,X,X,X,X,X,X,R,D,D,
-
-  /* Arabic Supplement */
+  /* 0600 */ _(U,U),_(U,U),_(U,U),_(X,X),_(U,X),_(X,U),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0620 */ _(D,U),_(R,R),_(R,R),_(D,R),_(D,R),_(D,D),_(D,D),_(D,R),_(R,R),_(R,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* 0640 */ _(C,D),_(D,D),_(D,D),_(D,D),_(R,D),_(D,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0660 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(D,D),_(X,R),_(R,R),_(U,R),_(R,R),_(D,D),_(D,D),_(D,D),_(D,D),
 
-  /* 0740 */                                 D,D,D,D,D,D,D,D,D,R,R,R,D,D,D,D,
-  /* 0760 */ D,D,D,D,D,D,D,D,D,D,D,R,R,D,D,D,D,R,D,R,R,D,D,D,R,R,D,D,D,D,D,D,
+  /* 0680 */ _(D,D),_(D,D),_(D,D),_(D,D),_(R,R),_(R,R),_(R,R),_(R,R),_(R,R),_(R,R),_(R,R),_(R,R),_(R,R),_(D,D),_(D,D),_(D,D),
+  /* 06A0 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* 06C0 */ _(R,D),_(D,R),_(R,R),_(R,R),_(R,R),_(R,R),_(D,R),_(D,R),_(D,D),_(R,R),_(X,R),_(X,X),_(X,X),_(X,X),_(X,U),_(X,X),
+  /* 06E0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(R,R),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(D,D),_(D,X),_(X,D),
 
-  /* FILLER */
+  /* Syriac */
 
-  /* 0780 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 07A0 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
+  /* 0700 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(A,X),_(D,D),_(D,DR),_(DR,R),_(R,R),_(D,D),_(D,D),_(R,D),
+  /* 0720 */ _(D,D),_(D,D),_(D,D),_(D,D),_(R,D),_(DR,D),_(R,D),_(D,DR),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0740 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,R),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,R),_(R,R),_(D,D),_(D,D),
+  /* 0760 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,R),_(R,D),_(D,D),_(D,R),_(D,R),_(R,D),_(D,D),_(R,R),_(D,D),_(D,D),_(D,D),
 
   /* NKo */
 
-  /* 07C0 */ X,X,X,X,X,X,X,X,X,X,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* 07E0 */ D,D,D,D,D,D,D,D,D,D,D,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,C,X,X,X,X,X,
-
-  /* FILLER */
-
-  /* 0800 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 0820 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
+  /* 0780 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 07A0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 07C0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* 07E0 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(C,X),_(X,X),_(X,X),
 
   /* Mandaic */
 
-  /* 0840 */ R,D,D,D,D,D,R,R,D,R,D,D,D,D,D,D,D,D,D,D,R,D,U,U,U,X,X,X,X,X,X,X,
-  /* 0860 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 0880 */ X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
+  /* 0800 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0820 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 0840 */ _(R,D),_(D,D),_(D,D),_(R,R),_(D,R),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(R,D),_(U,U),_(U,X),_(X,X),_(X,X),_(X,X),
+  /* 0860 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* Arabic Extended-A */
 
-  /* 08A0 */ D,D,D,D,D,D,D,D,D,D,R,R,R,U,R,D,D,R,R,D,D,
-
-#define joining_offset_0x1806u 693
+  /* 0880 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 08A0 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(R,R),_(R,U),_(R,D),_(D,R),_(R,D),_(D,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 08C0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 08E0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* Mongolian */
 
-  /* 1800 */             U,D,X,X,C,X,X,X,U,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 1820 */ D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* 1840 */ D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* 1860 */ D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,X,X,X,X,X,X,X,X,
-  /* 1880 */ U,U,U,U,U,U,U,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* 18A0 */ D,D,D,D,D,D,D,D,D,X,D,
+  /* 1800 */ _(X,X),_(X,X),_(X,X),_(U,D),_(X,X),_(C,X),_(X,X),_(U,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 1820 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* 1840 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* 1860 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(X,X),_(X,X),_(X,X),_(X,X),
 
-#define joining_offset_0x200cu 858
+  /* 1880 */ _(U,U),_(U,U),_(U,U),_(U,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* 18A0 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,X),_(D,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 18C0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 18E0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* General Punctuation */
 
-  /* 2000 */                         U,C,
-
-#define joining_offset_0x2066u 860
-
-  /* General Punctuation */
-
-  /* 2060 */             U,U,U,U,
-
-#define joining_offset_0xa840u 864
+  /* 2000 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(U,C),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 2020 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 2040 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 2060 */ _(X,X),_(X,X),_(X,X),_(U,U),_(U,U),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* Phags-pa */
 
-  /* A840 */ D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,
-  /* A860 */ D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,D,L,U,
-
-#define joining_offset_0x10ac0u 916
+  /* A800 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* A820 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* A840 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),
+  /* A860 */ _(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(D,D),_(L,U),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* Manichaean */
 
-  /* 10AC0 */ D,D,D,D,D,R,U,R,U,R,R,U,U,L,R,R,R,R,R,D,D,D,D,L,D,D,D,D,D,R,D,D,
-  /* 10AE0 */ D,R,U,U,R,X,X,X,X,X,X,D,D,D,D,R,
-
-#define joining_offset_0x10b80u 964
+  /* 10A80 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 10AA0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 10AC0 */ _(D,D),_(D,D),_(D,R),_(U,R),_(U,R),_(R,U),_(U,L),_(R,R),_(R,R),_(R,D),_(D,D),_(D,L),_(D,D),_(D,D),_(D,R),_(D,D),
+  /* 10AE0 */ _(D,R),_(U,U),_(R,X),_(X,X),_(X,X),_(X,D),_(D,D),_(D,R),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
   /* Psalter Pahlavi */
 
-  /* 10B80 */ D,R,D,R,R,R,D,D,D,R,D,D,R,D,R,R,D,R,X,X,X,X,X,X,X,X,X,X,X,X,X,X,
-  /* 10BA0 */ X,X,X,X,X,X,X,X,X,R,R,R,R,D,D,U,
+  /* 10B80 */ _(D,R),_(D,R),_(R,R),_(D,D),_(D,R),_(D,D),_(R,D),_(R,R),_(D,R),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 10BA0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,R),_(R,R),_(R,D),_(D,U),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 10BC0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
+  /* 10BE0 */ _(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),_(X,X),
 
-}; /* Table items: 1012; occupancy: 57% */
+}; /* Table items: 1664; blocks: 13 */
 
-
-static unsigned int
+static const uint8_t joining_index[] =
+{
+  /* 00000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  3,  4,
+  /* 00800 */   5,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 01000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 01800 */   7,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 02000 */   9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 02800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 03000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 03800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 04000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 04800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 05000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 05800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 06000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 06800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 07000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 07800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 08000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 08800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 09000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 09800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0A000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0A800 */  10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0B000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0B800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0C000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0C800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0D000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0D800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0E000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0E800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0F000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0F800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 10000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 10800 */   0,  0,  0,  0,  0, 11,  0, 12,  0,
+}; /* Table size: 1369 bytes */
+
+#undef _
+
+static inline unsigned int
 joining_type (hb_codepoint_t u)
 {
-  switch (u >> 12)
-  {
-    case 0x0u:
-      if (hb_in_range (u, 0x0600u, 0x08B4u)) return joining_table[u - 0x0600u + joining_offset_0x0600u];
-      break;
-
-    case 0x1u:
-      if (hb_in_range (u, 0x1806u, 0x18AAu)) return joining_table[u - 0x1806u + joining_offset_0x1806u];
-      break;
-
-    case 0x2u:
-      if (hb_in_range (u, 0x200Cu, 0x200Du)) return joining_table[u - 0x200Cu + joining_offset_0x200cu];
-      if (hb_in_range (u, 0x2066u, 0x2069u)) return joining_table[u - 0x2066u + joining_offset_0x2066u];
-      break;
-
-    case 0xAu:
-      if (hb_in_range (u, 0xA840u, 0xA873u)) return joining_table[u - 0xA840u + joining_offset_0xa840u];
-      break;
-
-    case 0x10u:
-      if (hb_in_range (u, 0x10AC0u, 0x10AEFu)) return joining_table[u - 0x10AC0u + joining_offset_0x10ac0u];
-      if (hb_in_range (u, 0x10B80u, 0x10BAFu)) return joining_table[u - 0x10B80u + joining_offset_0x10b80u];
-      break;
-
-    default:
-      break;
-  }
-  return X;
+  u = MIN (u, 0x10C00u);
+  unsigned int i = (joining_index[u >> 7] << 7) + (u & 127);
+  return (joining_table[i >> 1] >> ((i & 1) << 2)) & 15;
 }
 
 #undef X
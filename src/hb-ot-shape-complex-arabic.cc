@@ -249,7 +249,8 @@ struct arabic_shape_plan_t
    * mask_array[NONE] == 0. */
   hb_mask_t mask_array[ARABIC_NUM_FEATURES + 1];
 
-  arabic_fallback_plan_t *fallback_plan;
+  /* Masks of arabic_fallback_features; only set if do_fallback. */
+  hb_mask_t fallback_mask_array[ARABIC_FALLBACK_MAX_LOOKUPS];
 
   unsigned int do_fallback : 1;
   unsigned int has_stch : 1;
@@ -270,6 +271,9 @@ data_create_arabic (const hb_ot_shape_plan_t *plan)
 			       (FEATURE_IS_SYRIAC (arabic_features[i]) ||
 			        plan->map.needs_fallback (arabic_features[i]));
   }
+  if (arabic_plan->do_fallback)
+    for (unsigned int i = 0; i < ARRAY_LENGTH (arabic_fallback_features); i++)
+      arabic_plan->fallback_mask_array[i] = plan->map.get_1_mask (arabic_fallback_features[i]);
 
   return arabic_plan;
 }
@@ -277,10 +281,6 @@ data_create_arabic (const hb_ot_shape_plan_t *plan)
 void
 data_destroy_arabic (void *data)
 {
-  arabic_shape_plan_t *arabic_plan = (arabic_shape_plan_t *) data;
-
-  arabic_fallback_plan_destroy (arabic_plan->fallback_plan);
-
   free (data);
 }
 
@@ -304,24 +304,37 @@ arabic_joining (hb_buffer_t *buffer)
     break;
   }
 
-  for (unsigned int i = 0; i < count; i++)
+  /* Classify a chunk of glyphs first, then run the state machine over it;
+   * the table lookups do not depend on the state, so they can overlap. */
+  uint8_t types[64];
+  for (unsigned int start = 0; start < count; start += ARRAY_LENGTH (types))
   {
-    unsigned int this_type = get_joining_type (info[i].codepoint, _hb_glyph_info_get_general_category (&info[i]));
+    unsigned int end = MIN (count, start + ARRAY_LENGTH (types));
+    for (unsigned int i = start; i < end; i++)
+      types[i - start] = get_joining_type (info[i].codepoint, _hb_glyph_info_get_general_category (&info[i]));
 
-    if (unlikely (this_type == JOINING_TYPE_T)) {
-      info[i].arabic_shaping_action() = NONE;
-      continue;
-    }
+    for (unsigned int i = start; i < end; i++)
+    {
+      unsigned int this_type = types[i - start];
 
-    const arabic_state_table_entry *entry = &arabic_state_table[state][this_type];
+      if (unlikely (this_type == JOINING_TYPE_T)) {
+	info[i].arabic_shaping_action() = NONE;
+	continue;
+      }
 
-    if (entry->prev_action != NONE && prev != (unsigned int) -1)
-      info[prev].arabic_shaping_action() = entry->prev_action;
+      const arabic_state_table_entry *entry = &arabic_state_table[state][this_type];
 
-    info[i].arabic_shaping_action() = entry->curr_action;
+      if (entry->prev_action != NONE && prev != (unsigned int) -1)
+      {
+	info[prev].arabic_shaping_action() = entry->prev_action;
+	buffer->unsafe_to_break (prev, i + 1);
+      }
 
-    prev = i;
-    state = entry->next_state;
+      info[i].arabic_shaping_action() = entry->curr_action;
+
+      prev = i;
+      state = entry->next_state;
+    }
   }
 
   for (unsigned int i = 0; i < buffer->context_len[1]; i++)
@@ -398,19 +411,17 @@ arabic_fallback_shape (const hb_ot_shape_plan_t *plan,
   if (!arabic_plan->do_fallback)
     return;
 
-retry:
-  arabic_fallback_plan_t *fallback_plan = (arabic_fallback_plan_t *) hb_atomic_ptr_get (&arabic_plan->fallback_plan);
-  if (unlikely (!fallback_plan))
-  {
-    /* This sucks.  We need a font to build the fallback plan... */
-    fallback_plan = arabic_fallback_plan_create (plan, font);
-    if (unlikely (!hb_atomic_ptr_cmpexch (&(const_cast<arabic_shape_plan_t *> (arabic_plan))->fallback_plan, NULL, fallback_plan))) {
-      arabic_fallback_plan_destroy (fallback_plan);
-      goto retry;
-    }
-  }
+  arabic_fallback_shape_face (arabic_fallback_face_get (font),
+			      plan,
+			      arabic_plan->fallback_mask_array,
+			      font,
+			      buffer);
+}
 
-  arabic_fallback_plan_shape (fallback_plan, font, buffer);
+bool
+arabic_fallback_prepare (hb_font_t *font)
+{
+  return arabic_fallback_face_get (font) != &arabic_fallback_face_nil;
 }
 
 /*
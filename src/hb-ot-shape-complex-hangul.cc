@@ -119,6 +119,9 @@ data_destroy_hangul (void *data)
 /* buffer var allocations */
 #define hangul_shaping_feature() complex_var_u8_0() /* hangul jamo shaping feature */
 
+/* Set if some glyph may have a jamo feature. */
+#define HB_BUFFER_SCRATCH_FLAG_HANGUL_HAS_JAMO_FEATURES HB_BUFFER_SCRATCH_FLAG_COMPLEX0
+
 static bool
 is_zero_width_char (hb_font_t *font,
 		    hb_codepoint_t unicode)
@@ -127,6 +130,29 @@ is_zero_width_char (hb_font_t *font,
   return hb_font_get_glyph (font, unicode, 0, &glyph) && hb_font_get_glyph_h_advance (font, glyph) == 0;
 }
 
+/* Whether the buffer has only precomposed syllables the font supports,
+ * and no jamo or tone marks; preprocessing leaves such text untouched,
+ * without setting any jamo features. */
+static bool
+is_precomposed_text (hb_buffer_t *buffer,
+		     hb_font_t   *font)
+{
+  unsigned int count = buffer->len;
+  hb_glyph_info_t *info = buffer->info;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    hb_codepoint_t u = info[i].codepoint;
+    if (isCombinedS (u))
+    {
+      if (!font->has_glyph (u))
+	return false;
+    }
+    else if (unlikely (isL (u) || isV (u) || isT (u) || isHangulTone (u)))
+      return false;
+  }
+  return true;
+}
+
 static void
 preprocess_text_hangul (const hb_ot_shape_plan_t *plan,
 			hb_buffer_t              *buffer,
@@ -134,6 +160,13 @@ preprocess_text_hangul (const hb_ot_shape_plan_t *plan,
 {
   HB_BUFFER_ALLOCATE_VAR (buffer, hangul_shaping_feature);
 
+  /* Modern text is all precomposed; skip the syllable work, and the jamo
+   * features in setup_masks_hangul().  The jamo feature lookups are then
+   * skipped too, as no glyph has their masks. */
+  if (likely (is_precomposed_text (buffer, font)))
+    return;
+  buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HANGUL_HAS_JAMO_FEATURES;
+
   /* Hangul syllables come in two shapes: LV, and LVT.  Of those:
    *
    *   - LV can be precomposed, or decomposed.  Lets call those
@@ -394,7 +427,8 @@ setup_masks_hangul (const hb_ot_shape_plan_t *plan,
 {
   const hangul_shape_plan_t *hangul_plan = (const hangul_shape_plan_t *) plan->data;
 
-  if (likely (hangul_plan))
+  if (likely (hangul_plan) &&
+      (buffer->scratch_flags & HB_BUFFER_SCRATCH_FLAG_HANGUL_HAS_JAMO_FEATURES))
   {
     unsigned int count = buffer->len;
     hb_glyph_info_t *info = buffer->info;
@@ -0,0 +1,590 @@
+/* == Start of generated table == */
+/*
+ * The following tables are generated by running:
+ *
+ *   ./gen-syllable-machine.py hb-ot-shape-complex-indic-machine.rl
+ */
+
+#ifndef HB_OT_SHAPE_COMPLEX_INDIC_MACHINE_HH
+#define HB_OT_SHAPE_COMPLEX_INDIC_MACHINE_HH
+
+#include "hb-ot-shape-complex-machine-private.hh"
+
+
+static const uint8_t _indic_syllable_machine_classes[33] =
+{
+   19,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+   15, 16, 17, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18,
+   19,
+};
+
+static const uint16_t _indic_syllable_machine_transitions[10000] =
+{
+  /*   0 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*   1 */    2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  12,  13,  14,  15,  16,  17,  18,  19,  20,
+  /*   2 */    0,   0,  21,  22,  23,  24,  25,  26,  27,  28,   0,   0,  29,  30,   0,   0,  31,   0,  32,   0,
+  /*   3 */    0,   0,  33,  34,  35,  36,  37,  38,  39,  40,   0,   0,  41,  42,   0,   0,  43,   0,  44,   0,
+  /*   4 */    0,   0,  45,   5,  46,  46,   8,   9,  10,  11,   0,   0,   0,  14,   0,   0,  17,   0,  19,   0,
+  /*   5 */   47,   0,   0,   0,  48,  49,   0,   9,  10,  11,   0,   0,   0,  50,   0,  47,   0,   0,   0,   0,
+  /*   6 */    0,   0,   0,  51,  52,  52,   8,   9,   0,   0,   0,   0,  13,  51,   0,   0,   0,   0,   0,   0,
+  /*   7 */    0,   0,   0,  51,  52,  52,   8,   9,   0,   0,   0,   0,   0,  51,   0,   0,   0,   0,   0,   0,
+  /*   8 */    0,   0,  53,  54,  55,  56,  57,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /*   9 */    0,   0,   0,   0,  58,   0,   0,  59,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  10 */    0,   0,   0,   0,   0,   0,   0,   0,  60,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  11 */    0,   0,   0,   0,   0,   0,   0,   0,  10,  61,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  12 */    0,   0,  62,  63,  64,  65,  66,  67,  68,  69,   0,   0,  70,  71,   0,   0,  72,   0,  73,   0,
+  /*  13 */    0,   0,   4,   5,  46,  46,   8,   9,  10,  11,   0,   0,   0,  14,   0,   0,  17,   0,  19,   0,
+  /*  14 */   47,  74,   0,   0,  48,  49,   0,   9,  10,  11,   0,   0,   0,  50,   0,  47,   0,   0,   0,   0,
+  /*  15 */    2,   3,   4,   5,  75,  46,   8,   9,  10,  11,  12,  12,  13,  14,   0,   2,  17,   0,  19,   0,
+  /*  16 */    0,   0,  21,  76,  23,  24,  25,  26,  27,  28,   0,   0,  29,  30,   0,   0,  31,   0,  32,   0,
+  /*  17 */    0,   0,   0,  77,  78,  78,   8,   9,  10,  11,   0,   0,   0,  79,   0,   0,   0,   0,  19,   0,
+  /*  18 */    0,   0,  80,   0,  81,  81,   0,  82,  83,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  19 */    0,   0,   0,  77,  78,  78,   8,   9,  10,  11,   0,   0,   0,  79,   0,   0,   0,   0,   0,   0,
+  /*  20 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  21 */    0,   0,  85,  22,  86,  86,  25,  26,  27,  28,   0,   0,   0,  30,   0,   0,  31,   0,  32,   0,
+  /*  22 */   87,   0,   0,   0,  88,  89,   0,  26,  27,  28,   0,   0,   0,  90,   0,  87,   0,   0,   0,   0,
+  /*  23 */    0,   0,   0,  91,  92,  92,  25,  26,   0,   0,   0,   0,  29,  91,   0,   0,   0,   0,   0,   0,
+  /*  24 */    0,   0,  21,  22,  23,  86,  25,  26,  27,  28,   0,   0,  29,  30,   0,   0,  31,   0,  32,   0,
+  /*  25 */    0,   0,  93,  94,  95,  96,  97,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /*  26 */    0,   0,   0,   0,  98,   0,   0,  99,  27,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  27 */    0,   0,   0,   0,   0,   0,   0,   0, 100,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  28 */    0,   0,   0,   0,   0,   0,   0,   0,  27, 101,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  29 */    0,   0,  21,  22,  86,  86,  25,  26,  27,  28,   0,   0,   0,  30,   0,   0,  31,   0,  32,   0,
+  /*  30 */   87, 102,   0,   0,  88,  89,   0,  26,  27,  28,   0,   0,   0,  90,   0,  87,   0,   0,   0,   0,
+  /*  31 */    0,   0,   0, 103, 104, 104,  25,  26,  27,  28,   0,   0,   0, 105,   0,   0,   0,   0,  32,   0,
+  /*  32 */    0,   0,   0, 103, 104, 104,  25,  26,  27,  28,   0,   0,   0, 105,   0,   0,   0,   0,   0,   0,
+  /*  33 */    0,   0, 106,  34, 107,  36,  37,  38,  39,  40,   0,   0,   0,  42,   0,   0,  43,   0,  44,   0,
+  /*  34 */  108,   0,   0,   0, 109, 110,   0,  38,  39,  40,   0,   0,   0, 111,   0, 108,   0,   0,   0,   0,
+  /*  35 */    0,   0,   0, 112, 113, 113,  37,  38,   0,   0,   0,   0,  41, 112,   0,   0,   0,   0,   0,   0,
+  /*  36 */    0,   0,   0, 112, 113, 113,  37,  38,   0,   0,   0,   0,   0, 112,   0,   0,   0,   0,   0,   0,
+  /*  37 */    0,   0, 114, 115, 116, 117, 118,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /*  38 */    0,   0,   0,   0, 119,   0,   0, 120,  39,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  39 */    0,   0,   0,   0,   0,   0,   0,   0, 121,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  40 */    0,   0,   0,   0,   0,   0,   0,   0,  39, 122,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  41 */    0,   0,  33,  34, 107,  36,  37,  38,  39,  40,   0,   0,   0,  42,   0,   0,  43,   0,  44,   0,
+  /*  42 */  108, 123,   0,   0, 109, 110,   0,  38,  39,  40,   0,   0,   0, 111,   0, 108,   0,   0,   0,   0,
+  /*  43 */    0,   0,   0, 124, 125, 125,  37,  38,  39,  40,   0,   0,   0, 126,   0,   0,   0,   0,  44,   0,
+  /*  44 */    0,   0,   0, 124, 125, 125,  37,  38,  39,  40,   0,   0,   0, 126,   0,   0,   0,   0,   0,   0,
+  /*  45 */    0,   0,   0,   5,  46,  46,   8,   9,  10,  11,   0,   0,   0,  14,   0,   0,  17,   0,  19,   0,
+  /*  46 */    0,   0,   0,  51,  52,  52,   8,   9,   0,   0,   0,   0,   0,  51,   0,   0,   0,   0,   0,   0,
+  /*  47 */    0,   0, 127, 128, 129, 130,   8,   9,  10,  11,   0,   0, 131, 132,   0,   0,  17,   0,  19,   0,
+  /*  48 */    0,   0,   0,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /*  49 */   47,   0, 134,   0, 135, 135,   8,   9,  10,  11,   0,   0,   0,  50,   0,  47,   0,   0,   0,   0,
+  /*  50 */  136,  74,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 136,   0,   0,   0,   0,
+  /*  51 */   47,   0,   0,   0, 133, 137,   0,   9,  10,  11,   0,   0,   0,  50,   0,  47,   0,   0,   0,   0,
+  /*  52 */    0,   0,   0,   0, 138, 138,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  53 */    0,   0,   0,  54,  55,  56,  57,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /*  54 */    0,   0,   0,   0,  55,  55,  57,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /*  55 */    0,   0,   0,   0, 139, 139,  57,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  56 */    0,   0,   0, 140, 139, 139,  57,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  57 */    0,   0, 141, 142, 143, 144, 145,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /*  58 */    0,   0,   0,   0,   0,   0,   0,   0,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  59 */    0,   0,   0,   0,  58,   0,   0,   0,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  60 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  61 */    0,   0,   0,   0,   0,   0,   0,   0,  10, 146,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  62 */    0,   0, 147,  63,  65,  65,  66,  67,  68,  69,   0,   0,   0,  71,   0,   0,  72,   0,  73,   0,
+  /*  63 */  148,   0,   0,   0, 149, 150,   0,  67,  68,  69,   0,   0,   0, 151,   0, 148,   0,   0,   0,   0,
+  /*  64 */    0,   0,   0, 152, 153, 153,  66,  67,   0,   0,   0,   0,  70, 152,   0,   0,   0,   0,   0,   0,
+  /*  65 */    0,   0,   0, 152, 153, 153,  66,  67,   0,   0,   0,   0,   0, 152,   0,   0,   0,   0,   0,   0,
+  /*  66 */    0,   0, 154, 155, 156, 157, 158,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /*  67 */    0,   0,   0,   0, 159,   0,   0, 160,  68,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  68 */    0,   0,   0,   0,   0,   0,   0,   0, 161,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  69 */    0,   0,   0,   0,   0,   0,   0,   0,  68, 162,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  70 */    0,   0,  62,  63,  65,  65,  66,  67,  68,  69,   0,   0,   0,  71,   0,   0,  72,   0,  73,   0,
+  /*  71 */  148, 163,   0,   0, 149, 150,   0,  67,  68,  69,   0,   0,   0, 151,   0, 148,   0,   0,   0,   0,
+  /*  72 */    0,   0,   0, 164, 165, 165,  66,  67,  68,  69,   0,   0,   0, 166,   0,   0,   0,   0,  73,   0,
+  /*  73 */    0,   0,   0, 164, 165, 165,  66,  67,  68,  69,   0,   0,   0, 166,   0,   0,   0,   0,   0,   0,
+  /*  74 */    0,   0,   0,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  75 */    0,   0,   0,  51,  52,  52,   8,   9,   0,   0,   0,   0,  13,  51,   0,   0,   0,   0,   0,   0,
+  /*  76 */   87,   3,   4,   5, 167, 168,   8,  26,  27,  28,   0,  12,  13, 169,   0,  87,  17,   0,  19,   0,
+  /*  77 */    0,   0,   0,   0,  48, 170,   0,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /*  78 */    0,   0,   0, 171,  52,  52,   8,   9,   0,   0,   0,   0,   0, 171,   0,   0,   0,   0,   0,   0,
+  /*  79 */  136,  74,   0,   0,  48, 170,   0,   9,  10,  11,   0,   0,   0,  50,   0, 136,   0,   0,   0,   0,
+  /*  80 */    0,   0,   0,   0,  81,  81,   0,  82,  83,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  81 */    0,   0,   0,   0,   0,   0,   0,  82,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  82 */    0,   0,   0,   0, 172,   0,   0, 173,  83,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  83 */    0,   0,   0,   0,   0,   0,   0,   0, 174,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  84 */    0,   0,   0,   0,   0,   0,   0,   0,  83, 175,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  85 */    0,   0,   0,  22,  86,  86,  25,  26,  27,  28,   0,   0,   0,  30,   0,   0,  31,   0,  32,   0,
+  /*  86 */    0,   0,   0,  91,  92,  92,  25,  26,   0,   0,   0,   0,   0,  91,   0,   0,   0,   0,   0,   0,
+  /*  87 */    0,   0, 176, 177, 178, 179,  25,  26,  27,  28,   0,   0, 180, 181,   0,   0,  31,   0,  32,   0,
+  /*  88 */    0,   0,   0,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /*  89 */   87,   0, 183,   0, 184, 184,  25,  26,  27,  28,   0,   0,   0,  90,   0,  87,   0,   0,   0,   0,
+  /*  90 */  185, 102,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 185,   0,   0,   0,   0,
+  /*  91 */   87,   0,   0,   0, 182, 186,   0,  26,  27,  28,   0,   0,   0,  90,   0,  87,   0,   0,   0,   0,
+  /*  92 */    0,   0,   0,   0, 187, 187,  25,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  93 */    0,   0,   0,  94,  95,  96,  97,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /*  94 */    0,   0,   0,   0,  95,  95,  97,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /*  95 */    0,   0,   0,   0, 188, 188,  97,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  96 */    0,   0,   0, 189, 188, 188,  97,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  97 */    0,   0, 190, 191, 192, 193, 194,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /*  98 */    0,   0,   0,   0,   0,   0,   0,   0,  27,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /*  99 */    0,   0,   0,   0,  98,   0,   0,   0,  27,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 100 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 101 */    0,   0,   0,   0,   0,   0,   0,   0,  27, 195,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 102 */    0,   0,   0,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 103 */    0,   0,   0,   0,  88, 196,   0,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 104 */    0,   0,   0, 197,  92,  92,  25,  26,   0,   0,   0,   0,   0, 197,   0,   0,   0,   0,   0,   0,
+  /* 105 */  185, 102,   0,   0,  88, 196,   0,  26,  27,  28,   0,   0,   0,  90,   0, 185,   0,   0,   0,   0,
+  /* 106 */    0,   0,   0,  34, 107,  36,  37,  38,  39,  40,   0,   0,   0,  42,   0,   0,  43,   0,  44,   0,
+  /* 107 */    0,   0,   0, 112, 113, 113,  37,  38,   0,   0,   0,   0,   0, 112,   0,   0,   0,   0,   0,   0,
+  /* 108 */    0,   0, 198, 199, 200, 201,  37,  38,  39,  40,   0,   0, 202, 203,   0,   0,  43,   0,  44,   0,
+  /* 109 */    0,   0,   0,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 110 */  108,   0, 205,   0, 206, 206,  37,  38,  39,  40,   0,   0,   0, 111,   0, 108,   0,   0,   0,   0,
+  /* 111 */  207, 123,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 207,   0,   0,   0,   0,
+  /* 112 */  108,   0,   0,   0, 204, 208,   0,  38,  39,  40,   0,   0,   0, 111,   0, 108,   0,   0,   0,   0,
+  /* 113 */    0,   0,   0,   0, 209, 209,  37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 114 */    0,   0,   0, 115, 116, 117, 118,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 115 */    0,   0,   0,   0, 116, 116, 118,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 116 */    0,   0,   0,   0, 210, 210, 118,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 117 */    0,   0,   0, 211, 210, 210, 118,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 118 */    0,   0, 212, 213, 214, 215, 216,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 119 */    0,   0,   0,   0,   0,   0,   0,   0,  39,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 120 */    0,   0,   0,   0, 119,   0,   0,   0,  39,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 121 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 122 */    0,   0,   0,   0,   0,   0,   0,   0,  39, 217,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 123 */    0,   0,   0,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 124 */    0,   0,   0,   0, 109, 218,   0,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 125 */    0,   0,   0, 219, 113, 113,  37,  38,   0,   0,   0,   0,   0, 219,   0,   0,   0,   0,   0,   0,
+  /* 126 */  207, 123,   0,   0, 109, 218,   0,  38,  39,  40,   0,   0,   0, 111,   0, 207,   0,   0,   0,   0,
+  /* 127 */    0,   0, 220, 128, 221, 221,   8,   9,  10,  11,   0,   0,   0, 132,   0,   0,  17,   0,  19,   0,
+  /* 128 */  222,   0,   0,   0,  48, 223,   0,   9,  10,  11,   0,   0,   0,  50,   0, 222,   0,   0,   0,   0,
+  /* 129 */    0,   0,   0, 224,  52,  52,   8,   9,   0,   0,   0,   0, 131, 224,   0,   0,   0,   0,   0,   0,
+  /* 130 */    0,   0, 127, 128, 129, 221,   8,   9,  10,  11,   0,   0, 131, 132,   0,   0,  17,   0,  19,   0,
+  /* 131 */    0,   0, 127, 128, 221, 221,   8,   9,  10,  11,   0,   0,   0, 132,   0,   0,  17,   0,  19,   0,
+  /* 132 */  222,  74,   0,   0,  48, 223,   0,   9,  10,  11,   0,   0,   0,  50,   0, 222,   0,   0,   0,   0,
+  /* 133 */    0,   0,   0,   0,   0,   0,   0,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 134 */   47,   0,   0,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0,  47,   0,   0,   0,   0,
+  /* 135 */    0,   0,   0,   0,  52,  52,   8,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 136 */    0,   0, 225,   0, 226, 227,   0,   9,  10,  11,   0,   0, 228,   0,   0,   0,   0,   0,   0,   0,
+  /* 137 */   47,   0, 134,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0,  47,   0,   0,   0,   0,
+  /* 138 */    0,   0,   0,   0,   0,   0,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 139 */    0,   0,   0,   0, 229, 229,  57,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 140 */    0,   0,   0,   0,   0, 230,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 141 */    0,   0,   0, 142, 143, 144, 145,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 142 */    0,   0,   0,   0, 143, 143, 145,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 143 */    0,   0,   0,   0, 231, 231, 145,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 144 */    0,   0,   0, 232, 231, 231, 145,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 145 */    0,   0, 233, 234, 235, 236, 237,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 146 */    0,   0,   0,   0,   0,   0,   0,   0,  10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 147 */    0,   0,   0,  63,  65,  65,  66,  67,  68,  69,   0,   0,   0,  71,   0,   0,  72,   0,  73,   0,
+  /* 148 */    0,   0, 238, 239, 240, 241,  66,  67,  68,  69,   0,   0, 242, 243,   0,   0,  72,   0,  73,   0,
+  /* 149 */    0,   0,   0,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 150 */  148,   0, 245,   0, 246, 246,  66,  67,  68,  69,   0,   0,   0, 151,   0, 148,   0,   0,   0,   0,
+  /* 151 */  247, 163,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 247,   0,   0,   0,   0,
+  /* 152 */  148,   0,   0,   0, 244, 248,   0,  67,  68,  69,   0,   0,   0, 151,   0, 148,   0,   0,   0,   0,
+  /* 153 */    0,   0,   0,   0, 249, 249,  66,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 154 */    0,   0,   0, 155, 156, 157, 158,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 155 */    0,   0,   0,   0, 156, 156, 158,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 156 */    0,   0,   0,   0, 250, 250, 158,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 157 */    0,   0,   0, 251, 250, 250, 158,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 158 */    0,   0, 252, 253, 254, 255, 256,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 159 */    0,   0,   0,   0,   0,   0,   0,   0,  68,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 160 */    0,   0,   0,   0, 159,   0,   0,   0,  68,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 161 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 162 */    0,   0,   0,   0,   0,   0,   0,   0,  68, 257,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 163 */    0,   0,   0,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 164 */    0,   0,   0,   0, 149, 258,   0,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 165 */    0,   0,   0, 259, 153, 153,  66,  67,   0,   0,   0,   0,   0, 259,   0,   0,   0,   0,   0,   0,
+  /* 166 */  247, 163,   0,   0, 149, 258,   0,  67,  68,  69,   0,   0,   0, 151,   0, 247,   0,   0,   0,   0,
+  /* 167 */    0,   0,   0,  51, 260, 260,   8,  26,  27,  28,   0,   0,  13, 261,   0,   0,   0,   0,   0,   0,
+  /* 168 */   87,   0, 183,  51, 184, 184,  25,  26,  27,  28,   0,   0,   0, 261,   0,  87,   0,   0,   0,   0,
+  /* 169 */  262, 102,   0,   0,  48,  49,   0,   9,  10,  11,   0,   0,   0,  50,   0, 262,   0,   0,   0,   0,
+  /* 170 */    0,   0,  48,   0, 135, 135,   8,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 171 */    0,   0,   0,   0, 133, 263,   0,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 172 */    0,   0,   0,   0,   0,   0,   0,   0,  83,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 173 */    0,   0,   0,   0, 172,   0,   0,   0,  83,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 174 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 175 */    0,   0,   0,   0,   0,   0,   0,   0,  83, 264,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 176 */    0,   0, 265, 177, 266, 266,  25,  26,  27,  28,   0,   0,   0, 181,   0,   0,  31,   0,  32,   0,
+  /* 177 */  267,   0,   0,   0,  88, 268,   0,  26,  27,  28,   0,   0,   0,  90,   0, 267,   0,   0,   0,   0,
+  /* 178 */    0,   0,   0, 269,  92,  92,  25,  26,   0,   0,   0,   0, 180, 269,   0,   0,   0,   0,   0,   0,
+  /* 179 */    0,   0, 176, 177, 178, 266,  25,  26,  27,  28,   0,   0, 180, 181,   0,   0,  31,   0,  32,   0,
+  /* 180 */    0,   0, 176, 177, 266, 266,  25,  26,  27,  28,   0,   0,   0, 181,   0,   0,  31,   0,  32,   0,
+  /* 181 */  267, 102,   0,   0,  88, 268,   0,  26,  27,  28,   0,   0,   0,  90,   0, 267,   0,   0,   0,   0,
+  /* 182 */    0,   0,   0,   0,   0,   0,   0,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 183 */   87,   0,   0,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0,  87,   0,   0,   0,   0,
+  /* 184 */    0,   0,   0,   0,  92,  92,  25,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 185 */    0,   0, 270,   0, 271, 272,   0,  26,  27,  28,   0,   0, 273,   0,   0,   0,   0,   0,   0,   0,
+  /* 186 */   87,   0, 183,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0,  87,   0,   0,   0,   0,
+  /* 187 */    0,   0,   0,   0,   0,   0,  25,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 188 */    0,   0,   0,   0, 274, 274,  97,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 189 */    0,   0,   0,   0,   0, 275,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 190 */    0,   0,   0, 191, 192, 193, 194,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 191 */    0,   0,   0,   0, 192, 192, 194,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 192 */    0,   0,   0,   0, 276, 276, 194,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 193 */    0,   0,   0, 277, 276, 276, 194,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 194 */    0,   0, 278, 279, 280, 281, 282,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 195 */    0,   0,   0,   0,   0,   0,   0,   0,  27,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 196 */    0,   0,  88,   0, 184, 184,  25,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 197 */    0,   0,   0,   0, 182, 283,   0,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 198 */    0,   0, 284, 199, 285, 285,  37,  38,  39,  40,   0,   0,   0, 203,   0,   0,  43,   0,  44,   0,
+  /* 199 */  286,   0,   0,   0, 109, 287,   0,  38,  39,  40,   0,   0,   0, 111,   0, 286,   0,   0,   0,   0,
+  /* 200 */    0,   0,   0, 288, 113, 113,  37,  38,   0,   0,   0,   0, 202, 288,   0,   0,   0,   0,   0,   0,
+  /* 201 */    0,   0, 198, 199, 200, 285,  37,  38,  39,  40,   0,   0, 202, 203,   0,   0,  43,   0,  44,   0,
+  /* 202 */    0,   0, 198, 199, 285, 285,  37,  38,  39,  40,   0,   0,   0, 203,   0,   0,  43,   0,  44,   0,
+  /* 203 */  286, 123,   0,   0, 109, 287,   0,  38,  39,  40,   0,   0,   0, 111,   0, 286,   0,   0,   0,   0,
+  /* 204 */    0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 205 */  108,   0,   0,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 108,   0,   0,   0,   0,
+  /* 206 */    0,   0,   0,   0, 113, 113,  37,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 207 */    0,   0, 289,   0, 290, 291,   0,  38,  39,  40,   0,   0, 292,   0,   0,   0,   0,   0,   0,   0,
+  /* 208 */  108,   0, 205,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 108,   0,   0,   0,   0,
+  /* 209 */    0,   0,   0,   0,   0,   0,  37,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 210 */    0,   0,   0,   0, 293, 293, 118,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 211 */    0,   0,   0,   0,   0, 294,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 212 */    0,   0,   0, 213, 214, 215, 216,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 213 */    0,   0,   0,   0, 214, 214, 216,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 214 */    0,   0,   0,   0, 295, 295, 216,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 215 */    0,   0,   0, 296, 295, 295, 216,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 216 */    0,   0, 297, 298, 299, 300, 301,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 217 */    0,   0,   0,   0,   0,   0,   0,   0,  39,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 218 */    0,   0, 109,   0, 206, 206,  37,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 219 */    0,   0,   0,   0, 204, 302,   0,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 220 */    0,   0,   0, 128, 221, 221,   8,   9,  10,  11,   0,   0,   0, 132,   0,   0,  17,   0,  19,   0,
+  /* 221 */    0,   0,   0, 224,  52,  52,   8,   9,   0,   0,   0,   0,   0, 224,   0,   0,   0,   0,   0,   0,
+  /* 222 */    0,   0, 303, 304, 305, 306,   8,   9,  10,  11,   0,   0, 307, 308,   0,   0,  17,   0,  19,   0,
+  /* 223 */  222,   0, 309,   0, 135, 135,   8,   9,  10,  11,   0,   0,   0,  50,   0, 222,   0,   0,   0,   0,
+  /* 224 */  222,   0,   0,   0, 133, 310,   0,   9,  10,  11,   0,   0,   0,  50,   0, 222,   0,   0,   0,   0,
+  /* 225 */    0,   0,  74,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 226 */    0,   0,   0,   0,   0,   0,   0,   9,   0,   0,   0,   0, 228,   0,   0,   0,   0,   0,   0,   0,
+  /* 227 */    0,   0, 225,   0, 226, 133,   0,   9,  10,  11,   0,   0, 228,   0,   0,   0,   0,   0,   0,   0,
+  /* 228 */    0,   0, 225,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 229 */    0,   0,   0,   0,   0,   0,  57,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 230 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  54,   0,   0,   0,   0,
+  /* 231 */    0,   0,   0,   0, 311, 311, 145,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 232 */    0,   0,   0,   0,   0, 312,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 233 */    0,   0,   0, 234, 235, 236, 237,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 234 */    0,   0,   0,   0, 235, 235, 237,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 235 */    0,   0,   0,   0, 313, 313, 237,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 236 */    0,   0,   0, 314, 313, 313, 237,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 237 */    0,   0, 315,  48, 133, 316,   0,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 238 */    0,   0, 317, 239, 318, 318,  66,  67,  68,  69,   0,   0,   0, 243,   0,   0,  72,   0,  73,   0,
+  /* 239 */  319,   0,   0,   0, 149, 320,   0,  67,  68,  69,   0,   0,   0, 151,   0, 319,   0,   0,   0,   0,
+  /* 240 */    0,   0,   0, 321, 153, 153,  66,  67,   0,   0,   0,   0, 242, 321,   0,   0,   0,   0,   0,   0,
+  /* 241 */    0,   0, 238, 239, 240, 318,  66,  67,  68,  69,   0,   0, 242, 243,   0,   0,  72,   0,  73,   0,
+  /* 242 */    0,   0, 238, 239, 318, 318,  66,  67,  68,  69,   0,   0,   0, 243,   0,   0,  72,   0,  73,   0,
+  /* 243 */  319, 163,   0,   0, 149, 320,   0,  67,  68,  69,   0,   0,   0, 151,   0, 319,   0,   0,   0,   0,
+  /* 244 */    0,   0,   0,   0,   0,   0,   0,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 245 */  148,   0,   0,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 148,   0,   0,   0,   0,
+  /* 246 */    0,   0,   0,   0, 153, 153,  66,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 247 */    0,   0, 322,   0, 323, 324,   0,  67,  68,  69,   0,   0, 325,   0,   0,   0,   0,   0,   0,   0,
+  /* 248 */  148,   0, 245,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 148,   0,   0,   0,   0,
+  /* 249 */    0,   0,   0,   0,   0,   0,  66,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 250 */    0,   0,   0,   0, 326, 326, 158,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 251 */    0,   0,   0,   0,   0, 327,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 252 */    0,   0,   0, 253, 254, 255, 256,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 253 */    0,   0,   0,   0, 254, 254, 256,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 254 */    0,   0,   0,   0, 328, 328, 256,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 255 */    0,   0,   0, 329, 328, 328, 256,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 256 */    0,   0, 330, 331, 332, 333, 334,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 257 */    0,   0,   0,   0,   0,   0,   0,   0,  68,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 258 */    0,   0, 149,   0, 246, 246,  66,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 259 */    0,   0,   0,   0, 244, 335,   0,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 260 */    0,   0,   0,   0, 138, 138,   8,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 261 */  262, 102,   0,   0, 133, 137,   0,   9,  10,  11,   0,   0,   0,  50,   0, 262,   0,   0,   0,   0,
+  /* 262 */    0,   0, 336, 128, 337, 338,   8,  26,  27,  28,   0,   0, 339, 132,   0,   0,  17,   0,  19,   0,
+  /* 263 */    0,   0,  48,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 264 */    0,   0,   0,   0,   0,   0,   0,   0,  83,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 265 */    0,   0,   0, 177, 266, 266,  25,  26,  27,  28,   0,   0,   0, 181,   0,   0,  31,   0,  32,   0,
+  /* 266 */    0,   0,   0, 269,  92,  92,  25,  26,   0,   0,   0,   0,   0, 269,   0,   0,   0,   0,   0,   0,
+  /* 267 */    0,   0, 340, 341, 342, 343,  25,  26,  27,  28,   0,   0, 344, 345,   0,   0,  31,   0,  32,   0,
+  /* 268 */  267,   0, 346,   0, 184, 184,  25,  26,  27,  28,   0,   0,   0,  90,   0, 267,   0,   0,   0,   0,
+  /* 269 */  267,   0,   0,   0, 182, 347,   0,  26,  27,  28,   0,   0,   0,  90,   0, 267,   0,   0,   0,   0,
+  /* 270 */    0,   0, 102,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 271 */    0,   0,   0,   0,   0,   0,   0,  26,   0,   0,   0,   0, 273,   0,   0,   0,   0,   0,   0,   0,
+  /* 272 */    0,   0, 270,   0, 271, 182,   0,  26,  27,  28,   0,   0, 273,   0,   0,   0,   0,   0,   0,   0,
+  /* 273 */    0,   0, 270,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 274 */    0,   0,   0,   0,   0,   0,  97,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 275 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  94,   0,   0,   0,   0,
+  /* 276 */    0,   0,   0,   0, 348, 348, 194,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 277 */    0,   0,   0,   0,   0, 349,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 278 */    0,   0,   0, 279, 280, 281, 282,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 279 */    0,   0,   0,   0, 280, 280, 282,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 280 */    0,   0,   0,   0, 350, 350, 282,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 281 */    0,   0,   0, 351, 350, 350, 282,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 282 */    0,   0, 352,  88, 182, 353,   0,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 283 */    0,   0,  88,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 284 */    0,   0,   0, 199, 285, 285,  37,  38,  39,  40,   0,   0,   0, 203,   0,   0,  43,   0,  44,   0,
+  /* 285 */    0,   0,   0, 288, 113, 113,  37,  38,   0,   0,   0,   0,   0, 288,   0,   0,   0,   0,   0,   0,
+  /* 286 */    0,   0, 354, 355, 356, 357,  37,  38,  39,  40,   0,   0, 358, 359,   0,   0,  43,   0,  44,   0,
+  /* 287 */  286,   0, 360,   0, 206, 206,  37,  38,  39,  40,   0,   0,   0, 111,   0, 286,   0,   0,   0,   0,
+  /* 288 */  286,   0,   0,   0, 204, 361,   0,  38,  39,  40,   0,   0,   0, 111,   0, 286,   0,   0,   0,   0,
+  /* 289 */    0,   0, 123,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 290 */    0,   0,   0,   0,   0,   0,   0,  38,   0,   0,   0,   0, 292,   0,   0,   0,   0,   0,   0,   0,
+  /* 291 */    0,   0, 289,   0, 290, 204,   0,  38,  39,  40,   0,   0, 292,   0,   0,   0,   0,   0,   0,   0,
+  /* 292 */    0,   0, 289,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 293 */    0,   0,   0,   0,   0,   0, 118,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 294 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 115,   0,   0,   0,   0,
+  /* 295 */    0,   0,   0,   0, 362, 362, 216,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 296 */    0,   0,   0,   0,   0, 363,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 297 */    0,   0,   0, 298, 299, 300, 301,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 298 */    0,   0,   0,   0, 299, 299, 301,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 299 */    0,   0,   0,   0, 364, 364, 301,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 300 */    0,   0,   0, 365, 364, 364, 301,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 301 */    0,   0, 366, 109, 204, 367,   0,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 302 */    0,   0, 109,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 303 */    0,   0, 368, 304, 369, 369,   8,   9,  10,  11,   0,   0,   0, 308,   0,   0,  17,   0,  19,   0,
+  /* 304 */  370,   0,   0,   0,  48, 371,   0,   9,  10,  11,   0,   0,   0,  50,   0, 370,   0,   0,   0,   0,
+  /* 305 */    0,   0,   0, 372,  52,  52,   8,   9,   0,   0,   0,   0, 307, 372,   0,   0,   0,   0,   0,   0,
+  /* 306 */    0,   0, 303, 304, 305, 369,   8,   9,  10,  11,   0,   0, 307, 308,   0,   0,  17,   0,  19,   0,
+  /* 307 */    0,   0, 303, 304, 369, 369,   8,   9,  10,  11,   0,   0,   0, 308,   0,   0,  17,   0,  19,   0,
+  /* 308 */  370,  74,   0,   0,  48, 371,   0,   9,  10,  11,   0,   0,   0,  50,   0, 370,   0,   0,   0,   0,
+  /* 309 */  222,   0,   0,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0, 222,   0,   0,   0,   0,
+  /* 310 */  222,   0, 309,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0, 222,   0,   0,   0,   0,
+  /* 311 */    0,   0,   0,   0,   0,   0, 145,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 312 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 142,   0,   0,   0,   0,
+  /* 313 */    0,   0,   0,   0, 373, 373, 237,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 314 */    0,   0,   0,   0,   0, 374,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 315 */    0,   0,   0,  48, 133, 316,   0,   9,  10,  11,   0,   0,   0,  50,   0,   0,   0,   0,   0,   0,
+  /* 316 */    0,   0,   0, 375,   0,   0,   0,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 317 */    0,   0,   0, 239, 318, 318,  66,  67,  68,  69,   0,   0,   0, 243,   0,   0,  72,   0,  73,   0,
+  /* 318 */    0,   0,   0, 321, 153, 153,  66,  67,   0,   0,   0,   0,   0, 321,   0,   0,   0,   0,   0,   0,
+  /* 319 */    0,   0, 376, 377, 378, 379,  66,  67,  68,  69,   0,   0, 380, 381,   0,   0,  72,   0,  73,   0,
+  /* 320 */  319,   0, 382,   0, 246, 246,  66,  67,  68,  69,   0,   0,   0, 151,   0, 319,   0,   0,   0,   0,
+  /* 321 */  319,   0,   0,   0, 244, 383,   0,  67,  68,  69,   0,   0,   0, 151,   0, 319,   0,   0,   0,   0,
+  /* 322 */    0,   0, 163,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 323 */    0,   0,   0,   0,   0,   0,   0,  67,   0,   0,   0,   0, 325,   0,   0,   0,   0,   0,   0,   0,
+  /* 324 */    0,   0, 322,   0, 323, 244,   0,  67,  68,  69,   0,   0, 325,   0,   0,   0,   0,   0,   0,   0,
+  /* 325 */    0,   0, 322,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 326 */    0,   0,   0,   0,   0,   0, 158,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 327 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155,   0,   0,   0,   0,
+  /* 328 */    0,   0,   0,   0, 384, 384, 256,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 329 */    0,   0,   0,   0,   0, 385,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 330 */    0,   0,   0, 331, 332, 333, 334,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 331 */    0,   0,   0,   0, 332, 332, 334,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 332 */    0,   0,   0,   0, 386, 386, 334,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 333 */    0,   0,   0, 387, 386, 386, 334,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 334 */    0,   0, 388, 149, 244, 389,   0,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 335 */    0,   0, 149,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 336 */    0,   0, 390, 128, 391, 391,   8,  26,  27,  28,   0,   0,   0, 132,   0,   0,  17,   0,  19,   0,
+  /* 337 */    0,   0,   0, 224,  52,  52,   8,  26,   0,   0,   0,   0, 339, 224,   0,   0,   0,   0,   0,   0,
+  /* 338 */    0,   0, 336, 128, 337, 391,   8,  26,  27,  28,   0,   0, 339, 132,   0,   0,  17,   0,  19,   0,
+  /* 339 */    0,   0, 336, 128, 391, 391,   8,  26,  27,  28,   0,   0,   0, 132,   0,   0,  17,   0,  19,   0,
+  /* 340 */    0,   0, 392, 341, 393, 393,  25,  26,  27,  28,   0,   0,   0, 345,   0,   0,  31,   0,  32,   0,
+  /* 341 */  394,   0,   0,   0,  88, 395,   0,  26,  27,  28,   0,   0,   0,  90,   0, 394,   0,   0,   0,   0,
+  /* 342 */    0,   0,   0, 396,  92,  92,  25,  26,   0,   0,   0,   0, 344, 396,   0,   0,   0,   0,   0,   0,
+  /* 343 */    0,   0, 340, 341, 342, 393,  25,  26,  27,  28,   0,   0, 344, 345,   0,   0,  31,   0,  32,   0,
+  /* 344 */    0,   0, 340, 341, 393, 393,  25,  26,  27,  28,   0,   0,   0, 345,   0,   0,  31,   0,  32,   0,
+  /* 345 */  394, 102,   0,   0,  88, 395,   0,  26,  27,  28,   0,   0,   0,  90,   0, 394,   0,   0,   0,   0,
+  /* 346 */  267,   0,   0,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0, 267,   0,   0,   0,   0,
+  /* 347 */  267,   0, 346,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0, 267,   0,   0,   0,   0,
+  /* 348 */    0,   0,   0,   0,   0,   0, 194,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 349 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 191,   0,   0,   0,   0,
+  /* 350 */    0,   0,   0,   0, 397, 397, 282,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 351 */    0,   0,   0,   0,   0, 398,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 352 */    0,   0,   0,  88, 182, 353,   0,  26,  27,  28,   0,   0,   0,  90,   0,   0,   0,   0,   0,   0,
+  /* 353 */    0,   0,   0, 399,   0,   0,   0,  26,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 354 */    0,   0, 400, 355, 401, 401,  37,  38,  39,  40,   0,   0,   0, 359,   0,   0,  43,   0,  44,   0,
+  /* 355 */  402,   0,   0,   0, 109, 403,   0,  38,  39,  40,   0,   0,   0, 111,   0, 402,   0,   0,   0,   0,
+  /* 356 */    0,   0,   0, 404, 113, 113,  37,  38,   0,   0,   0,   0, 358, 404,   0,   0,   0,   0,   0,   0,
+  /* 357 */    0,   0, 354, 355, 356, 401,  37,  38,  39,  40,   0,   0, 358, 359,   0,   0,  43,   0,  44,   0,
+  /* 358 */    0,   0, 354, 355, 401, 401,  37,  38,  39,  40,   0,   0,   0, 359,   0,   0,  43,   0,  44,   0,
+  /* 359 */  402, 123,   0,   0, 109, 403,   0,  38,  39,  40,   0,   0,   0, 111,   0, 402,   0,   0,   0,   0,
+  /* 360 */  286,   0,   0,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 286,   0,   0,   0,   0,
+  /* 361 */  286,   0, 360,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 286,   0,   0,   0,   0,
+  /* 362 */    0,   0,   0,   0,   0,   0, 216,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 363 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 213,   0,   0,   0,   0,
+  /* 364 */    0,   0,   0,   0, 405, 405, 301,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 365 */    0,   0,   0,   0,   0, 406,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 366 */    0,   0,   0, 109, 204, 367,   0,  38,  39,  40,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,
+  /* 367 */    0,   0,   0, 407,   0,   0,   0,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 368 */    0,   0,   0, 304, 369, 369,   8,   9,  10,  11,   0,   0,   0, 308,   0,   0,  17,   0,  19,   0,
+  /* 369 */    0,   0,   0, 372,  52,  52,   8,   9,   0,   0,   0,   0,   0, 372,   0,   0,   0,   0,   0,   0,
+  /* 370 */    0,   0, 408, 409, 410, 411,   8,   9,  10,  11,   0,   0, 412, 413,   0,   0,  17,   0,  19,   0,
+  /* 371 */  370,   0, 414,   0, 135, 135,   8,   9,  10,  11,   0,   0,   0,  50,   0, 370,   0,   0,   0,   0,
+  /* 372 */  370,   0,   0,   0, 133, 415,   0,   9,  10,  11,   0,   0,   0,  50,   0, 370,   0,   0,   0,   0,
+  /* 373 */    0,   0,   0,   0,   0,   0, 237,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 374 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 234,   0,   0,   0,   0,
+  /* 375 */    0,   0,   0,   0,   0, 416,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 376 */    0,   0, 417, 377, 418, 418,  66,  67,  68,  69,   0,   0,   0, 381,   0,   0,  72,   0,  73,   0,
+  /* 377 */  419,   0,   0,   0, 149, 420,   0,  67,  68,  69,   0,   0,   0, 151,   0, 419,   0,   0,   0,   0,
+  /* 378 */    0,   0,   0, 421, 153, 153,  66,  67,   0,   0,   0,   0, 380, 421,   0,   0,   0,   0,   0,   0,
+  /* 379 */    0,   0, 376, 377, 378, 418,  66,  67,  68,  69,   0,   0, 380, 381,   0,   0,  72,   0,  73,   0,
+  /* 380 */    0,   0, 376, 377, 418, 418,  66,  67,  68,  69,   0,   0,   0, 381,   0,   0,  72,   0,  73,   0,
+  /* 381 */  419, 163,   0,   0, 149, 420,   0,  67,  68,  69,   0,   0,   0, 151,   0, 419,   0,   0,   0,   0,
+  /* 382 */  319,   0,   0,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 319,   0,   0,   0,   0,
+  /* 383 */  319,   0, 382,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 319,   0,   0,   0,   0,
+  /* 384 */    0,   0,   0,   0,   0,   0, 256,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 385 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 253,   0,   0,   0,   0,
+  /* 386 */    0,   0,   0,   0, 422, 422, 334,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 387 */    0,   0,   0,   0,   0, 423,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 388 */    0,   0,   0, 149, 244, 389,   0,  67,  68,  69,   0,   0,   0, 151,   0,   0,   0,   0,   0,   0,
+  /* 389 */    0,   0,   0, 424,   0,   0,   0,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 390 */    0,   0,   0, 128, 391, 391,   8,  26,  27,  28,   0,   0,   0, 132,   0,   0,  17,   0,  19,   0,
+  /* 391 */    0,   0,   0, 224,  52,  52,   8,  26,   0,   0,   0,   0,   0, 224,   0,   0,   0,   0,   0,   0,
+  /* 392 */    0,   0,   0, 341, 393, 393,  25,  26,  27,  28,   0,   0,   0, 345,   0,   0,  31,   0,  32,   0,
+  /* 393 */    0,   0,   0, 396,  92,  92,  25,  26,   0,   0,   0,   0,   0, 396,   0,   0,   0,   0,   0,   0,
+  /* 394 */    0,   0, 425, 426, 427, 428,  25,  26,  27,  28,   0,   0, 429, 430,   0,   0,  31,   0,  32,   0,
+  /* 395 */  394,   0, 431,   0, 184, 184,  25,  26,  27,  28,   0,   0,   0,  90,   0, 394,   0,   0,   0,   0,
+  /* 396 */  394,   0,   0,   0, 182, 432,   0,  26,  27,  28,   0,   0,   0,  90,   0, 394,   0,   0,   0,   0,
+  /* 397 */    0,   0,   0,   0,   0,   0, 282,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 398 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 279,   0,   0,   0,   0,
+  /* 399 */    0,   0,   0,   0,   0, 433,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 400 */    0,   0,   0, 355, 401, 401,  37,  38,  39,  40,   0,   0,   0, 359,   0,   0,  43,   0,  44,   0,
+  /* 401 */    0,   0,   0, 404, 113, 113,  37,  38,   0,   0,   0,   0,   0, 404,   0,   0,   0,   0,   0,   0,
+  /* 402 */    0,   0, 434, 435, 436, 437,  37,  38,  39,  40,   0,   0, 438, 439,   0,   0,  43,   0,  44,   0,
+  /* 403 */  402,   0, 440,   0, 206, 206,  37,  38,  39,  40,   0,   0,   0, 111,   0, 402,   0,   0,   0,   0,
+  /* 404 */  402,   0,   0,   0, 204, 441,   0,  38,  39,  40,   0,   0,   0, 111,   0, 402,   0,   0,   0,   0,
+  /* 405 */    0,   0,   0,   0,   0,   0, 301,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 406 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 298,   0,   0,   0,   0,
+  /* 407 */    0,   0,   0,   0,   0, 442,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 408 */    0,   0, 443, 409, 444, 444,   8,   9,  10,  11,   0,   0,   0, 413,   0,   0,  17,   0,  19,   0,
+  /* 409 */  445,   0,   0,   0,  48, 446,   0,   9,  10,  11,   0,   0,   0,  50,   0, 445,   0,   0,   0,   0,
+  /* 410 */    0,   0,   0, 447,  52,  52,   8,   9,   0,   0,   0,   0, 412, 447,   0,   0,   0,   0,   0,   0,
+  /* 411 */    0,   0, 408, 409, 410, 444,   8,   9,  10,  11,   0,   0, 412, 413,   0,   0,  17,   0,  19,   0,
+  /* 412 */    0,   0, 408, 409, 444, 444,   8,   9,  10,  11,   0,   0,   0, 413,   0,   0,  17,   0,  19,   0,
+  /* 413 */  445,  74,   0,   0,  48, 446,   0,   9,  10,  11,   0,   0,   0,  50,   0, 445,   0,   0,   0,   0,
+  /* 414 */  370,   0,   0,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0, 370,   0,   0,   0,   0,
+  /* 415 */  370,   0, 414,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0, 370,   0,   0,   0,   0,
+  /* 416 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  48,   0,   0,   0,   0,
+  /* 417 */    0,   0,   0, 377, 418, 418,  66,  67,  68,  69,   0,   0,   0, 381,   0,   0,  72,   0,  73,   0,
+  /* 418 */    0,   0,   0, 421, 153, 153,  66,  67,   0,   0,   0,   0,   0, 421,   0,   0,   0,   0,   0,   0,
+  /* 419 */    0,   0, 448, 449, 450, 451,  66,  67,  68,  69,   0,   0, 452, 453,   0,   0,  72,   0,  73,   0,
+  /* 420 */  419,   0, 454,   0, 246, 246,  66,  67,  68,  69,   0,   0,   0, 151,   0, 419,   0,   0,   0,   0,
+  /* 421 */  419,   0,   0,   0, 244, 455,   0,  67,  68,  69,   0,   0,   0, 151,   0, 419,   0,   0,   0,   0,
+  /* 422 */    0,   0,   0,   0,   0,   0, 334,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 423 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 331,   0,   0,   0,   0,
+  /* 424 */    0,   0,   0,   0,   0, 456,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  /* 425 */    0,   0, 457, 426, 458, 458,  25,  26,  27,  28,   0,   0,   0, 430,   0,   0,  31,   0,  32,   0,
+  /* 426 */  459,   0,   0,   0,  88, 460,   0,  26,  27,  28,   0,   0,   0,  90,   0, 459,   0,   0,   0,   0,
+  /* 427 */    0,   0,   0, 461,  92,  92,  25,  26,   0,   0,   0,   0, 429, 461,   0,   0,   0,   0,   0,   0,
+  /* 428 */    0,   0, 425, 426, 427, 458,  25,  26,  27,  28,   0,   0, 429, 430,   0,   0,  31,   0,  32,   0,
+  /* 429 */    0,   0, 425, 426, 458, 458,  25,  26,  27,  28,   0,   0,   0, 430,   0,   0,  31,   0,  32,   0,
+  /* 430 */  459, 102,   0,   0,  88, 460,   0,  26,  27,  28,   0,   0,   0,  90,   0, 459,   0,   0,   0,   0,
+  /* 431 */  394,   0,   0,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0, 394,   0,   0,   0,   0,
+  /* 432 */  394,   0, 431,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0, 394,   0,   0,   0,   0,
+  /* 433 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  88,   0,   0,   0,   0,
+  /* 434 */    0,   0, 462, 435, 463, 463,  37,  38,  39,  40,   0,   0,   0, 439,   0,   0,  43,   0,  44,   0,
+  /* 435 */  464,   0,   0,   0, 109, 465,   0,  38,  39,  40,   0,   0,   0, 111,   0, 464,   0,   0,   0,   0,
+  /* 436 */    0,   0,   0, 466, 113, 113,  37,  38,   0,   0,   0,   0, 438, 466,   0,   0,   0,   0,   0,   0,
+  /* 437 */    0,   0, 434, 435, 436, 463,  37,  38,  39,  40,   0,   0, 438, 439,   0,   0,  43,   0,  44,   0,
+  /* 438 */    0,   0, 434, 435, 463, 463,  37,  38,  39,  40,   0,   0,   0, 439,   0,   0,  43,   0,  44,   0,
+  /* 439 */  464, 123,   0,   0, 109, 465,   0,  38,  39,  40,   0,   0,   0, 111,   0, 464,   0,   0,   0,   0,
+  /* 440 */  402,   0,   0,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 402,   0,   0,   0,   0,
+  /* 441 */  402,   0, 440,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 402,   0,   0,   0,   0,
+  /* 442 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 109,   0,   0,   0,   0,
+  /* 443 */    0,   0,   0, 409, 444, 444,   8,   9,  10,  11,   0,   0,   0, 413,   0,   0,  17,   0,  19,   0,
+  /* 444 */    0,   0,   0, 447,  52,  52,   8,   9,   0,   0,   0,   0,   0, 447,   0,   0,   0,   0,   0,   0,
+  /* 445 */    0,   0, 467,  77, 468, 469,   8,   9,  10,  11,   0,   0, 470,  79,   0,   0,  17,   0,  19,   0,
+  /* 446 */  445,   0, 471,   0, 135, 135,   8,   9,  10,  11,   0,   0,   0,  50,   0, 445,   0,   0,   0,   0,
+  /* 447 */  445,   0,   0,   0, 133, 472,   0,   9,  10,  11,   0,   0,   0,  50,   0, 445,   0,   0,   0,   0,
+  /* 448 */    0,   0, 473, 449, 474, 474,  66,  67,  68,  69,   0,   0,   0, 453,   0,   0,  72,   0,  73,   0,
+  /* 449 */  475,   0,   0,   0, 149, 476,   0,  67,  68,  69,   0,   0,   0, 151,   0, 475,   0,   0,   0,   0,
+  /* 450 */    0,   0,   0, 477, 153, 153,  66,  67,   0,   0,   0,   0, 452, 477,   0,   0,   0,   0,   0,   0,
+  /* 451 */    0,   0, 448, 449, 450, 474,  66,  67,  68,  69,   0,   0, 452, 453,   0,   0,  72,   0,  73,   0,
+  /* 452 */    0,   0, 448, 449, 474, 474,  66,  67,  68,  69,   0,   0,   0, 453,   0,   0,  72,   0,  73,   0,
+  /* 453 */  475, 163,   0,   0, 149, 476,   0,  67,  68,  69,   0,   0,   0, 151,   0, 475,   0,   0,   0,   0,
+  /* 454 */  419,   0,   0,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 419,   0,   0,   0,   0,
+  /* 455 */  419,   0, 454,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 419,   0,   0,   0,   0,
+  /* 456 */    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149,   0,   0,   0,   0,
+  /* 457 */    0,   0,   0, 426, 458, 458,  25,  26,  27,  28,   0,   0,   0, 430,   0,   0,  31,   0,  32,   0,
+  /* 458 */    0,   0,   0, 461,  92,  92,  25,  26,   0,   0,   0,   0,   0, 461,   0,   0,   0,   0,   0,   0,
+  /* 459 */    0,   0, 478, 103, 479, 480,  25,  26,  27,  28,   0,   0, 481, 105,   0,   0,  31,   0,  32,   0,
+  /* 460 */  459,   0, 482,   0, 184, 184,  25,  26,  27,  28,   0,   0,   0,  90,   0, 459,   0,   0,   0,   0,
+  /* 461 */  459,   0,   0,   0, 182, 483,   0,  26,  27,  28,   0,   0,   0,  90,   0, 459,   0,   0,   0,   0,
+  /* 462 */    0,   0,   0, 435, 463, 463,  37,  38,  39,  40,   0,   0,   0, 439,   0,   0,  43,   0,  44,   0,
+  /* 463 */    0,   0,   0, 466, 113, 113,  37,  38,   0,   0,   0,   0,   0, 466,   0,   0,   0,   0,   0,   0,
+  /* 464 */    0,   0, 484, 124, 485, 486,  37,  38,  39,  40,   0,   0, 487, 126,   0,   0,  43,   0,  44,   0,
+  /* 465 */  464,   0, 488,   0, 206, 206,  37,  38,  39,  40,   0,   0,   0, 111,   0, 464,   0,   0,   0,   0,
+  /* 466 */  464,   0,   0,   0, 204, 489,   0,  38,  39,  40,   0,   0,   0, 111,   0, 464,   0,   0,   0,   0,
+  /* 467 */    0,   0, 490,  77,  78,  78,   8,   9,  10,  11,   0,   0,   0,  79,   0,   0,  17,   0,  19,   0,
+  /* 468 */    0,   0,   0, 171,  52,  52,   8,   9,   0,   0,   0,   0, 470, 171,   0,   0,   0,   0,   0,   0,
+  /* 469 */    0,   0, 467,  77, 468,  78,   8,   9,  10,  11,   0,   0, 470,  79,   0,   0,  17,   0,  19,   0,
+  /* 470 */    0,   0, 467,  77,  78,  78,   8,   9,  10,  11,   0,   0,   0,  79,   0,   0,  17,   0,  19,   0,
+  /* 471 */  445,   0,   0,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0, 445,   0,   0,   0,   0,
+  /* 472 */  445,   0, 471,   0, 133, 133,   0,   9,  10,  11,   0,   0,   0,  50,   0, 445,   0,   0,   0,   0,
+  /* 473 */    0,   0,   0, 449, 474, 474,  66,  67,  68,  69,   0,   0,   0, 453,   0,   0,  72,   0,  73,   0,
+  /* 474 */    0,   0,   0, 477, 153, 153,  66,  67,   0,   0,   0,   0,   0, 477,   0,   0,   0,   0,   0,   0,
+  /* 475 */    0,   0, 491, 164, 492, 493,  66,  67,  68,  69,   0,   0, 494, 166,   0,   0,  72,   0,  73,   0,
+  /* 476 */  475,   0, 495,   0, 246, 246,  66,  67,  68,  69,   0,   0,   0, 151,   0, 475,   0,   0,   0,   0,
+  /* 477 */  475,   0,   0,   0, 244, 496,   0,  67,  68,  69,   0,   0,   0, 151,   0, 475,   0,   0,   0,   0,
+  /* 478 */    0,   0, 497, 103, 104, 104,  25,  26,  27,  28,   0,   0,   0, 105,   0,   0,  31,   0,  32,   0,
+  /* 479 */    0,   0,   0, 197,  92,  92,  25,  26,   0,   0,   0,   0, 481, 197,   0,   0,   0,   0,   0,   0,
+  /* 480 */    0,   0, 478, 103, 479, 104,  25,  26,  27,  28,   0,   0, 481, 105,   0,   0,  31,   0,  32,   0,
+  /* 481 */    0,   0, 478, 103, 104, 104,  25,  26,  27,  28,   0,   0,   0, 105,   0,   0,  31,   0,  32,   0,
+  /* 482 */  459,   0,   0,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0, 459,   0,   0,   0,   0,
+  /* 483 */  459,   0, 482,   0, 182, 182,   0,  26,  27,  28,   0,   0,   0,  90,   0, 459,   0,   0,   0,   0,
+  /* 484 */    0,   0, 498, 124, 125, 125,  37,  38,  39,  40,   0,   0,   0, 126,   0,   0,  43,   0,  44,   0,
+  /* 485 */    0,   0,   0, 219, 113, 113,  37,  38,   0,   0,   0,   0, 487, 219,   0,   0,   0,   0,   0,   0,
+  /* 486 */    0,   0, 484, 124, 485, 125,  37,  38,  39,  40,   0,   0, 487, 126,   0,   0,  43,   0,  44,   0,
+  /* 487 */    0,   0, 484, 124, 125, 125,  37,  38,  39,  40,   0,   0,   0, 126,   0,   0,  43,   0,  44,   0,
+  /* 488 */  464,   0,   0,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 464,   0,   0,   0,   0,
+  /* 489 */  464,   0, 488,   0, 204, 204,   0,  38,  39,  40,   0,   0,   0, 111,   0, 464,   0,   0,   0,   0,
+  /* 490 */    0,   0,   0,  77,  78,  78,   8,   9,  10,  11,   0,   0,   0,  79,   0,   0,  17,   0,  19,   0,
+  /* 491 */    0,   0, 499, 164, 165, 165,  66,  67,  68,  69,   0,   0,   0, 166,   0,   0,  72,   0,  73,   0,
+  /* 492 */    0,   0,   0, 259, 153, 153,  66,  67,   0,   0,   0,   0, 494, 259,   0,   0,   0,   0,   0,   0,
+  /* 493 */    0,   0, 491, 164, 492, 165,  66,  67,  68,  69,   0,   0, 494, 166,   0,   0,  72,   0,  73,   0,
+  /* 494 */    0,   0, 491, 164, 165, 165,  66,  67,  68,  69,   0,   0,   0, 166,   0,   0,  72,   0,  73,   0,
+  /* 495 */  475,   0,   0,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 475,   0,   0,   0,   0,
+  /* 496 */  475,   0, 495,   0, 244, 244,   0,  67,  68,  69,   0,   0,   0, 151,   0, 475,   0,   0,   0,   0,
+  /* 497 */    0,   0,   0, 103, 104, 104,  25,  26,  27,  28,   0,   0,   0, 105,   0,   0,  31,   0,  32,   0,
+  /* 498 */    0,   0,   0, 124, 125, 125,  37,  38,  39,  40,   0,   0,   0, 126,   0,   0,  43,   0,  44,   0,
+  /* 499 */    0,   0,   0, 164, 165, 165,  66,  67,  68,  69,   0,   0,   0, 166,   0,   0,  72,   0,  73,   0,
+};
+
+static const uint8_t _indic_syllable_machine_accepting[500] =
+{
+   0, 0, 1, 2, 5, 5, 6, 6, 5, 5, 5, 5, 3, 5, 5, 5,
+   1, 5, 4, 5, 6, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+   1, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 0, 5,
+   5, 5, 0, 5, 0, 5, 5, 0, 0, 5, 5, 5, 5, 5, 3, 3,
+   0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 5, 0, 1, 5, 0, 5,
+   4, 0, 4, 4, 4, 1, 0, 1, 1, 1, 0, 1, 0, 1, 1, 0,
+   0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 2, 0, 2, 2, 2, 0,
+   2, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 5,
+   5, 0, 5, 5, 5, 0, 5, 0, 5, 5, 0, 0, 0, 5, 5, 0,
+   0, 5, 5, 3, 3, 3, 3, 0, 3, 0, 3, 3, 0, 0, 3, 3,
+   3, 3, 3, 3, 3, 0, 3, 1, 1, 5, 5, 5, 4, 4, 4, 4,
+   1, 1, 0, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1,
+   0, 0, 1, 1, 1, 1, 2, 2, 0, 2, 2, 2, 0, 2, 0, 2,
+   2, 0, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 5, 0, 5, 5,
+   5, 5, 0, 5, 5, 0, 0, 0, 0, 5, 5, 0, 0, 5, 3, 3,
+   0, 3, 3, 3, 0, 3, 0, 3, 3, 0, 0, 0, 3, 3, 0, 0,
+   3, 3, 3, 3, 0, 5, 1, 5, 4, 1, 0, 1, 1, 1, 1, 0,
+   1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 2, 0, 2, 2,
+   2, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 0, 0, 2, 2, 5,
+   5, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5, 0, 3, 0, 3,
+   3, 3, 3, 0, 3, 3, 0, 0, 0, 0, 3, 3, 0, 0, 3, 3,
+   1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+   1, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 0,
+   5, 0, 5, 5, 5, 0, 0, 0, 3, 3, 0, 3, 3, 3, 3, 3,
+   0, 0, 0, 0, 3, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0,
+   2, 0, 2, 2, 2, 0, 0, 0, 5, 5, 0, 5, 5, 5, 5, 5,
+   0, 3, 0, 3, 3, 3, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1,
+   1, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 5, 0, 5, 5, 5,
+   3, 3, 0, 3, 3, 3, 3, 3, 0, 1, 0, 1, 1, 1, 2, 0,
+   2, 2, 2, 5, 0, 5, 5, 5, 5, 3, 0, 3, 3, 3, 1, 0,
+   1, 1, 1, 1, 2, 0, 2, 2, 2, 2, 5, 3, 0, 3, 3, 3,
+   3, 1, 2, 3,
+};
+
+static const uint8_t _indic_syllable_machine_syllable_types[6] =
+{
+  consonant_syllable,
+  vowel_syllable,
+  standalone_cluster,
+  symbol_cluster,
+  broken_cluster,
+  non_indic_cluster,
+};
+
+static const hb_syllable_machine_t<uint16_t> indic_syllable_machine =
+{
+  32, /* num_categories */
+  20, /* num_classes */
+  _indic_syllable_machine_classes,
+  _indic_syllable_machine_transitions,
+  _indic_syllable_machine_accepting,
+  _indic_syllable_machine_syllable_types,
+}; /* 500 states; table size: 20539 bytes */
+
+static void
+find_syllables (hb_buffer_t *buffer)
+{
+  hb_find_syllables (indic_syllable_machine, buffer,
+		     &buffer->info[0].indic_category(), sizeof (buffer->info[0]));
+}
+
+#endif /* HB_OT_SHAPE_COMPLEX_INDIC_MACHINE_HH */
+
+/* == End of generated table == */
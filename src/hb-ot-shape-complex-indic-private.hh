@@ -187,4 +187,13 @@ enum indic_matra_category_t {
 HB_INTERNAL INDIC_TABLE_ELEMENT_TYPE
 hb_indic_get_categories (hb_codepoint_t u);
 
+/* Same, for count characters at once; unicode_stride and category_stride
+ * are in bytes, so this can be used directly on glyph info arrays. */
+HB_INTERNAL void
+hb_indic_get_categories_batch (unsigned int              count,
+			       const hb_codepoint_t     *first_unicode,
+			       unsigned int              unicode_stride,
+			       INDIC_TABLE_ELEMENT_TYPE *first_category,
+			       unsigned int              category_stride);
+
 #endif /* HB_OT_SHAPE_COMPLEX_INDIC_PRIVATE_HH */
@@ -26,6 +26,7 @@
 
 #include "hb-ot-shape-complex-indic-private.hh"
 #include "hb-ot-layout-private.hh"
+#include "hb-cache-private.hh"
 
 /* buffer var allocations */
 #define indic_category() complex_var_u8_0() /* indic_category_t */
@@ -164,10 +165,9 @@ is_halant_or_coeng (const hb_glyph_info_t &info)
 }
 
 static inline void
-set_indic_properties (hb_glyph_info_t &info)
+set_indic_properties (hb_glyph_info_t &info, unsigned int type)
 {
   hb_codepoint_t u = info.codepoint;
-  unsigned int type = hb_indic_get_categories (u);
   indic_category_t cat = (indic_category_t) (type & 0x7Fu);
   indic_position_t pos = (indic_position_t) (type >> 8);
 
@@ -517,6 +517,10 @@ struct indic_shape_plan_t
   would_substitute_feature_t blwf;
   would_substitute_feature_t pstf;
 
+  /* Consonant glyph to indic_position_t, as found by
+   * consonant_position_from_face().  Filled lazily, like virama_glyph. */
+  hb_cache_t<16, 8, 8> consonant_position_cache;
+
   hb_mask_t mask_array[INDIC_NUM_FEATURES];
 };
 
@@ -551,6 +555,7 @@ data_create_indic (const hb_ot_shape_plan_t *plan)
   indic_plan->pref.init (&plan->map, HB_TAG('p','r','e','f'), zero_context);
   indic_plan->blwf.init (&plan->map, HB_TAG('b','l','w','f'), zero_context);
   indic_plan->pstf.init (&plan->map, HB_TAG('p','s','t','f'), zero_context);
+  indic_plan->consonant_position_cache.clear ();
 
   for (unsigned int i = 0; i < ARRAY_LENGTH (indic_plan->mask_array); i++)
     indic_plan->mask_array[i] = (indic_features[i].flags & F_GLOBAL) ?
@@ -624,8 +629,16 @@ setup_masks_indic (const hb_ot_shape_plan_t *plan HB_UNUSED,
 
   unsigned int count = buffer->len;
   hb_glyph_info_t *info = buffer->info;
-  for (unsigned int i = 0; i < count; i++)
-    set_indic_properties (info[i]);
+  INDIC_TABLE_ELEMENT_TYPE types[64];
+  for (unsigned int start = 0; start < count; start += ARRAY_LENGTH (types))
+  {
+    unsigned int n = MIN (count - start, ARRAY_LENGTH (types));
+    hb_indic_get_categories_batch (n,
+				   &info[start].codepoint, sizeof (info[0]),
+				   types, sizeof (types[0]));
+    for (unsigned int i = 0; i < n; i++)
+      set_indic_properties (info[start + i], types[i]);
+  }
 }
 
 static void
@@ -634,6 +647,8 @@ setup_syllables (const hb_ot_shape_plan_t *plan HB_UNUSED,
 		 hb_buffer_t *buffer)
 {
   find_syllables (buffer);
+  foreach_syllable (buffer, start, end)
+    buffer->unsafe_to_break (start, end);
 }
 
 static int
@@ -661,13 +676,20 @@ update_consonant_positions (const hb_ot_shape_plan_t *plan,
   if (indic_plan->get_virama_glyph (font, &virama))
   {
     hb_face_t *face = font->face;
+    hb_cache_t<16, 8, 8> *cache = &(const_cast<indic_shape_plan_t *> (indic_plan))->consonant_position_cache;
     unsigned int count = buffer->len;
     hb_glyph_info_t *info = buffer->info;
     for (unsigned int i = 0; i < count; i++)
       if (info[i].indic_position() == POS_BASE_C)
       {
 	hb_codepoint_t consonant = info[i].codepoint;
-	info[i].indic_position() = consonant_position_from_face (indic_plan, consonant, virama, face);
+	unsigned int position;
+	if (!cache->get (consonant, &position))
+	{
+	  position = consonant_position_from_face (indic_plan, consonant, virama, face);
+	  cache->set (consonant, position);
+	}
+	info[i].indic_position() = position;
       }
   }
 }
@@ -1224,7 +1246,7 @@ insert_dotted_circles (const hb_ot_shape_plan_t *plan HB_UNUSED,
 
   hb_glyph_info_t dottedcircle = {0};
   dottedcircle.codepoint = 0x25CCu;
-  set_indic_properties (dottedcircle);
+  set_indic_properties (dottedcircle, hb_indic_get_categories (0x25CCu));
   dottedcircle.codepoint = dottedcircle_glyph;
 
   buffer->clear_output ();
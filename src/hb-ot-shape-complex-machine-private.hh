@@ -0,0 +1,100 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef HB_OT_SHAPE_COMPLEX_MACHINE_PRIVATE_HH
+#define HB_OT_SHAPE_COMPLEX_MACHINE_PRIVATE_HH
+
+#include "hb-private.hh"
+
+#include "hb-ot-layout-private.hh"
+
+
+/*
+ * Syllable machines, generated by gen-syllable-machine.py from the
+ * scanners in hb-ot-shape-complex-*-machine.rl.
+ *
+ * A machine is a DFA over input classes.  Categories are mapped to
+ * classes first, so the transition table only has as many columns as
+ * the scanner tells categories apart.
+ */
+
+template <typename Type>
+struct hb_syllable_machine_t
+{
+  unsigned int num_categories;	/* Categories from this one on share one class. */
+  unsigned int num_classes;
+  const uint8_t *classes;	/* num_categories + 1 entries. */
+  const Type *transitions;	/* num_classes entries per state.  State 0 is the
+				 * error state, 1 the start state. */
+  const uint8_t *accepting;	/* Per state: 0, or 1 + the pattern matched. */
+  const uint8_t *syllable_types;/* Per pattern. */
+};
+
+/* Sets the syllable of each glyph in buffer, reading categories from
+ * first_category, category_stride bytes apart.  This is the Ragel
+ * scanner semantics: the longest match wins, then the first pattern. */
+template <typename Type>
+static inline void
+hb_find_syllables (const hb_syllable_machine_t<Type> &machine,
+		   hb_buffer_t   *buffer,
+		   const uint8_t *first_category,
+		   unsigned int   category_stride)
+{
+  hb_glyph_info_t *info = buffer->info;
+  unsigned int count = buffer->len;
+  unsigned int syllable_serial = 1;
+  unsigned int start = 0;
+  while (start < count)
+  {
+    unsigned int state = 1;
+    unsigned int end = start;
+    unsigned int pattern = 0;
+    const uint8_t *category = first_category + start * category_stride;
+    for (unsigned int i = start; i < count; i++)
+    {
+      unsigned int c = machine.classes[MIN<unsigned int> (*category, machine.num_categories)];
+      state = machine.transitions[state * machine.num_classes + c];
+      if (!state)
+	break;
+      unsigned int accepting = machine.accepting[state];
+      end = accepting ? i + 1 : end;
+      pattern = accepting ? accepting : pattern;
+      category += category_stride;
+    }
+
+    /* Like the Ragel scanners, stop at input no pattern matches. */
+    if (unlikely (end == start))
+      break;
+
+    unsigned int syllable = (syllable_serial << 4) | machine.syllable_types[pattern - 1];
+    for (unsigned int i = start; i < end; i++)
+      info[i].syllable() = syllable;
+    start = end;
+    syllable_serial++;
+    if (unlikely (syllable_serial == 16)) syllable_serial = 1;
+  }
+}
+
+
+#endif /* HB_OT_SHAPE_COMPLEX_MACHINE_PRIVATE_HH */
@@ -0,0 +1,112 @@
+/* == Start of generated table == */
+/*
+ * The following tables are generated by running:
+ *
+ *   ./gen-syllable-machine.py hb-ot-shape-complex-myanmar-machine.rl
+ */
+
+#ifndef HB_OT_SHAPE_COMPLEX_MYANMAR_MACHINE_HH
+#define HB_OT_SHAPE_COMPLEX_MYANMAR_MACHINE_HH
+
+#include "hb-ot-shape-complex-machine-private.hh"
+
+
+static const uint8_t _myanmar_syllable_machine_classes[33] =
+{
+   20,  0,  0,  1,  2,  3,  3, 20,  4, 20,  5,  6, 20, 20, 20, 20,
+    7, 20,  8,  6, 20,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+   20,
+};
+
+static const uint8_t _myanmar_syllable_machine_transitions[1071] =
+{
+  /*  0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  1 */   2,  3,  4,  5,  6,  7,  2,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+  /*  2 */   0, 22, 23, 24, 25, 26,  0,  0, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,  0,  0,
+  /*  3 */   0,  0,  0,  4,  6,  0,  0,  0, 38,  0,  0,  0,  0, 14,  0,  0,  0, 18,  0,  0,  0,
+  /*  4 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  5 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  6 */   0,  0,  0,  4,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  7 */   0,  3,  0,  4,  6,  7,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 18,  0,  0,  0,
+  /*  8 */   0, 22, 23, 24, 25, 26,  0,  0, 39, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,  0,  0,
+  /*  9 */   0,  3,  0,  4,  6,  7,  0,  0,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 10 */   0,  3,  0,  4,  6,  7,  0,  0, 17,  0,  0,  0,  0, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 11 */   0,  3,  0,  4,  6,  7,  0,  0, 17, 10,  0, 12,  0, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 12 */   0,  3,  0,  4,  6,  7,  0,  0, 17, 10,  0,  0,  0, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 13 */   0,  3,  0,  4,  6,  7,  0,  0, 17, 10, 11, 12,  0, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 14 */   0, 40,  0,  4,  6, 14,  0,  0, 41,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+  /* 15 */   0,  3,  0,  4,  6,  7,  0,  0,  0,  0,  0,  0,  0, 14, 15, 16,  0, 18,  0,  0,  0,
+  /* 16 */   0,  3,  0,  4,  6,  7,  0,  0,  0,  0,  0,  0,  0, 14,  0, 16,  0, 18,  0,  0,  0,
+  /* 17 */   0,  3,  0,  4,  6,  7,  0,  0,  0,  0,  0,  0,  0, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 18 */   0,  3,  0,  4,  6,  7,  0,  0, 42, 42,  0,  0,  0, 14, 43,  0,  0, 18,  0,  0,  0,
+  /* 19 */   0,  3,  4,  4,  6,  7,  0,  0,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18,  0,  0,  0,
+  /* 20 */   0,  0,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 21 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 22 */   0,  0,  0, 24, 25,  0,  0,  0, 45,  0,  0,  0,  0, 32,  0,  0,  0, 36,  0,  0,  0,
+  /* 23 */   2,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 24 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 25 */   0,  0,  0, 24, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 26 */   0, 22,  0, 24, 25, 26,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 36,  0,  0,  0,
+  /* 27 */   0, 22,  0, 24, 25, 26,  0,  0, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 28 */   0, 22,  0, 24, 25, 26,  0,  0, 35,  0,  0,  0,  0, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 29 */   0, 22,  0, 24, 25, 26,  0,  0, 35, 28,  0, 30,  0, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 30 */   0, 22,  0, 24, 25, 26,  0,  0, 35, 28,  0,  0,  0, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 31 */   0, 22,  0, 24, 25, 26,  0,  0, 35, 28, 29, 30,  0, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 32 */   0, 46,  0, 24, 25, 32,  0,  0, 47,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+  /* 33 */   0, 22,  0, 24, 25, 26,  0,  0,  0,  0,  0,  0,  0, 32, 33, 34,  0, 36,  0,  0,  0,
+  /* 34 */   0, 22,  0, 24, 25, 26,  0,  0,  0,  0,  0,  0,  0, 32,  0, 34,  0, 36,  0,  0,  0,
+  /* 35 */   0, 22,  0, 24, 25, 26,  0,  0,  0,  0,  0,  0,  0, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 36 */   0, 22,  0, 24, 25, 26,  0,  0, 48, 48,  0,  0,  0, 32, 49,  0,  0, 36,  0,  0,  0,
+  /* 37 */   0, 22, 23, 24, 25, 26,  0,  0, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 38 */   0,  0,  0,  4,  6,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0, 18,  0,  0,  0,
+  /* 39 */   0, 22, 50, 24, 25, 26,  0,  0, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,  0,  0,  0,
+  /* 40 */   0,  0,  0,  4,  6,  0,  0,  0, 41,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+  /* 41 */   0,  0,  0,  4,  6,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,
+  /* 42 */   0,  3,  0,  4,  6,  7,  0,  0, 42,  0,  0,  0,  0, 14, 43,  0,  0, 18,  0,  0,  0,
+  /* 43 */   0,  3,  0,  4,  6,  7,  0,  0,  0,  0,  0,  0,  0, 14, 43,  0,  0, 18,  0,  0,  0,
+  /* 44 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 45 */   0,  0,  0, 24, 25,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0, 36,  0,  0,  0,
+  /* 46 */   0,  0,  0, 24, 25,  0,  0,  0, 47,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+  /* 47 */   0,  0,  0, 24, 25,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,
+  /* 48 */   0, 22,  0, 24, 25, 26,  0,  0, 48,  0,  0,  0,  0, 32, 49,  0,  0, 36,  0,  0,  0,
+  /* 49 */   0, 22,  0, 24, 25, 26,  0,  0,  0,  0,  0,  0,  0, 32, 49,  0,  0, 36,  0,  0,  0,
+  /* 50 */   2,  3,  4,  4,  6,  7,  2,  2,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,  0,  0,
+};
+
+static const uint8_t _myanmar_syllable_machine_accepting[51] =
+{
+   0, 0, 1, 4, 4, 2, 4, 4, 1, 4, 4, 4, 4, 4, 4, 4,
+   4, 4, 4, 4, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+   1, 1, 1, 1, 1, 1, 4, 1, 4, 4, 4, 4, 3, 1, 1, 1,
+   1, 1, 4,
+};
+
+static const uint8_t _myanmar_syllable_machine_syllable_types[5] =
+{
+  consonant_syllable,
+  non_myanmar_cluster,
+  punctuation_cluster,
+  broken_cluster,
+  non_myanmar_cluster,
+};
+
+static const hb_syllable_machine_t<uint8_t> myanmar_syllable_machine =
+{
+  32, /* num_categories */
+  21, /* num_classes */
+  _myanmar_syllable_machine_classes,
+  _myanmar_syllable_machine_transitions,
+  _myanmar_syllable_machine_accepting,
+  _myanmar_syllable_machine_syllable_types,
+}; /* 51 states; table size: 1160 bytes */
+
+static void
+find_syllables (hb_buffer_t *buffer)
+{
+  hb_find_syllables (myanmar_syllable_machine, buffer,
+		     &buffer->info[0].myanmar_category(), sizeof (buffer->info[0]));
+}
+
+#endif /* HB_OT_SHAPE_COMPLEX_MYANMAR_MACHINE_HH */
+
+/* == End of generated table == */
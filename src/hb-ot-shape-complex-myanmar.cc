@@ -165,10 +165,9 @@ is_consonant (const hb_glyph_info_t &info)
 
 
 static inline void
-set_myanmar_properties (hb_glyph_info_t &info)
+set_myanmar_properties (hb_glyph_info_t &info, unsigned int type)
 {
   hb_codepoint_t u = info.codepoint;
-  unsigned int type = hb_indic_get_categories (u);
   indic_category_t cat = (indic_category_t) (type & 0x7Fu);
   indic_position_t pos = (indic_position_t) (type >> 8);
 
@@ -282,8 +281,16 @@ setup_masks_myanmar (const hb_ot_shape_plan_t *plan HB_UNUSED,
 
   unsigned int count = buffer->len;
   hb_glyph_info_t *info = buffer->info;
-  for (unsigned int i = 0; i < count; i++)
-    set_myanmar_properties (info[i]);
+  INDIC_TABLE_ELEMENT_TYPE types[64];
+  for (unsigned int start = 0; start < count; start += ARRAY_LENGTH (types))
+  {
+    unsigned int n = MIN (count - start, ARRAY_LENGTH (types));
+    hb_indic_get_categories_batch (n,
+				   &info[start].codepoint, sizeof (info[0]),
+				   types, sizeof (types[0]));
+    for (unsigned int i = 0; i < n; i++)
+      set_myanmar_properties (info[start + i], types[i]);
+  }
 }
 
 static void
@@ -292,6 +299,8 @@ setup_syllables (const hb_ot_shape_plan_t *plan HB_UNUSED,
 		 hb_buffer_t *buffer)
 {
   find_syllables (buffer);
+  foreach_syllable (buffer, start, end)
+    buffer->unsafe_to_break (start, end);
 }
 
 static int
@@ -444,7 +453,7 @@ insert_dotted_circles (const hb_ot_shape_plan_t *plan HB_UNUSED,
 
   hb_glyph_info_t dottedcircle = {0};
   dottedcircle.codepoint = 0x25CCu;
-  set_myanmar_properties (dottedcircle);
+  set_myanmar_properties (dottedcircle, hb_indic_get_categories (0x25CCu));
   dottedcircle.codepoint = dottedcircle_glyph;
 
   buffer->clear_output ();
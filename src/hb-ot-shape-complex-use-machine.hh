@@ -0,0 +1,135 @@
+/* == Start of generated table == */
+/*
+ * The following tables are generated by running:
+ *
+ *   ./gen-syllable-machine.py hb-ot-shape-complex-use-machine.rl
+ */
+
+#ifndef HB_OT_SHAPE_COMPLEX_USE_MACHINE_HH
+#define HB_OT_SHAPE_COMPLEX_USE_MACHINE_HH
+
+#include "hb-ot-shape-complex-machine-private.hh"
+
+
+static const uint8_t _use_syllable_machine_classes[44] =
+{
+    0,  1,  2,  0,  3,  4, 31, 31,  5, 31, 31,  6,  7,  8, 31, 31,
+    0,  0,  9, 10, 31, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+   22, 23, 24, 25, 31, 26, 27, 28, 31, 29, 30, 31,
+};
+
+static const uint8_t _use_syllable_machine_transitions[2240] =
+{
+  /*  0 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  1 */   2,  3,  4,  5,  3,  6,  7,  8,  0,  9, 10,  0, 11, 12, 13, 14, 15, 16, 17, 11, 18, 19, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /*  2 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  3 */   0,  0,  0,  0,  0, 28, 29, 30,  0,  0,  0, 31, 32, 33, 34, 35, 36, 37, 38, 32, 39, 31, 40, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /*  4 */   0,  0,  0,  0,  0, 47, 48, 49,  0,  0,  0, 50,  0, 51, 52, 53, 54, 55, 56, 51, 57, 50, 58,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /*  5 */   0,  0,  0,  0,  0,  0,  0, 62, 63,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  6 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  7 */   0,  0,  0,  0,  0,  6,  7,  8,  0,  0,  0, 65, 11, 12, 13, 14, 15, 16, 17, 11, 18, 20, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /*  8 */   0,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /*  9 */   0,  3,  4,  0,  3,  6,  7,  8,  0,  0,  0,  0, 11, 12, 13, 14, 15, 16, 17, 11, 18, 19, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 10 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66, 67,  0,
+  /* 11 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0, 11, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 12 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24, 25, 26,  0,  0,  0,
+  /* 13 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 14 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 15 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 16 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0, 11, 12, 13, 14, 15,  0, 17, 11,  0,  0,  0, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 17 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0, 11, 12, 13, 14, 15,  0,  0, 11,  0,  0,  0, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 18 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0, 11, 12, 13, 14, 15, 16, 17, 11,  0,  0,  0, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 19 */   0,  0,  0,  0,  0,  6,  7,  8,  0,  0,  0,  0, 11, 12, 13, 14, 15, 16, 17, 11, 18, 19, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 20 */   0,  0,  0,  0,  0,  6,  7,  8,  0,  0,  0,  0, 11, 12, 13, 14, 15, 16, 17, 11, 18,  0, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 21 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 22 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 23 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0, 12, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0, 23, 24, 25, 26,  0,  0,  0,
+  /* 24 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24, 25, 26,  0,  0,  0,
+  /* 25 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25, 26,  0,  0,  0,
+  /* 26 */   0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0, 13, 14, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 26,  0,  0,  0,
+  /* 27 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 28 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 29 */   0,  0,  0,  0,  0, 28, 29, 30,  0,  0,  0, 68, 32, 33, 34, 35, 36, 37, 38, 32, 39, 40, 40, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 30 */   0, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 31 */   0,  0,  0,  0,  0, 28, 29, 30,  0,  0,  0,  0, 32, 33, 34, 35, 36, 37, 38, 32, 39, 31, 40, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 32 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0, 32, 33, 34, 35, 36,  0,  0,  0,  0,  0,  0, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 33 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 33, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 45, 46,  0,  0,  0,
+  /* 34 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 35 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 36 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 37 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0, 32, 33, 34, 35, 36,  0, 38, 32,  0,  0,  0, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 38 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0, 32, 33, 34, 35, 36,  0,  0, 32,  0,  0,  0, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 39 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0, 32, 33, 34, 35, 36, 37, 38, 32,  0,  0,  0, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 40 */   0,  0,  0,  0,  0, 28, 29, 30,  0,  0,  0,  0, 32, 33, 34, 35, 36, 37, 38, 32, 39,  0, 40, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 41 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 33, 34, 35, 36,  0,  0,  0,  0,  0,  0, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 42 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 33, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 43 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0, 33, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0, 43, 44, 45, 46,  0,  0,  0,
+  /* 44 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 45, 46,  0,  0,  0,
+  /* 45 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 46,  0,  0,  0,
+  /* 46 */   0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0, 34, 35, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+  /* 47 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 48 */   0,  0,  0,  0,  0, 47, 48, 49,  0,  0,  0, 69,  0, 51, 52, 53, 54, 55, 56, 51, 57, 58, 58,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 49 */   0, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 50 */   0,  0,  0,  0,  0, 47, 48, 49,  0,  0,  0,  0,  0, 51, 52, 53, 54, 55, 56, 51, 57, 50, 58,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 51 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0, 51, 52, 53, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 52 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0, 52, 53, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 53 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 54 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 55 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0, 51, 52, 53, 54,  0, 56, 51,  0,  0,  0,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 56 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0, 51, 52, 53, 54,  0,  0, 51,  0,  0,  0,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 57 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0, 51, 52, 53, 54, 55, 56, 51,  0,  0,  0,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 58 */   0,  0,  0,  0,  0, 47, 48, 49,  0,  0,  0,  0,  0, 51, 52, 53, 54, 55, 56, 51, 57,  0, 58,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 59 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0, 52, 53, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+  /* 60 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0, 52, 53, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60, 61,  0,  0,  0,
+  /* 61 */   0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0, 52, 53, 54,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61,  0,  0,  0,
+  /* 62 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 63 */   0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 64 */   0,  0,  0,  0,  0,  0,  0, 62, 63,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 65 */   0,  0,  0,  0,  0,  6,  7,  8,  0,  0,  0,  0, 11, 12, 13, 14, 15, 16, 17, 11, 18, 20, 20, 21, 22, 23, 24, 25, 26,  0,  0,  0,
+  /* 66 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66, 67,  0,
+  /* 67 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 67,  0,
+  /* 68 */   0,  0,  0,  0,  0, 28, 29, 30,  0,  0,  0,  0, 32, 33, 34, 35, 36, 37, 38, 32, 39, 40, 40, 41, 42, 43, 44, 45, 46,  0,  0,  0,
+  /* 69 */   0,  0,  0,  0,  0, 47, 48, 49,  0,  0,  0,  0,  0, 51, 52, 53, 54, 55, 56, 51, 57, 58, 58,  0,  0,  0, 59, 60, 61,  0,  0,  0,
+};
+
+static const uint8_t _use_syllable_machine_accepting[70] =
+{
+   0, 0, 1, 3, 4, 6, 8, 8, 0, 8, 7, 8, 8, 8, 8, 8,
+   8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1, 3, 3, 2, 3,
+   3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+   4, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 0,
+   6, 8, 7, 7, 3, 4,
+};
+
+static const uint8_t _use_syllable_machine_syllable_types[8] =
+{
+  independent_cluster,
+  virama_terminated_cluster,
+  consonant_cluster,
+  vowel_cluster,
+  number_joiner_terminated_cluster,
+  numeral_cluster,
+  symbol_cluster,
+  broken_cluster,
+};
+
+static const hb_syllable_machine_t<uint8_t> use_syllable_machine =
+{
+  43, /* num_categories */
+  32, /* num_classes */
+  _use_syllable_machine_classes,
+  _use_syllable_machine_transitions,
+  _use_syllable_machine_accepting,
+  _use_syllable_machine_syllable_types,
+}; /* 70 states; table size: 2362 bytes */
+
+static void
+find_syllables (hb_buffer_t *buffer)
+{
+  hb_find_syllables (use_syllable_machine, buffer,
+		     &buffer->info[0].use_category(), sizeof (buffer->info[0]));
+}
+
+#endif /* HB_OT_SHAPE_COMPLEX_USE_MACHINE_HH */
+
+/* == End of generated table == */
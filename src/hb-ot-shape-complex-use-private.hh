@@ -94,4 +94,13 @@ enum use_category_t {
 HB_INTERNAL USE_TABLE_ELEMENT_TYPE
 hb_use_get_categories (hb_codepoint_t u);
 
+/* Same, for count characters at once; unicode_stride and category_stride
+ * are in bytes, so this can be used directly on glyph info arrays. */
+HB_INTERNAL void
+hb_use_get_categories_batch (unsigned int            count,
+			     const hb_codepoint_t   *first_unicode,
+			     unsigned int            unicode_stride,
+			     USE_TABLE_ELEMENT_TYPE *first_category,
+			     unsigned int            category_stride);
+
 #endif /* HB_OT_SHAPE_COMPLEX_USE_PRIVATE_HH */
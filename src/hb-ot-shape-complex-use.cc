@@ -258,8 +258,9 @@ setup_masks_use (const hb_ot_shape_plan_t *plan,
 
   unsigned int count = buffer->len;
   hb_glyph_info_t *info = buffer->info;
-  for (unsigned int i = 0; i < count; i++)
-    info[i].use_category() = hb_use_get_categories (info[i].codepoint);
+  hb_use_get_categories_batch (count,
+			       &info[0].codepoint, sizeof (info[0]),
+			       &info[0].use_category(), sizeof (info[0]));
 }
 
 static void
@@ -351,6 +352,8 @@ setup_syllables (const hb_ot_shape_plan_t *plan,
 		 hb_buffer_t *buffer)
 {
   find_syllables (buffer);
+  foreach_syllable (buffer, start, end)
+    buffer->unsafe_to_break (start, end);
   setup_rphf_mask (plan, buffer);
   setup_topographical_masks (plan, buffer);
 }
@@ -200,8 +200,8 @@ position_mark (const hb_ot_shape_plan_t *plan,
 	       unsigned int combining_class)
 {
   hb_glyph_extents_t mark_extents;
-  if (!font->get_glyph_extents (buffer->info[i].codepoint,
-				&mark_extents))
+  if (!font->get_glyph_extents_cached (buffer->info[i].codepoint,
+				       &mark_extents))
     return;
 
   hb_position_t y_gap = font->y_scale / 16;
@@ -308,8 +308,8 @@ position_around_base (const hb_ot_shape_plan_t *plan,
 {
   hb_direction_t horiz_dir = HB_DIRECTION_INVALID;
   hb_glyph_extents_t base_extents;
-  if (!font->get_glyph_extents (buffer->info[base].codepoint,
-				&base_extents))
+  if (!font->get_glyph_extents_cached (buffer->info[base].codepoint,
+				       &base_extents))
   {
     /* If extents don't work, zero marks and go home. */
     zero_mark_advances (buffer, base + 1, end);
@@ -463,6 +463,9 @@ _hb_ot_shape_fallback_kern (const hb_ot_shape_plan_t *plan,
 					   buffer->props.direction,
 					   &x_kern, &y_kern);
 
+    if (x_kern || y_kern)
+      buffer->unsafe_to_break (idx, skippy_iter.idx + 1);
+
     if (x_kern)
     {
       hb_position_t kern1 = x_kern >> 1;
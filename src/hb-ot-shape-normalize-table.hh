@@ -0,0 +1,883 @@
+/* == Start of generated table == */
+/*
+ * The following table is generated by running:
+ *
+ *   ./gen-normalization-table.py DerivedNormalizationProps.txt UnicodeData.txt
+ *
+ * on files with these headers:
+ *
+ * # DerivedNormalizationProps-8.0.0.txt
+ * UnicodeData.txt does not have a header.
+ */
+
+#ifndef HB_OT_SHAPE_NORMALIZE_TABLE_HH
+#define HB_OT_SHAPE_NORMALIZE_TABLE_HH
+
+
+#define NORMALIZATION_QC_NFD_NO	1u /* NFD_QC is No. */
+#define NORMALIZATION_QC_NFC_NO	2u /* NFC_QC is No or Maybe. */
+
+static const uint8_t normalization_qc_index[] =
+{
+  /* 00000 */   0,  1,  2,  3,  4,  0,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+  /* 00800 */  15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+  /* 01000 */  31, 32, 33, 34, 35, 36, 37, 38,  0,  0,  0,  0,  0, 39, 40, 41,
+  /* 01800 */  42, 43, 44, 45, 46, 47, 48, 49, 50, 51,  0, 52, 53, 54, 55, 56,
+  /* 02000 */  57, 58, 59, 60, 61, 62, 63, 64, 65,  0,  0,  0,  0,  0,  0,  0,
+  /* 02800 */   0,  0,  0,  0,  0, 66, 67, 68, 69, 70, 71, 72, 73, 74,  0, 75,
+  /* 03000 */  76, 77, 78, 79, 80, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 03800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 04000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 04800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  0,  0,  0,  0,
+  /* 05000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 05800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 06000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 06800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 07000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 07800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 08000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 08800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 09000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 09800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,
+  /* 0A000 */   0,  0,  0,  0,  0,  0,  0,  0,  0, 84,  0,  0, 85, 86,  0, 87,
+  /* 0A800 */  88, 89, 90, 91, 92, 93, 94, 95, 53, 53, 53, 53, 53, 53, 53, 53,
+  /* 0B000 */  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  /* 0B800 */  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  /* 0C000 */  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  /* 0C800 */  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  /* 0D000 */  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 96,
+  /* 0D800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0E000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0E800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0F000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 0F800 */   0,  0, 97, 97, 98, 97, 99,100,  0,  0,101,102,103,104,105,106,
+  /* 10000 */ 107, 64,108,109, 97,110,111,112,  0,113,114, 97,  0,  0,115, 97,
+  /* 10800 */ 116,117,118,119,120,121,122,123,124,125, 97, 97,126, 97, 97, 97,
+  /* 11000 */ 127,128,129,130,131,132,133, 97, 97,134, 97,135,136,137,138, 97,
+  /* 11800 */  97,139, 97, 97, 97,140, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 12000 */   0,  0,  0,  0,  0,  0,  0,141,142,  0,143, 97, 97, 97, 97, 97,
+  /* 12800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 13000 */   0,  0,  0,  0,  0,  0,  0,  0,144, 97, 97, 97, 97, 97, 97, 97,
+  /* 13800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 14000 */  97, 97, 97, 97, 97, 97, 97, 97,  0,  0,  0,  0,145, 97, 97, 97,
+  /* 14800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 15000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 15800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 16000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 16800 */   0,  0,  0,  0,146,147,148,149, 97, 97, 97, 97, 97, 97,150,151,
+  /* 17000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 17800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 18000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 18800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 19000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 19800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1A000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1A800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1B000 */ 152, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1B800 */  97, 97, 97, 97, 97, 97, 97, 97,153,154, 97, 97, 97, 97, 97, 97,
+  /* 1C000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1C800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1D000 */   0,155,156,157,158, 97,159, 97,160,161,162,  0,  0,163,  0,164,
+  /* 1D800 */   0,  0,  0,  0,  0,165, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1E000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 1E800 */   0,166, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,167,168, 97, 97,
+  /* 1F000 */ 169,170,171,172,173, 97,  0,  0,  0,  0,174,175,  0,176,177,178,
+  /* 1F800 */ 179,180,181,182, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 20000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 20800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 21000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 21800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 22000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 22800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 23000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 23800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 24000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 24800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 25000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 25800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 26000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 26800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 27000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 27800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 28000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 28800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 29000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 29800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 2A000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,183,  0,  0,
+  /* 2A800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 2B000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,184,  0,
+  /* 2B800 */ 185,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 2C000 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  /* 2C800 */   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,186, 97, 97,
+  /* 2D000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 2D800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 2E000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 2E800 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 2F000 */  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  /* 2F800 */  97, 97, 97, 97, 97,
+};
+
+static const uint8_t normalization_qc_data[][32] =
+{
+  { /* 0 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 1 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x55u,0x45u,0x55u,0x55u,0x54u,0x15u,0x54u,0x05u,0x55u,0x45u,0x55u,0x55u,0x54u,0x15u,0x54u,0x45u,
+  },
+  { /* 2 */
+    0x55u,0x55u,0x55u,0x55u,0x50u,0x55u,0x55u,0x55u,0x55u,0x05u,0x55u,0x55u,0x01u,0x55u,0x54u,0x15u,
+    0x40u,0x55u,0x01u,0x55u,0x05u,0x55u,0x55u,0x55u,0x55u,0x05u,0x55u,0x55u,0x55u,0x55u,0x55u,0x15u,
+  },
+  { /* 3 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x05u,0x00u,0x00u,0x40u,0x01u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x54u,0x55u,0x55u,0x55u,0x51u,0x55u,0x50u,0x55u,0x55u,0x01u,0x05u,0x55u,0x55u,
+  },
+  { /* 4 */
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x50u,0x00u,0x50u,0x55u,0x55u,0x55u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 5 */
+    0xAAu,0xA2u,0xAAu,0x82u,0x88u,0x02u,0x80u,0x00u,0x80u,0xAAu,0x02u,0x28u,0x0Au,0x00u,0x02u,0x00u,
+    0xEFu,0x0Bu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x03u,0x0Fu,0x30u,
+  },
+  { /* 6 */
+    0xFFu,0xD4u,0xD5u,0x5Du,0x01u,0x00u,0x00u,0x00u,0x30u,0x00u,0x50u,0x55u,0x01u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x50u,0x15u,0x40u,0x01u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 7 */
+    0x45u,0x40u,0x00u,0x15u,0x00u,0x00u,0x04u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x04u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x45u,0x40u,0x00u,0x15u,0x00u,0x00u,0x00u,0x00u,0x00u,0x50u,0x00u,0x00u,
+  },
+  { /* 8 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x14u,0x00u,0x00u,0x00u,0x55u,0x50u,0x50u,0x55u,0x50u,0x55u,0x50u,0x55u,0x55u,0x05u,0x05u,0x00u,
+  },
+  { /* 9 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x03u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x03u,0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 10 */
+    0x00u,0x00u,0xC3u,0x03u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x00u,0xFCu,0xFFu,0xFFu,
+  },
+  { /* 11 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x50u,0x15u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x80u,0x0Au,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 12 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x11u,0x00u,0x00u,0x00u,0x40u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 13 */
+    0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xC0u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 14 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+  },
+  { /* 15 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0xC0u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xCFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 16 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 17 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x04u,0x00u,0x04u,0x01u,0x00u,0x02u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 18 */
+    0x00u,0x03u,0x00u,0x3Cu,0x3Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0xCCu,0x0Fu,0xF0u,0x20u,
+    0x00u,0x3Cu,0x7Cu,0xC1u,0xFFu,0xBFu,0xFFu,0xFFu,0x00u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,
+  },
+  { /* 19 */
+    0x03u,0x03u,0xC0u,0x3Fu,0x3Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0xCCu,0xF3u,0xF0u,0x0Cu,
+    0xC0u,0x3Fu,0x3Cu,0xF0u,0xF3u,0xFFu,0xFFu,0xFCu,0xFFu,0x0Fu,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,
+  },
+  { /* 20 */
+    0x03u,0x03u,0x00u,0x30u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x0Cu,0x03u,0xF0u,0x00u,
+    0x00u,0x30u,0x30u,0xF0u,0xFCu,0xFFu,0xFFu,0xFFu,0x00u,0x0Fu,0x00u,0x00u,0xF0u,0xFFu,0xF3u,0xFFu,
+  },
+  { /* 21 */
+    0x03u,0x03u,0x00u,0x3Cu,0x3Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x0Cu,0x03u,0xF0u,0x20u,
+    0x00u,0x3Cu,0x7Du,0xF1u,0xFFu,0xAFu,0xFFu,0x3Fu,0x00u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,
+  },
+  { /* 22 */
+    0x0Fu,0x03u,0xC0u,0x0Fu,0x0Cu,0xF1u,0xC3u,0x0Cu,0x3Fu,0xFCu,0xC0u,0x0Fu,0x00u,0x00u,0xF0u,0x2Fu,
+    0xC0u,0x0Fu,0x5Cu,0xF1u,0xFCu,0xBFu,0xFFu,0xFFu,0xFFu,0x0Fu,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+  },
+  { /* 23 */
+    0x00u,0x03u,0x00u,0x0Cu,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x00u,0x00u,0xF0u,0x03u,
+    0x00u,0x0Cu,0x0Du,0xF0u,0xFFu,0xE3u,0xC0u,0xFFu,0x00u,0x0Fu,0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,
+  },
+  { /* 24 */
+    0x03u,0x03u,0x00u,0x0Cu,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x00u,0x03u,0xF0u,0x00u,
+    0x21u,0x4Cu,0x5Du,0xF0u,0xFFu,0xEBu,0xFFu,0xCFu,0x00u,0x0Fu,0x00u,0x00u,0xC3u,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 25 */
+    0x03u,0x03u,0x00u,0x0Cu,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x23u,
+    0x00u,0x0Cu,0x5Cu,0xC1u,0xFFu,0xBFu,0xFFu,0x3Fu,0x00u,0x0Fu,0x00u,0x00u,0x00u,0xF0u,0x03u,0x00u,
+  },
+  { /* 26 */
+    0x0Fu,0x03u,0x00u,0x00u,0x00u,0xC0u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0xF3u,
+    0x00u,0xC0u,0xEFu,0xBFu,0x00u,0xCCu,0x10u,0x95u,0xFFu,0x0Fu,0x00u,0x00u,0x0Fu,0xFCu,0xFFu,0xFFu,
+  },
+  { /* 27 */
+    0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x3Fu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 28 */
+    0xC3u,0x3Cu,0xCCu,0xF3u,0xFFu,0x00u,0x03u,0x00u,0x03u,0x33u,0x0Fu,0x03u,0x00u,0x00u,0x30u,0xF0u,
+    0x00u,0xCCu,0x00u,0xF0u,0x00u,0x00u,0xF0u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 29 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0xC0u,0x00u,0x03u,0x0Cu,0x30u,0xC0u,0x00u,0x03u,0x00u,0x00u,0x0Cu,0xFCu,0xC3u,0x3Cu,0x03u,0x00u,
+  },
+  { /* 30 */
+    0x0Cu,0x00u,0x00u,0x00u,0xC0u,0x00u,0x03u,0x0Cu,0x30u,0xC0u,0x00u,0x03u,0x00u,0x00u,0x0Cu,0x0Cu,
+    0x00u,0x00u,0x00u,0x0Cu,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 31 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x10u,0x00u,0x20u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 32 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x30u,0xFFu,0xF3u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 33 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xA8u,0xAAu,0xAAu,0xAAu,0xAAu,0x0Au,0x00u,0x00u,
+  },
+  { /* 34 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xAAu,0xAAu,0xAAu,0xAAu,0xAAu,0xAAu,
+    0x2Au,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 35 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x0Cu,0xF0u,0x00u,0xC0u,0x0Cu,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 36 */
+    0x00u,0x00u,0x0Cu,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0xF0u,0x00u,0xC0u,
+    0x0Cu,0xF0u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 37 */
+    0x00u,0x00u,0x00u,0x00u,0x0Cu,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,
+  },
+  { /* 38 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0xF0u,
+  },
+  { /* 39 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,
+  },
+  { /* 40 */
+    0x00u,0x00u,0x00u,0x0Cu,0x00u,0xFCu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x0Cu,0x0Cu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 41 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0xF0u,0xFFu,
+  },
+  { /* 42 */
+    0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,
+  },
+  { /* 43 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,
+  },
+  { /* 44 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0xFFu,
+    0xFCu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0xFCu,0xFFu,0xFFu,
+  },
+  { /* 45 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0xC0u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 46 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x3Cu,
+  },
+  { /* 47 */
+    0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0xC0u,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 48 */
+    0x00u,0x10u,0x11u,0x11u,0x10u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x08u,0x40u,0x04u,
+    0x45u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,
+  },
+  { /* 49 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0x00u,
+  },
+  { /* 50 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x3Fu,0x00u,
+    0x00u,0x00u,0xF0u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 51 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xF0u,0xFFu,
+  },
+  { /* 52 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0x00u,
+  },
+  { /* 53 */
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,
+  },
+  { /* 54 */
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x45u,0x00u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x05u,0x00u,
+  },
+  { /* 55 */
+    0x55u,0x55u,0x55u,0x55u,0x55u,0xF5u,0x55u,0xF5u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,
+    0x55u,0xF5u,0x55u,0xF5u,0x55u,0x55u,0x77u,0x77u,0x55u,0x55u,0x55u,0x55u,0xDDu,0xDDu,0xDDu,0xFDu,
+  },
+  { /* 56 */
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x5Du,0xD5u,0x31u,
+    0x54u,0x5Du,0xDDu,0x55u,0xD5u,0x5Fu,0xD5u,0x57u,0xD5u,0x55u,0xD5u,0xF5u,0x5Fu,0x5Du,0xDDu,0xCDu,
+  },
+  { /* 57 */
+    0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,
+  },
+  { /* 58 */
+    0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0xFCu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,
+    0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 59 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 60 */
+    0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x50u,0x00u,0x00u,0x00u,0x00u,0x10u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x54u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 61 */
+    0x00u,0x01u,0x04u,0x01u,0x00u,0x00u,0x00u,0x00u,0x00u,0x11u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x04u,0x41u,0x04u,0x00u,0x00u,0x00u,0x00u,0x00u,0x11u,0x00u,0x00u,0x54u,0x05u,0x05u,0x05u,0x00u,
+  },
+  { /* 62 */
+    0x05u,0x05u,0x05u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x55u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x55u,0x00u,0x50u,0x05u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 63 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x3Cu,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 64 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+  },
+  { /* 65 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 66 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 67 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Fu,0x00u,0x00u,
+  },
+  { /* 68 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x03u,
+    0x00u,0x00u,0x0Cu,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 69 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 70 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x03u,0x00u,
+  },
+  { /* 71 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0xFFu,0xF3u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x3Fu,0xFCu,0xFFu,0xFFu,0x3Fu,
+  },
+  { /* 72 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0x00u,0xC0u,0x00u,0xC0u,0x00u,0xC0u,0x00u,0xC0u,
+    0x00u,0xC0u,0x00u,0xC0u,0x00u,0xC0u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 73 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 74 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 75 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0xFFu,
+  },
+  { /* 76 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x03u,0x00u,0x00u,0x11u,0x11u,0x11u,0x11u,0x11u,0x11u,0x44u,0x04u,0x00u,0x45u,0x51u,0x14u,0x05u,
+  },
+  { /* 77 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xC1u,0x2Bu,0x10u,0x00u,0x00u,0x00u,0x11u,0x11u,0x11u,0x11u,0x11u,
+    0x11u,0x44u,0x04u,0x00u,0x45u,0x51u,0x14u,0x05u,0x00u,0x00u,0x00u,0x00u,0x00u,0x41u,0x15u,0x10u,
+  },
+  { /* 78 */
+    0xFFu,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x03u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 79 */
+    0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 80 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 81 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,
+  },
+  { /* 82 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 83 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 84 */
+    0x00u,0x00u,0x00u,0xFCu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xC0u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 85 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 86 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,
+  },
+  { /* 87 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,
+  },
+  { /* 88 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0xF0u,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,
+  },
+  { /* 89 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xFCu,0xFFu,0x0Fu,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,
+  },
+  { /* 90 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,
+  },
+  { /* 91 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0xF0u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,
+  },
+  { /* 92 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 93 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,
+  },
+  { /* 94 */
+    0x03u,0xC0u,0x03u,0xC0u,0x03u,0xC0u,0xFFu,0xFFu,0x00u,0xC0u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 95 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0xF0u,0xFFu,
+  },
+  { /* 96 */
+    0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0x55u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xC0u,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,
+  },
+  { /* 97 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 98 */
+    0xFFu,0xFFu,0xFFu,0x0Fu,0x33u,0xFCu,0xFFu,0x3Fu,0x33u,0x3Cu,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 99 */
+    0x00u,0xC0u,0xFFu,0xFFu,0x3Fu,0x00u,0xFFu,0xCFu,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 100 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0xF0u,0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 101 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 102 */
+    0x00u,0x00u,0x00u,0x00u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0xF0u,
+  },
+  { /* 103 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0xFFu,0x00u,0x0Cu,0x00u,0x00u,
+  },
+  { /* 104 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x3Cu,
+  },
+  { /* 105 */
+    0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 106 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,
+    0x0Fu,0x00u,0x0Fu,0x00u,0x0Fu,0x00u,0x0Fu,0xFCu,0x00u,0xC0u,0x00u,0xC0u,0xFFu,0xFFu,0x03u,0xF0u,
+  },
+  { /* 107 */
+    0x00u,0x00u,0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x30u,
+    0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 108 */
+    0xC0u,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x3Fu,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 109 */
+    0x00u,0x00u,0x00u,0xFCu,0x00u,0x00u,0x00u,0xFFu,0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,
+  },
+  { /* 110 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,
+  },
+  { /* 111 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xC0u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+  },
+  { /* 112 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xFFu,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 113 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 114 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0x3Fu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 115 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 116 */
+    0x00u,0xF0u,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0xFCu,0x3Cu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 117 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x3Fu,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0xC0u,0xF0u,0x3Fu,0x00u,
+  },
+  { /* 118 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x3Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x3Fu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 119 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 120 */
+    0x00u,0xC3u,0xFFu,0x00u,0x00u,0x03u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xC0u,0x3Fu,
+    0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0xFCu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 121 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x3Fu,0x00u,0x00u,0xC0u,0xFFu,0xFFu,
+  },
+  { /* 122 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x03u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x00u,0x00u,
+  },
+  { /* 123 */
+    0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0x03u,0xFCu,0xFFu,0xFFu,0x03u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 124 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 125 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x0Fu,0x00u,
+  },
+  { /* 126 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,
+  },
+  { /* 127 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0xF0u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0x3Fu,
+  },
+  { /* 128 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x10u,0x01u,0x00u,0x00u,0x40u,0x00u,0x00u,0x00u,0x20u,0x00u,
+    0xF0u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0x00u,0x00u,0xF0u,0xFFu,
+  },
+  { /* 129 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x80u,0x00u,0x50u,0x00u,0x0Cu,0x00u,0x00u,
+    0x00u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,
+  },
+  { /* 130 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,
+  },
+  { /* 131 */
+    0x00u,0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 132 */
+    0x00u,0xC0u,0x0Cu,0x30u,0x00u,0x00u,0x00u,0x30u,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x00u,0x00u,0xF0u,0xFFu,
+  },
+  { /* 133 */
+    0x00u,0x03u,0x00u,0x3Cu,0x3Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x0Cu,0x03u,0xF0u,0x20u,
+    0x00u,0x3Cu,0x7Cu,0xF1u,0xFCu,0xBFu,0xFFu,0x03u,0x00u,0x0Fu,0x00u,0xFCu,0x00u,0xFCu,0xFFu,0xFFu,
+  },
+  { /* 134 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x02u,0x00u,0x60u,0x19u,
+    0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 135 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x80u,0x00u,0xF0u,0x50u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 136 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xFCu,0xFFu,0xFFu,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 137 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,
+    0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 138 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x03u,0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 139 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0x3Fu,
+  },
+  { /* 140 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,
+  },
+  { /* 141 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 142 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0xFCu,0xFFu,0xFFu,
+  },
+  { /* 143 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 144 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 145 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 146 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0xF0u,0x0Fu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 147 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0xF0u,0xFFu,0xFFu,
+  },
+  { /* 148 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xF0u,0xFFu,0xFFu,0x00u,0x00u,0x30u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x03u,
+  },
+  { /* 149 */
+    0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 150 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xFCu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,
+  },
+  { /* 151 */
+    0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 152 */
+    0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 153 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0x00u,0x00u,0x00u,0xFCu,
+  },
+  { /* 154 */
+    0x00u,0x00u,0xFCu,0xFFu,0x00u,0x00u,0xF0u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 155 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,
+  },
+  { /* 156 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 157 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+    0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 158 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 159 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 160 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 161 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x0Cu,0xCFu,0xC3u,0x03u,0x0Cu,0x00u,0x00u,0x30u,0x03u,
+    0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 162 */
+    0x00u,0x30u,0xC0u,0x03u,0x00u,0x0Cu,0x00u,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0xC0u,
+    0x00u,0xCCu,0x0Fu,0x00u,0x0Cu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 163 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 164 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 165 */
+    0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0x3Fu,0x00u,0x03u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 166 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x3Cu,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 167 */
+    0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC3u,0x3Cu,0x03u,0x00u,0xC0u,0x00u,0x33u,0xFFu,
+    0xCFu,0x3Fu,0x33u,0x03u,0xC3u,0x3Cu,0x33u,0x33u,0xC3u,0x3Cu,0xC0u,0x00u,0xC0u,0x00u,0x03u,0xCCu,
+  },
+  { /* 168 */
+    0x00u,0x00u,0x30u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x03u,0x03u,0x30u,0x00u,0x00u,0x00u,0x00u,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xF0u,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 169 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 170 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0xC0u,0x03u,0x00u,0x00u,0x00u,
+    0x03u,0x00u,0x00u,0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,
+  },
+  { /* 171 */
+    0x00u,0x00u,0x00u,0xFCu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 172 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0x0Fu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 173 */
+    0xC0u,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,
+    0x00u,0x00u,0xFCu,0xFFu,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 174 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x30u,0x00u,
+  },
+  { /* 175 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x03u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 176 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0x00u,0xFCu,0x00u,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 177 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 178 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 179 */
+    0x00u,0x00u,0x00u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0xF0u,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 180 */
+    0x00u,0x00u,0xFFu,0xFFu,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 181 */
+    0xFFu,0xFFu,0xFFu,0xFFu,0x00u,0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 182 */
+    0x00u,0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFCu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 183 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0xC0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+  { /* 184 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xFCu,0xFFu,0xFFu,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 185 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,
+  },
+  { /* 186 */
+    0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0x00u,0xF0u,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+    0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,0xFFu,
+  },
+}; /* Table items: 7509; blocks: 187 */
+
+static inline unsigned int
+normalization_quick_check (hb_codepoint_t u)
+{
+  if (unlikely (u >= 0x2FA80u))
+    return NORMALIZATION_QC_NFD_NO | NORMALIZATION_QC_NFC_NO;
+  return (normalization_qc_data[normalization_qc_index[u >> 7]][(u & 127) >> 2] >> ((u & 3) << 1)) & 3;
+}
+
+
+#endif /* HB_OT_SHAPE_NORMALIZE_TABLE_HH */
+
+/* == End of generated table == */
@@ -27,6 +27,7 @@
 #include "hb-ot-shape-normalize-private.hh"
 #include "hb-ot-shape-complex-private.hh"
 #include "hb-ot-shape-private.hh"
+#include "hb-ot-shape-normalize-table.hh"
 
 
 /*
@@ -284,37 +285,173 @@ compare_combining_class (const hb_glyph_info_t *pa, const hb_glyph_info_t *pb)
 }
 
 
-void
-_hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
-			hb_buffer_t *buffer,
-			hb_font_t *font)
+/* Reorders the marks in out_info[start, end), like hb_buffer_t::sort()
+ * does for info[]. */
+static void
+sort_out (hb_buffer_t *buffer, unsigned int start, unsigned int end)
 {
-  if (unlikely (!buffer->len)) return;
+  hb_glyph_info_t *out_info = buffer->out_info;
+  for (unsigned int i = start + 1; i < end; i++)
+  {
+    unsigned int j = i;
+    while (j > start && compare_combining_class (&out_info[j - 1], &out_info[i]) > 0)
+      j--;
+    if (i == j)
+      continue;
+    /* Move item i to occupy place for item j, shift what's in between. */
+    buffer->merge_out_clusters (j, i + 1);
+    {
+      hb_glyph_info_t t = out_info[i];
+      memmove (&out_info[j + 1], &out_info[j], (i - j) * sizeof (hb_glyph_info_t));
+      out_info[j] = t;
+    }
+  }
+}
 
-  _hb_buffer_assert_unicode_vars (buffer);
+static void
+reorder_marks (hb_buffer_t *buffer, unsigned int start, unsigned int end,
+	       bool in_output)
+{
+  hb_glyph_info_t *info = in_output ? buffer->out_info : buffer->info;
+  for (unsigned int i = start; i < end; i++)
+  {
+    if (_hb_glyph_info_get_modified_combining_class (&info[i]) == 0)
+      continue;
 
-  hb_ot_shape_normalization_mode_t mode = plan->shaper->normalization_preference;
-  const hb_ot_shape_normalize_context_t c = {
-    plan,
-    buffer,
-    font,
-    buffer->unicode,
-    plan->shaper->decompose ? plan->shaper->decompose : decompose_unicode,
-    plan->shaper->compose   ? plan->shaper->compose   : compose_unicode
-  };
+    unsigned int run_end;
+    for (run_end = i + 1; run_end < end; run_end++)
+      if (_hb_glyph_info_get_modified_combining_class (&info[run_end]) == 0)
+        break;
 
-  bool always_short_circuit = mode == HB_OT_SHAPE_NORMALIZATION_MODE_NONE;
-  bool might_short_circuit = always_short_circuit ||
-			     (mode != HB_OT_SHAPE_NORMALIZATION_MODE_DECOMPOSED &&
-			      mode != HB_OT_SHAPE_NORMALIZATION_MODE_COMPOSED_DIACRITICS_NO_SHORT_CIRCUIT);
-  unsigned int count;
+    /* We are going to do a O(n^2).  Only do this if the sequence is short. */
+    if (run_end - i > 10) {
+      i = run_end;
+      continue;
+    }
 
-  /* We do a fairly straightforward yet custom normalization process in three
-   * separate rounds: decompose, reorder, recompose (if desired).  Currently
-   * this makes two buffer swaps.  We can make it faster by moving the last
-   * two rounds into the inner loop for the first round, but it's more readable
-   * this way. */
+    if (in_output)
+      sort_out (buffer, i, run_end);
+    else
+      buffer->sort (i, run_end, compare_combining_class);
 
+    i = run_end;
+  }
+}
+
+static inline bool
+compose_with_starter (const hb_ot_shape_normalize_context_t *c,
+		      const hb_glyph_info_t &starter,
+		      const hb_glyph_info_t &prev,
+		      bool prev_is_starter,
+		      const hb_glyph_info_t &cur,
+		      hb_codepoint_t *composed,
+		      hb_codepoint_t *glyph)
+{
+  return /* We don't try to compose a non-mark character with it's preceding starter.
+	  * This is both an optimization to avoid trying to compose every two neighboring
+	  * glyphs in most scripts AND a desired feature for Hangul.  Apparently Hangul
+	  * fonts are not designed to mix-and-match pre-composed syllables and Jamo. */
+	 HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&cur)) &&
+	 /* If there's anything between the starter and this char, they should have CCC
+	  * smaller than this character's. */
+	 (prev_is_starter ||
+	  _hb_glyph_info_get_modified_combining_class (&prev) < _hb_glyph_info_get_modified_combining_class (&cur)) &&
+	 /* And compose. */
+	 c->compose (c, starter.codepoint, cur.codepoint, composed) &&
+	 /* And the font has glyph for the composite. */
+	 c->font->get_nominal_glyph (*composed, glyph);
+}
+
+/* Like hb_buffer_t::merge_out_clusters (start, end), for recomposing in
+ * place: the text following out_info[end - 1] continues at out_info[next],
+ * then at info[idx]. */
+static void
+merge_recomposed_clusters (hb_buffer_t *buffer,
+			   unsigned int start,
+			   unsigned int end,
+			   unsigned int next)
+{
+  if (buffer->cluster_level == HB_BUFFER_CLUSTER_LEVEL_CHARACTERS)
+    return;
+
+  hb_glyph_info_t *out_info = buffer->out_info;
+  unsigned int cluster = out_info[start].cluster;
+
+  for (unsigned int i = start + 1; i < end; i++)
+    cluster = MIN (cluster, out_info[i].cluster);
+
+  /* Extend start */
+  while (start && out_info[start - 1].cluster == out_info[start].cluster)
+    start--;
+
+  /* Extend end, into the rest of the out-buffer and then the buffer. */
+  unsigned int last = out_info[end - 1].cluster;
+  unsigned int i;
+  for (i = next; i < buffer->out_len && out_info[i].cluster == last; i++)
+    out_info[i].cluster = cluster;
+  if (i == buffer->out_len)
+    for (i = buffer->idx; i < buffer->len && buffer->info[i].cluster == last; i++)
+      buffer->info[i].cluster = cluster;
+
+  for (i = start; i < end; i++)
+    out_info[i].cluster = cluster;
+}
+
+/* Recomposes out_info[start, end), where out_info[start] is a starter or
+ * the start of text.  Removes the characters that composed, moving what
+ * follows end down.  Returns the new end. */
+static unsigned int
+recompose_out (const hb_ot_shape_normalize_context_t *c,
+	       unsigned int start,
+	       unsigned int end)
+{
+  hb_buffer_t * const buffer = c->buffer;
+  hb_glyph_info_t *out_info = buffer->out_info;
+
+  unsigned int starter = start;
+  unsigned int j = start + 1;
+  for (unsigned int i = start + 1; i < end; i++)
+  {
+    hb_codepoint_t composed, glyph;
+    if (compose_with_starter (c, out_info[starter], out_info[j - 1], starter == j - 1,
+			      out_info[i], &composed, &glyph))
+    {
+      /* Composes. */
+      out_info[j] = out_info[i];
+      merge_recomposed_clusters (buffer, starter, j + 1, i + 1);
+      /* Modify starter and carry on. */
+      out_info[starter].codepoint = composed;
+      out_info[starter].glyph_index() = glyph;
+      _hb_glyph_info_set_unicode_props (&out_info[starter], buffer);
+
+      continue;
+    }
+
+    /* Blocked, or doesn't compose. */
+    out_info[j++] = out_info[i];
+
+    if (_hb_glyph_info_get_modified_combining_class (&out_info[j - 1]) == 0)
+      starter = j - 1;
+  }
+
+  if (j < end)
+  {
+    memmove (&out_info[j], &out_info[end], (buffer->out_len - end) * sizeof (hb_glyph_info_t));
+    buffer->out_len -= end - j;
+  }
+  return j;
+}
+
+/* The decompose, reorder and recompose rounds, done separately over the
+ * whole buffer.  Kept as a reference for the single-pass normalizer. */
+static void
+normalize_in_rounds (const hb_ot_shape_normalize_context_t *c,
+		     bool recompose,
+		     bool might_short_circuit,
+		     bool always_short_circuit)
+{
+  hb_buffer_t * const buffer = c->buffer;
+  unsigned int count;
 
   /* First round, decompose */
 
@@ -327,38 +464,17 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
       if (likely (!HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&buffer->info[end]))))
         break;
 
-    decompose_cluster (&c, end, might_short_circuit, always_short_circuit);
+    decompose_cluster (c, end, might_short_circuit, always_short_circuit);
   }
   buffer->swap_buffers ();
 
 
   /* Second round, reorder (inplace) */
 
-  count = buffer->len;
-  for (unsigned int i = 0; i < count; i++)
-  {
-    if (_hb_glyph_info_get_modified_combining_class (&buffer->info[i]) == 0)
-      continue;
-
-    unsigned int end;
-    for (end = i + 1; end < count; end++)
-      if (_hb_glyph_info_get_modified_combining_class (&buffer->info[end]) == 0)
-        break;
-
-    /* We are going to do a O(n^2).  Only do this if the sequence is short. */
-    if (end - i > 10) {
-      i = end;
-      continue;
-    }
+  reorder_marks (buffer, 0, buffer->len, false);
 
-    buffer->sort (i, end, compare_combining_class);
-
-    i = end;
-  }
 
-
-  if (mode == HB_OT_SHAPE_NORMALIZATION_MODE_NONE ||
-      mode == HB_OT_SHAPE_NORMALIZATION_MODE_DECOMPOSED)
+  if (!recompose)
     return;
 
   /* Third round, recompose */
@@ -373,22 +489,9 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
   while (buffer->idx < count && !buffer->in_error)
   {
     hb_codepoint_t composed, glyph;
-    if (/* We don't try to compose a non-mark character with it's preceding starter.
-	 * This is both an optimization to avoid trying to compose every two neighboring
-	 * glyphs in most scripts AND a desired feature for Hangul.  Apparently Hangul
-	 * fonts are not designed to mix-and-match pre-composed syllables and Jamo. */
-	HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&buffer->cur())) &&
-	/* If there's anything between the starter and this char, they should have CCC
-	 * smaller than this character's. */
-	(starter == buffer->out_len - 1 ||
-	 _hb_glyph_info_get_modified_combining_class (&buffer->prev()) < _hb_glyph_info_get_modified_combining_class (&buffer->cur())) &&
-	/* And compose. */
-	c.compose (&c,
-		   buffer->out_info[starter].codepoint,
-		   buffer->cur().codepoint,
-		   &composed) &&
-	/* And the font has glyph for the composite. */
-	font->get_nominal_glyph (composed, &glyph))
+    if (compose_with_starter (c, buffer->out_info[starter], buffer->prev(),
+			      starter == buffer->out_len - 1,
+			      buffer->cur(), &composed, &glyph))
     {
       /* Composes. */
       buffer->next_glyph (); /* Copy to out-buffer. */
@@ -411,5 +514,132 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
       starter = buffer->out_len - 1;
   }
   buffer->swap_buffers ();
+}
+
+/* All three rounds in one pass over the buffer: each cluster is
+ * decomposed into the out-buffer, and the decomposed text is reordered and
+ * recomposed there as soon as a cluster starts with a non-mark.  Neither
+ * reordering nor recomposing ever cross such a character, so the result
+ * is the same as doing the rounds separately. */
+static void
+normalize_in_one_pass (const hb_ot_shape_normalize_context_t *c,
+		       bool recompose,
+		       bool might_short_circuit,
+		       bool always_short_circuit)
+{
+  hb_buffer_t * const buffer = c->buffer;
+
+  buffer->clear_output ();
+  unsigned int count = buffer->len;
+  unsigned int done = 0; /* out_info[0, done) is normalized. */
+  for (buffer->idx = 0; buffer->idx < count && !buffer->in_error;)
+  {
+    unsigned int end;
+    for (end = buffer->idx + 1; end < count; end++)
+      if (likely (!HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&buffer->info[end]))))
+        break;
+
+    unsigned int start = buffer->out_len;
+    decompose_cluster (c, end, might_short_circuit, always_short_circuit);
+
+    if (start > done && start < buffer->out_len &&
+	!HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&buffer->out_info[start])))
+    {
+      reorder_marks (buffer, done, start, true);
+      done = recompose ? recompose_out (c, done, start) : start;
+    }
+  }
+  if (likely (!buffer->in_error))
+  {
+    reorder_marks (buffer, done, buffer->out_len, true);
+    if (recompose)
+      recompose_out (c, done, buffer->out_len);
+  }
+  buffer->swap_buffers ();
+}
+
+/* Whether none of the text needs decomposing, reordering or recomposing:
+ * no marks, and quick-check Yes for the normalization form at hand. */
+static bool
+is_normalized (const hb_buffer_t *buffer, unsigned int qc_flag)
+{
+  const hb_glyph_info_t *info = buffer->info;
+  unsigned int count = buffer->len;
+
+  /* There are no marks, and NFC_QC is Yes, below U+0300.  Try that first,
+   * in a loop that's simple enough to vectorize. */
+  if (qc_flag == NORMALIZATION_QC_NFC_NO)
+  {
+    hb_codepoint_t max = 0;
+    for (unsigned int i = 0; i < count; i++)
+      max = MAX (max, info[i].codepoint);
+    if (max < 0x0300u)
+      return true;
+  }
+
+  for (unsigned int i = 0; i < count; i++)
+    if (HB_UNICODE_GENERAL_CATEGORY_IS_MARK (_hb_glyph_info_get_general_category (&info[i])) ||
+	(normalization_quick_check (info[i].codepoint) & qc_flag))
+      return false;
+  return true;
+}
+
+/* Maps the buffer to glyphs in place, or returns false if the font lacks
+ * any of the characters, which would need the fallbacks. */
+static bool
+set_glyphs (hb_buffer_t *buffer, hb_font_t *font)
+{
+  hb_glyph_info_t *info = buffer->info;
+  unsigned int count = buffer->len;
+  for (unsigned int i = 0; i < count; i++)
+    if (unlikely (!font->get_nominal_glyph (info[i].codepoint, &info[i].glyph_index())))
+      return false;
+  return true;
+}
+
+
+void
+_hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
+			hb_buffer_t *buffer,
+			hb_font_t *font)
+{
+  if (unlikely (!buffer->len)) return;
+
+  _hb_buffer_assert_unicode_vars (buffer);
 
+  hb_ot_shape_normalization_mode_t mode = plan->shaper->normalization_preference;
+  const hb_ot_shape_normalize_context_t c = {
+    plan,
+    buffer,
+    font,
+    buffer->unicode,
+    plan->shaper->decompose ? plan->shaper->decompose : decompose_unicode,
+    plan->shaper->compose   ? plan->shaper->compose   : compose_unicode
+  };
+
+  bool always_short_circuit = mode == HB_OT_SHAPE_NORMALIZATION_MODE_NONE;
+  bool might_short_circuit = always_short_circuit ||
+			     (mode != HB_OT_SHAPE_NORMALIZATION_MODE_DECOMPOSED &&
+			      mode != HB_OT_SHAPE_NORMALIZATION_MODE_COMPOSED_DIACRITICS_NO_SHORT_CIRCUIT);
+  bool recompose = mode != HB_OT_SHAPE_NORMALIZATION_MODE_NONE &&
+		   mode != HB_OT_SHAPE_NORMALIZATION_MODE_DECOMPOSED;
+
+  /* Most text is already normalized and has no marks; all it needs then is
+   * mapping to glyphs.  When not short-circuiting, that also requires the
+   * text to have no decompositions, which we can only tell for the Unicode
+   * ones. */
+  if ((might_short_circuit || !plan->shaper->decompose) &&
+      is_normalized (buffer, might_short_circuit ? NORMALIZATION_QC_NFC_NO : NORMALIZATION_QC_NFD_NO) &&
+      likely (set_glyphs (buffer, font)))
+    return;
+
+  /* We do a fairly straightforward yet custom normalization process in three
+   * steps: decompose, reorder, recompose (if desired).  They used to be three
+   * separate rounds over the buffer, with two buffer swaps; now they run
+   * interleaved, in a single pass.  HB_OPTIONS=normalize-in-rounds selects
+   * the old way, for comparison. */
+  if (unlikely (hb_options ().normalize_in_rounds))
+    normalize_in_rounds (&c, recompose, might_short_circuit, always_short_circuit);
+  else
+    normalize_in_one_pass (&c, recompose, might_short_circuit, always_short_circuit);
 }
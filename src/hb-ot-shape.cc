@@ -33,6 +33,7 @@
 
 #include "hb-ot-shape-private.hh"
 #include "hb-ot-shape-complex-private.hh"
+#include "hb-ot-shape-complex-arabic-private.hh"
 #include "hb-ot-shape-fallback-private.hh"
 #include "hb-ot-shape-normalize-private.hh"
 
@@ -41,6 +42,8 @@
 #include "hb-set-private.hh"
 
 
+HB_SHAPER_DATA_ENSURE_DECLARE(ot, face)
+
 static hb_tag_t common_features[] = {
   HB_TAG('c','c','m','p'),
   HB_TAG('l','o','c','l'),
@@ -478,8 +481,12 @@ hb_ot_hide_default_ignorables (hb_ot_shape_context_t *c)
 	 * Same logic as buffer->delete_glyph(), but for in-place removal. */
 
 	unsigned int cluster = info[i].cluster;
+	unsigned int flags = info[i].mask & HB_GLYPH_FLAG_DEFINED;
 	if (i + 1 < count && cluster == info[i + 1].cluster)
+	{
+	  info[i + 1].mask |= flags;
 	  continue; /* Cluster survives; do nothing. */
+	}
 
 	if (j)
 	{
@@ -488,13 +495,19 @@ hb_ot_hide_default_ignorables (hb_ot_shape_context_t *c)
 	  {
 	    unsigned int old_cluster = info[j - 1].cluster;
 	    for (unsigned k = j; k && info[k - 1].cluster == old_cluster; k--)
+	    {
 	      info[k - 1].cluster = cluster;
+	      info[k - 1].mask |= flags;
+	    }
 	  }
 	  continue;
 	}
 
 	if (i + 1 < count)
+	{
 	  buffer->merge_clusters (i, i + 2); /* Merge cluster forward. */
+	  info[i + 1].mask |= flags;
+	}
 
 	continue;
       }
@@ -764,6 +777,27 @@ hb_ot_position (hb_ot_shape_context_t *c)
 }
 
 
+static void
+hb_propagate_flags (hb_buffer_t *buffer)
+{
+  /* Make the glyph flags of a cluster the same on all its glyphs, so
+   * clients only need to look at one of them. */
+  if (!(buffer->scratch_flags & HB_BUFFER_SCRATCH_FLAG_HAS_UNSAFE_TO_BREAK))
+    return;
+
+  hb_glyph_info_t *info = buffer->info;
+  unsigned int count = buffer->len;
+  for (unsigned int start = 0, end; start < count; start = end)
+  {
+    unsigned int flags = 0;
+    for (end = start; end < count && info[end].cluster == info[start].cluster; end++)
+      flags |= info[end].mask & HB_GLYPH_FLAG_DEFINED;
+    if (flags)
+      for (unsigned int i = start; i < end; i++)
+	info[i].mask |= flags;
+  }
+}
+
 /* Pull it all together! */
 
 static void
@@ -801,6 +835,8 @@ hb_ot_shape_internal (hb_ot_shape_context_t *c)
   if (c->plan->shaper->postprocess_glyphs)
     c->plan->shaper->postprocess_glyphs (c->plan, c->buffer, c->font);
 
+  hb_propagate_flags (c->buffer);
+
   _hb_buffer_deallocate_unicode_vars (c->buffer);
 
   c->buffer->props.direction = c->target_direction;
@@ -838,6 +874,27 @@ hb_ot_shape_plan_collect_lookups (hb_shape_plan_t *shape_plan,
   HB_SHAPER_DATA_GET (shape_plan)->collect_lookups (table_tag, lookup_indexes);
 }
 
+/**
+ * hb_ot_shape_fallback_prepare:
+ * @font: a font.
+ *
+ * Builds the data fallback shaping needs for the face of @font, instead
+ * of on the first shaping call that needs it.  Currently these are the
+ * Arabic presentation-forms lookups synthesized for fonts that lack GSUB
+ * Arabic features.  The data is shared by all fonts of the face, which
+ * are assumed to map characters to glyphs the same way @font does.
+ *
+ * Return value: %false on allocation failure, %true otherwise.
+ *
+ * Since: 1.2.4
+ **/
+hb_bool_t
+hb_ot_shape_fallback_prepare (hb_font_t *font)
+{
+  if (unlikely (!hb_ot_shaper_face_data_ensure (font->face))) return false;
+  return arabic_fallback_prepare (font);
+}
+
 
 /* TODO Move this to hb-ot-shape-normalize, make it do decompose, and make it public. */
 static void
@@ -48,6 +48,9 @@ hb_ot_shape_plan_collect_lookups (hb_shape_plan_t *shape_plan,
 				  hb_tag_t         table_tag,
 				  hb_set_t        *lookup_indexes /* OUT */);
 
+HB_EXTERN hb_bool_t
+hb_ot_shape_fallback_prepare (hb_font_t *font);
+
 HB_END_DECLS
 
 #endif /* HB_OT_SHAPE_H */
@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef HB_OT_VORG_TABLE_HH
+#define HB_OT_VORG_TABLE_HH
+
+#include "hb-open-type-private.hh"
+
+
+namespace OT {
+
+
+/*
+ * VORG -- Vertical Origin Table
+ */
+
+#define HB_OT_TAG_VORG HB_TAG('V','O','R','G')
+
+
+struct VertOriginMetric
+{
+  inline int cmp (hb_codepoint_t g) const
+  {
+    return glyph.cmp (g);
+  }
+
+  inline bool sanitize (hb_sanitize_context_t *c) const
+  {
+    TRACE_SANITIZE (this);
+    return_trace (c->check_struct (this));
+  }
+
+  public:
+  GlyphID	glyph;		/* Glyph index. */
+  SHORT		vertOriginY;	/* Y coordinate, in the font's design
+				 * coordinate system, of the vertical
+				 * origin of glyph. */
+  public:
+  DEFINE_SIZE_STATIC (4);
+};
+
+struct VORG
+{
+  static const hb_tag_t tableTag = HB_OT_TAG_VORG;
+
+  inline bool sanitize (hb_sanitize_context_t *c) const
+  {
+    TRACE_SANITIZE (this);
+    return_trace (c->check_struct (this) &&
+		  likely (version.major == 1) &&
+		  vertYOrigins.sanitize (c));
+  }
+
+  inline int get_y_origin (hb_codepoint_t glyph) const
+  {
+    int i = vertYOrigins.bsearch (glyph);
+    if (i != -1)
+      return vertYOrigins[i].vertOriginY;
+    return defaultVertOriginY;
+  }
+
+  public:
+  FixedVersion<>version;		/* Version of VORG table. Set to 0x00010000u. */
+  SHORT		defaultVertOriginY;	/* The default vertical origin. */
+  SortedArrayOf<VertOriginMetric>
+		vertYOrigins;		/* The array of vertical origins, sorted
+					 * by glyph index. */
+  public:
+  DEFINE_SIZE_ARRAY (8, vertYOrigins);
+};
+
+
+} /* namespace OT */
+
+
+#endif /* HB_OT_VORG_TABLE_HH */
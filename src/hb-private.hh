@@ -992,6 +992,7 @@ struct hb_options_t
 {
   unsigned int initialized : 1;
   unsigned int uniscribe_bug_compatible : 1;
+  unsigned int normalize_in_rounds : 1;
 };
 
 union hb_options_union_t {
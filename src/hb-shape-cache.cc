@@ -0,0 +1,572 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "hb-private.hh"
+
+#include "hb-shape-plan-private.hh"
+#include "hb-buffer-private.hh"
+#include "hb-font-private.hh"
+#include "hb-mutex-private.hh"
+
+
+#ifndef HB_SHAPE_CACHE_SHARDS
+#define HB_SHAPE_CACHE_SHARDS 16
+#endif
+
+#ifndef HB_SHAPE_CACHE_MAX_LENGTH
+/* Longer texts, in characters or glyphs, are shaped but not cached. */
+#define HB_SHAPE_CACHE_MAX_LENGTH 64
+#endif
+
+
+/* Everything but the text that the result of shaping depends on.  The
+ * shape plan covers the face, segment properties, features and shaper.
+ * Compared with memcmp(), so unused context and padding are zeroed. */
+struct hb_shape_cache_key_t
+{
+  hb_shape_plan_t *shape_plan;
+  hb_font_t *font;
+  hb_font_funcs_t *klass;
+  void *font_data;
+  hb_unicode_funcs_t *unicode;
+  int x_scale;
+  int y_scale;
+  unsigned int x_ppem;
+  unsigned int y_ppem;
+  unsigned int flags;
+  unsigned int cluster_level;
+  hb_codepoint_t replacement;
+  unsigned int context_len[2];
+  hb_codepoint_t context[2][hb_buffer_t::CONTEXT_LENGTH];
+  unsigned int len;
+};
+
+struct hb_shape_cache_entry_t
+{
+  hb_shape_cache_entry_t *next; /* In its bucket. */
+  hb_shape_cache_entry_t *lru_prev;
+  hb_shape_cache_entry_t *lru_next;
+  uint32_t hash;
+  unsigned int num_glyphs;
+  hb_buffer_scratch_flags_t scratch_flags;
+  hb_shape_cache_key_t key;
+  /* Followed by key.len codepoint and cluster pairs, then num_glyphs
+   * glyph infos and num_glyphs glyph positions. */
+
+  inline const uint32_t *text (void) const
+  { return (const uint32_t *) (this + 1); }
+  inline hb_glyph_info_t *info (void)
+  { return (hb_glyph_info_t *) (text () + 2 * key.len); }
+  inline hb_glyph_position_t *pos (void)
+  { return (hb_glyph_position_t *) (info () + num_glyphs); }
+
+  inline bool matches (const hb_shape_cache_key_t *k, const uint32_t *t, uint32_t h) const
+  {
+    return hash == h &&
+	   0 == memcmp (&key, k, sizeof (key)) &&
+	   0 == memcmp (text (), t, 2 * key.len * sizeof (t[0]));
+  }
+};
+
+struct hb_shape_cache_shard_t
+{
+  hb_mutex_t lock;
+  unsigned int count;
+  unsigned int hits;
+  unsigned int misses;
+  hb_shape_cache_entry_t lru; /* Sentinel; most recently used first. */
+  hb_shape_cache_entry_t **buckets;
+};
+
+struct hb_shape_cache_t
+{
+  hb_object_header_t header;
+  ASSERT_POD ();
+
+  unsigned int max_entries; /* Per shard. */
+  unsigned int bucket_mask;
+  hb_shape_cache_shard_t *shards;
+};
+
+
+static hb_shape_cache_entry_t *
+_hb_shape_cache_entry_create (const hb_shape_cache_key_t *key,
+			      const uint32_t *text,
+			      uint32_t hash,
+			      hb_buffer_t *buffer)
+{
+  unsigned int num_glyphs = buffer->len;
+  hb_shape_cache_entry_t *entry = (hb_shape_cache_entry_t *) malloc (sizeof (hb_shape_cache_entry_t) +
+								     2 * key->len * sizeof (text[0]) +
+								     num_glyphs * (sizeof (buffer->info[0]) + sizeof (buffer->pos[0])));
+  if (unlikely (!entry))
+    return NULL;
+
+  entry->hash = hash;
+  entry->num_glyphs = num_glyphs;
+  entry->scratch_flags = buffer->scratch_flags & HB_BUFFER_SCRATCH_FLAG_HAS_UNSAFE_TO_BREAK;
+  entry->key = *key;
+  memcpy ((void *) entry->text (), text, 2 * key->len * sizeof (text[0]));
+  memcpy (entry->info (), buffer->info, num_glyphs * sizeof (buffer->info[0]));
+  memcpy (entry->pos (), buffer->pos, num_glyphs * sizeof (buffer->pos[0]));
+
+  hb_shape_plan_reference (key->shape_plan);
+  hb_font_reference (key->font);
+  hb_unicode_funcs_reference (key->unicode);
+
+  return entry;
+}
+
+static void
+_hb_shape_cache_entry_destroy (hb_shape_cache_entry_t *entry)
+{
+  hb_shape_plan_destroy (entry->key.shape_plan);
+  hb_font_destroy (entry->key.font);
+  hb_unicode_funcs_destroy (entry->key.unicode);
+  free (entry);
+}
+
+static inline void
+_lru_unlink (hb_shape_cache_entry_t *entry)
+{
+  entry->lru_prev->lru_next = entry->lru_next;
+  entry->lru_next->lru_prev = entry->lru_prev;
+}
+
+static inline void
+_lru_push_front (hb_shape_cache_shard_t *shard, hb_shape_cache_entry_t *entry)
+{
+  entry->lru_prev = &shard->lru;
+  entry->lru_next = shard->lru.lru_next;
+  entry->lru_next->lru_prev = entry;
+  shard->lru.lru_next = entry;
+}
+
+/* Removes and returns the least recently used entry.  Call locked. */
+static hb_shape_cache_entry_t *
+_hb_shape_cache_evict (hb_shape_cache_t *cache, hb_shape_cache_shard_t *shard)
+{
+  hb_shape_cache_entry_t *entry = shard->lru.lru_prev;
+  hb_shape_cache_entry_t **p = &shard->buckets[entry->hash & cache->bucket_mask];
+  while (*p != entry)
+    p = &(*p)->next;
+  *p = entry->next;
+  _lru_unlink (entry);
+  shard->count--;
+  return entry;
+}
+
+static inline uint32_t
+_hb_shape_cache_hash (const hb_shape_cache_key_t *key, const uint32_t *text)
+{
+  /* FNV-1a, a word at a time. */
+  uint32_t h = 2166136261u;
+  const char *bytes = (const char *) key;
+  for (unsigned int i = 0; i < sizeof (*key) / 4; i++)
+  {
+    uint32_t word;
+    memcpy (&word, bytes + 4 * i, 4);
+    h = (h ^ word) * 16777619u;
+  }
+  for (unsigned int i = 0; i < 2 * key->len; i++)
+    h = (h ^ text[i]) * 16777619u;
+  return h ^ (h >> 16);
+}
+
+
+/**
+ * hb_shape_cache_create: (Xconstructor)
+ * @max_entries: maximum number of shaped texts to keep
+ *
+ * Creates a cache of shaping results, for use with hb_shape_cache_shape().
+ * About @max_entries results are kept; the least recently used ones are
+ * dropped first.  Only texts of up to 64 characters are cached.
+ *
+ * The cache can be used from multiple threads at the same time.  It is
+ * split into 16 separately locked parts, each holding a share of the
+ * results, so @max_entries is rounded up to a multiple of 16.
+ *
+ * Return value: (transfer full): the new cache.
+ *
+ * Since: 1.2.4
+ **/
+hb_shape_cache_t *
+hb_shape_cache_create (unsigned int max_entries)
+{
+  hb_shape_cache_t *cache;
+
+  if (!max_entries ||
+      !(cache = hb_object_create<hb_shape_cache_t> ()))
+    return hb_shape_cache_get_empty ();
+
+  cache->max_entries = (max_entries + HB_SHAPE_CACHE_SHARDS - 1) / HB_SHAPE_CACHE_SHARDS;
+  unsigned int num_buckets = 1;
+  while (num_buckets < cache->max_entries)
+    num_buckets <<= 1;
+  cache->bucket_mask = num_buckets - 1;
+
+  cache->shards = (hb_shape_cache_shard_t *) calloc (HB_SHAPE_CACHE_SHARDS, sizeof (cache->shards[0]));
+  hb_shape_cache_entry_t **buckets = (hb_shape_cache_entry_t **) calloc (HB_SHAPE_CACHE_SHARDS * num_buckets, sizeof (buckets[0]));
+  if (unlikely (!cache->shards || !buckets))
+  {
+    free (cache->shards);
+    free (buckets);
+    free (cache);
+    return hb_shape_cache_get_empty ();
+  }
+
+  for (unsigned int i = 0; i < HB_SHAPE_CACHE_SHARDS; i++)
+  {
+    hb_shape_cache_shard_t *shard = &cache->shards[i];
+    shard->lock.init ();
+    shard->lru.lru_prev = shard->lru.lru_next = &shard->lru;
+    shard->buckets = buckets + i * num_buckets;
+  }
+
+  return cache;
+}
+
+/**
+ * hb_shape_cache_get_empty:
+ *
+ * Returns the empty cache, which shapes without caching anything.
+ *
+ * Return value: (transfer full): the empty cache.
+ *
+ * Since: 1.2.4
+ **/
+hb_shape_cache_t *
+hb_shape_cache_get_empty (void)
+{
+  static const hb_shape_cache_t _hb_shape_cache_nil = {
+    HB_OBJECT_HEADER_STATIC,
+
+    0, /* max_entries */
+    0, /* bucket_mask */
+    NULL, /* shards */
+  };
+
+  return const_cast<hb_shape_cache_t *> (&_hb_shape_cache_nil);
+}
+
+/**
+ * hb_shape_cache_reference: (skip)
+ * @cache: a shape cache.
+ *
+ * Return value: (transfer full): @cache.
+ *
+ * Since: 1.2.4
+ **/
+hb_shape_cache_t *
+hb_shape_cache_reference (hb_shape_cache_t *cache)
+{
+  return hb_object_reference (cache);
+}
+
+/**
+ * hb_shape_cache_destroy: (skip)
+ * @cache: a shape cache.
+ *
+ * Since: 1.2.4
+ **/
+void
+hb_shape_cache_destroy (hb_shape_cache_t *cache)
+{
+  if (!hb_object_destroy (cache)) return;
+
+  hb_shape_cache_clear (cache);
+  for (unsigned int i = 0; i < HB_SHAPE_CACHE_SHARDS; i++)
+    cache->shards[i].lock.finish ();
+  free (cache->shards[0].buckets);
+  free (cache->shards);
+
+  free (cache);
+}
+
+/**
+ * hb_shape_cache_set_user_data: (skip)
+ * @cache: a shape cache.
+ * @key:
+ * @data:
+ * @destroy:
+ * @replace:
+ *
+ * Return value:
+ *
+ * Since: 1.2.4
+ **/
+hb_bool_t
+hb_shape_cache_set_user_data (hb_shape_cache_t   *cache,
+			      hb_user_data_key_t *key,
+			      void *              data,
+			      hb_destroy_func_t   destroy,
+			      hb_bool_t           replace)
+{
+  return hb_object_set_user_data (cache, key, data, destroy, replace);
+}
+
+/**
+ * hb_shape_cache_get_user_data: (skip)
+ * @cache: a shape cache.
+ * @key:
+ *
+ * Return value: (transfer none):
+ *
+ * Since: 1.2.4
+ **/
+void *
+hb_shape_cache_get_user_data (hb_shape_cache_t   *cache,
+			      hb_user_data_key_t *key)
+{
+  return hb_object_get_user_data (cache, key);
+}
+
+/**
+ * hb_shape_cache_clear:
+ * @cache: a shape cache.
+ *
+ * Drops all cached results, and the references to fonts they hold.  Hit
+ * and miss counts are kept.
+ *
+ * Since: 1.2.4
+ **/
+void
+hb_shape_cache_clear (hb_shape_cache_t *cache)
+{
+  if (unlikely (!cache->shards))
+    return;
+
+  for (unsigned int i = 0; i < HB_SHAPE_CACHE_SHARDS; i++)
+  {
+    hb_shape_cache_shard_t *shard = &cache->shards[i];
+
+    shard->lock.lock ();
+    hb_shape_cache_entry_t *entries = shard->lru.lru_next;
+    shard->lru.lru_prev->lru_next = NULL;
+    shard->lru.lru_prev = shard->lru.lru_next = &shard->lru;
+    memset (shard->buckets, 0, (cache->bucket_mask + 1) * sizeof (shard->buckets[0]));
+    shard->count = 0;
+    shard->lock.unlock ();
+
+    /* Release outside the lock, as that may call user destroy callbacks. */
+    while (entries && entries != &shard->lru)
+    {
+      hb_shape_cache_entry_t *next = entries->lru_next;
+      _hb_shape_cache_entry_destroy (entries);
+      entries = next;
+    }
+  }
+}
+
+/**
+ * hb_shape_cache_get_stats:
+ * @cache: a shape cache.
+ * @hits: (out) (allow-none): number of texts shaped from the cache
+ * @misses: (out) (allow-none): number of cacheable texts that were not in
+ *    the cache
+ * @entries: (out) (allow-none): number of results currently cached
+ *
+ * Fetches counts of cache use since @cache was created, for example to
+ * tune the size passed to hb_shape_cache_create().  Texts that can't be
+ * cached are not counted.
+ *
+ * Since: 1.2.4
+ **/
+void
+hb_shape_cache_get_stats (hb_shape_cache_t *cache,
+			  unsigned int     *hits,
+			  unsigned int     *misses,
+			  unsigned int     *entries)
+{
+  unsigned int h = 0, m = 0, e = 0;
+  if (cache->shards)
+    for (unsigned int i = 0; i < HB_SHAPE_CACHE_SHARDS; i++)
+    {
+      hb_shape_cache_shard_t *shard = &cache->shards[i];
+      shard->lock.lock ();
+      h += shard->hits;
+      m += shard->misses;
+      e += shard->count;
+      shard->lock.unlock ();
+    }
+  if (hits) *hits = h;
+  if (misses) *misses = m;
+  if (entries) *entries = e;
+}
+
+static bool
+_hb_shape_cache_key_init (hb_shape_cache_key_t *key,
+			  uint32_t *text,
+			  hb_shape_plan_t *shape_plan,
+			  hb_font_t *font,
+			  hb_buffer_t *buffer,
+			  const hb_feature_t *features,
+			  unsigned int num_features)
+{
+  if (buffer->content_type != HB_BUFFER_CONTENT_TYPE_UNICODE ||
+      buffer->len > HB_SHAPE_CACHE_MAX_LENGTH ||
+      buffer->message_func ||
+      buffer->in_error)
+    return false;
+  /* Plans for such features are not shared, so would never match. */
+  for (unsigned int i = 0; i < num_features; i++)
+    if (features[i].start != 0 || features[i].end != (unsigned int) -1)
+      return false;
+
+  memset (key, 0, sizeof (*key));
+  key->shape_plan = shape_plan;
+  key->font = font;
+  key->klass = font->klass;
+  key->font_data = font->user_data;
+  key->unicode = buffer->unicode;
+  key->x_scale = font->x_scale;
+  key->y_scale = font->y_scale;
+  key->x_ppem = font->x_ppem;
+  key->y_ppem = font->y_ppem;
+  key->flags = buffer->flags;
+  key->cluster_level = buffer->cluster_level;
+  key->replacement = buffer->replacement;
+  for (unsigned int i = 0; i < 2; i++)
+  {
+    key->context_len[i] = buffer->context_len[i];
+    memcpy (key->context[i], buffer->context[i], buffer->context_len[i] * sizeof (buffer->context[i][0]));
+  }
+  key->len = buffer->len;
+
+  for (unsigned int i = 0; i < buffer->len; i++)
+  {
+    text[2 * i] = buffer->info[i].codepoint;
+    text[2 * i + 1] = buffer->info[i].cluster;
+  }
+
+  return true;
+}
+
+/**
+ * hb_shape_cache_shape:
+ * @cache: a shape cache.
+ * @font: an #hb_font_t to use for shaping
+ * @buffer: an #hb_buffer_t to shape
+ * @features: (array length=num_features) (allow-none): an array of user
+ *    specified #hb_feature_t or %NULL
+ * @num_features: the length of @features array
+ * @shaper_list: (array zero-terminated=1) (allow-none): a %NULL-terminated
+ *    array of shapers to use or %NULL
+ *
+ * Shapes @buffer like hb_shape_full() does, but looks the result up in
+ * @cache first, and adds it to @cache otherwise.  Useful when shaping the
+ * same short strings over and over.
+ *
+ * Results are found by the font object, its scale and ppem, the buffer
+ * properties, flags and context, and the text.  The cache holds a
+ * reference to each font it has results for, until they are dropped.
+ * Call hb_shape_cache_clear() after changing the font functions of a font,
+ * or of its parents, that was used with @cache.
+ *
+ * Texts with features that don't apply to the whole buffer, and buffers
+ * with a message function set, are shaped without the cache.
+ *
+ * Return value: %FALSE if all shapers failed, %TRUE otherwise
+ *
+ * Since: 1.2.4
+ **/
+hb_bool_t
+hb_shape_cache_shape (hb_shape_cache_t   *cache,
+		      hb_font_t          *font,
+		      hb_buffer_t        *buffer,
+		      const hb_feature_t *features,
+		      unsigned int        num_features,
+		      const char * const *shaper_list)
+{
+  hb_shape_plan_t *shape_plan = hb_shape_plan_create_cached (font->face, &buffer->props, features, num_features, shaper_list);
+
+  hb_shape_cache_key_t key;
+  uint32_t text[2 * HB_SHAPE_CACHE_MAX_LENGTH];
+  uint32_t hash = 0;
+  hb_shape_cache_shard_t *shard = NULL;
+  if (cache->shards &&
+      _hb_shape_cache_key_init (&key, text, shape_plan, font, buffer, features, num_features))
+  {
+    hash = _hb_shape_cache_hash (&key, text);
+    shard = &cache->shards[(hash >> 24) % HB_SHAPE_CACHE_SHARDS];
+
+    shard->lock.lock ();
+    hb_shape_cache_entry_t *entry = shard->buckets[hash & cache->bucket_mask];
+    while (entry && !entry->matches (&key, text, hash))
+      entry = entry->next;
+    if (entry && likely (buffer->ensure (entry->num_glyphs)))
+    {
+      buffer->len = entry->num_glyphs;
+      buffer->clear_positions ();
+      memcpy (buffer->info, entry->info (), entry->num_glyphs * sizeof (buffer->info[0]));
+      memcpy (buffer->pos, entry->pos (), entry->num_glyphs * sizeof (buffer->pos[0]));
+      buffer->scratch_flags |= entry->scratch_flags;
+      buffer->content_type = HB_BUFFER_CONTENT_TYPE_GLYPHS;
+      _lru_unlink (entry);
+      _lru_push_front (shard, entry);
+      shard->hits++;
+      shard->lock.unlock ();
+      hb_shape_plan_destroy (shape_plan);
+      return true;
+    }
+    shard->misses++;
+    shard->lock.unlock ();
+  }
+
+  hb_bool_t res = hb_shape_plan_execute (shape_plan, font, buffer, features, num_features);
+  hb_shape_plan_destroy (shape_plan);
+  if (!res)
+    return false;
+  buffer->content_type = HB_BUFFER_CONTENT_TYPE_GLYPHS;
+
+  if (shard && buffer->len <= HB_SHAPE_CACHE_MAX_LENGTH && likely (!buffer->in_error))
+  {
+    hb_shape_cache_entry_t *entry = _hb_shape_cache_entry_create (&key, text, hash, buffer);
+    if (unlikely (!entry))
+      return res;
+
+    shard->lock.lock ();
+    hb_shape_cache_entry_t **bucket = &shard->buckets[hash & cache->bucket_mask];
+    hb_shape_cache_entry_t *other = *bucket;
+    while (other && !other->matches (&key, text, hash))
+      other = other->next;
+    hb_shape_cache_entry_t *evicted = NULL;
+    if (other)
+      evicted = entry; /* Another thread got there first. */
+    else
+    {
+      entry->next = *bucket;
+      *bucket = entry;
+      _lru_push_front (shard, entry);
+      if (++shard->count > cache->max_entries)
+	evicted = _hb_shape_cache_evict (cache, shard);
+    }
+    shard->lock.unlock ();
+
+    if (evicted)
+      _hb_shape_cache_entry_destroy (evicted);
+  }
+
+  return res;
+}
@@ -406,3 +406,348 @@ hb_shape (hb_font_t           *font,
 {
   hb_shape_full (font, buffer, features, num_features, NULL);
 }
+
+
+/*
+ * Incremental shaping
+ */
+
+#ifndef HB_SHAPE_INCREMENTAL_MARGIN
+/* Clusters reshaped on each side of an edit before looking for a safe
+ * boundary.  Unsafe-to-break flags only record contexts that matched in the
+ * old text; this covers contexts the edit itself creates. */
+#define HB_SHAPE_INCREMENTAL_MARGIN 8
+#endif
+#ifndef HB_SHAPE_INCREMENTAL_OVERLAP
+/* Clusters past the reshaped range that are reshaped again to check that its
+ * boundaries are still safe. */
+#define HB_SHAPE_INCREMENTAL_OVERLAP 2
+#endif
+
+/* Accessors for the glyphs of a shaped buffer in logical order. */
+static inline hb_glyph_info_t &
+_logical_info (hb_buffer_t *buffer, unsigned int i)
+{
+  return HB_DIRECTION_IS_BACKWARD (buffer->props.direction) ? buffer->info[buffer->len - 1 - i] : buffer->info[i];
+}
+static inline hb_glyph_position_t &
+_logical_pos (hb_buffer_t *buffer, unsigned int i)
+{
+  return HB_DIRECTION_IS_BACKWARD (buffer->props.direction) ? buffer->pos[buffer->len - 1 - i] : buffer->pos[i];
+}
+
+static inline bool
+_is_cluster_start (hb_buffer_t *buffer, unsigned int i)
+{
+  return i == 0 || i >= buffer->len ||
+	 _logical_info (buffer, i - 1).cluster != _logical_info (buffer, i).cluster;
+}
+
+static inline unsigned int
+_prev_cluster_start (hb_buffer_t *buffer, unsigned int i)
+{
+  do i--; while (!_is_cluster_start (buffer, i));
+  return i;
+}
+static inline unsigned int
+_next_cluster_start (hb_buffer_t *buffer, unsigned int i)
+{
+  do i++; while (!_is_cluster_start (buffer, i));
+  return i;
+}
+
+/* Whether the text may be broken before the cluster starting at i.  The
+ * shaper sets glyph flags on all glyphs of a cluster. */
+static inline bool
+_is_safe_to_break (hb_buffer_t *buffer, unsigned int i)
+{
+  return i == 0 || i >= buffer->len ||
+	 !(hb_glyph_info_get_glyph_flags (&_logical_info (buffer, i)) & HB_GLYPH_FLAG_UNSAFE_TO_BREAK);
+}
+
+static inline bool
+_has_monotone_clusters (hb_buffer_t *buffer, bool logical)
+{
+  for (unsigned int i = 1; i < buffer->len; i++)
+  {
+    unsigned int a = logical ? _logical_info (buffer, i - 1).cluster : buffer->info[i - 1].cluster;
+    unsigned int b = logical ? _logical_info (buffer, i).cluster : buffer->info[i].cluster;
+    if (a > b)
+      return false;
+  }
+  return true;
+}
+
+static inline bool
+_is_same_glyph (hb_buffer_t *a, unsigned int i,
+		hb_buffer_t *b, unsigned int j,
+		unsigned int cluster_shift)
+{
+  const hb_glyph_info_t &ai = _logical_info (a, i), &bi = _logical_info (b, j);
+  const hb_glyph_position_t &ap = _logical_pos (a, i), &bp = _logical_pos (b, j);
+  return ai.codepoint == bi.codepoint &&
+	 ai.cluster == bi.cluster + cluster_shift &&
+	 hb_glyph_info_get_glyph_flags (&ai) == hb_glyph_info_get_glyph_flags (&bi) &&
+	 ap.x_advance == bp.x_advance && ap.y_advance == bp.y_advance &&
+	 ap.x_offset == bp.x_offset && ap.y_offset == bp.y_offset;
+}
+
+/* Shapes the new text matching previous glyphs [check_start, check_end).
+ * Succeeds if, in the result, the glyphs before start and from end are the
+ * ones of previous, and breaking at both ends is still safe; the reshaped
+ * glyphs are then spliced into buffer.  Returns false otherwise, without
+ * touching buffer. */
+static bool
+_hb_shape_incremental_range (hb_shape_plan_t    *shape_plan,
+			     hb_font_t          *font,
+			     hb_buffer_t        *buffer,
+			     const hb_feature_t *features,
+			     unsigned int        num_features,
+			     hb_buffer_t        *previous,
+			     unsigned int        check_start,
+			     unsigned int        start,
+			     unsigned int        end,
+			     unsigned int        check_end,
+			     unsigned int        edit_old_end,
+			     unsigned int        edit_new_end)
+{
+  unsigned int count = previous->len;
+  unsigned int shift = edit_new_end - edit_old_end;
+
+  /* Matching characters of the new text, [text_start, text_end). */
+  unsigned int cluster_start = start ? _logical_info (previous, start).cluster : 0;
+  unsigned int cluster_end = end < count ? _logical_info (previous, end).cluster + shift : (unsigned int) -1;
+  unsigned int check_cluster_start = check_start ? _logical_info (previous, check_start).cluster : 0;
+  unsigned int check_cluster_end = check_end < count ? _logical_info (previous, check_end).cluster + shift : (unsigned int) -1;
+  unsigned int text_len = buffer->len;
+  unsigned int text_start = 0;
+  while (text_start < text_len && buffer->info[text_start].cluster < check_cluster_start)
+    text_start++;
+  unsigned int text_end = text_start;
+  while (text_end < text_len && buffer->info[text_end].cluster < check_cluster_end)
+    text_end++;
+
+  hb_buffer_t *segment = hb_buffer_create ();
+  hb_buffer_set_unicode_funcs (segment, buffer->unicode);
+  segment->props = buffer->props;
+  segment->flags = buffer->flags;
+  if (text_start)
+    segment->flags &= ~HB_BUFFER_FLAG_BOT;
+  if (text_end < text_len)
+    segment->flags &= ~HB_BUFFER_FLAG_EOT;
+  segment->cluster_level = buffer->cluster_level;
+  segment->replacement = buffer->replacement;
+  for (unsigned int i = text_start; i < text_end; i++)
+    segment->add_info (buffer->info[i]);
+  segment->content_type = HB_BUFFER_CONTENT_TYPE_UNICODE;
+
+  /* Surrounding text is context, ordered outward. */
+  if (text_start)
+    for (unsigned int i = text_start; i && segment->context_len[0] < segment->CONTEXT_LENGTH; i--)
+      segment->context[0][segment->context_len[0]++] = buffer->info[i - 1].codepoint;
+  else
+  {
+    segment->context_len[0] = buffer->context_len[0];
+    memcpy (segment->context[0], buffer->context[0], sizeof (buffer->context[0]));
+  }
+  if (text_end < text_len)
+    for (unsigned int i = text_end; i < text_len && segment->context_len[1] < segment->CONTEXT_LENGTH; i++)
+      segment->context[1][segment->context_len[1]++] = buffer->info[i].codepoint;
+  else
+  {
+    segment->context_len[1] = buffer->context_len[1];
+    memcpy (segment->context[1], buffer->context[1], sizeof (buffer->context[1]));
+  }
+
+  if (unlikely (segment->in_error ||
+		!hb_shape_plan_execute (shape_plan, font, segment, features, num_features) ||
+		!_has_monotone_clusters (segment, true)))
+  {
+    hb_buffer_destroy (segment);
+    return false;
+  }
+
+  /* Reshaped glyphs of the segment, [seg_start, seg_end); the glyphs around
+   * them must not have changed, and must still be separable from them. */
+  unsigned int seg_len = segment->len;
+  unsigned int seg_start = 0;
+  while (seg_start < seg_len && _logical_info (segment, seg_start).cluster < cluster_start)
+    seg_start++;
+  unsigned int seg_end = seg_start;
+  while (seg_end < seg_len && _logical_info (segment, seg_end).cluster < cluster_end)
+    seg_end++;
+  bool same = seg_start == start - check_start &&
+	      seg_len - seg_end == check_end - end &&
+	      _is_safe_to_break (segment, seg_start) &&
+	      _is_safe_to_break (segment, seg_end);
+  for (unsigned int i = 0; same && i < seg_start; i++)
+    same = _is_same_glyph (segment, i, previous, check_start + i, 0);
+  for (unsigned int i = seg_end; same && i < seg_len; i++)
+    same = _is_same_glyph (segment, i, previous, end + (i - seg_end), shift);
+
+  if (!same || unlikely (!buffer->ensure (start + (seg_end - seg_start) + (count - end))))
+  {
+    hb_buffer_destroy (segment);
+    return false;
+  }
+
+  /* Splice: reused glyphs before, the reshaped glyphs, then reused glyphs
+   * after, with their clusters moved by the edit. */
+  buffer->len = start + (seg_end - seg_start) + (count - end);
+  buffer->clear_positions ();
+  buffer->content_type = HB_BUFFER_CONTENT_TYPE_GLYPHS;
+  unsigned int j = 0;
+  for (unsigned int i = 0; i < start; i++, j++)
+  {
+    _logical_info (buffer, j) = _logical_info (previous, i);
+    _logical_pos (buffer, j) = _logical_pos (previous, i);
+  }
+  for (unsigned int i = seg_start; i < seg_end; i++, j++)
+  {
+    _logical_info (buffer, j) = _logical_info (segment, i);
+    _logical_pos (buffer, j) = _logical_pos (segment, i);
+  }
+  for (unsigned int i = end; i < count; i++, j++)
+  {
+    _logical_info (buffer, j) = _logical_info (previous, i);
+    _logical_info (buffer, j).cluster += shift;
+    _logical_pos (buffer, j) = _logical_pos (previous, i);
+  }
+  buffer->scratch_flags |= (previous->scratch_flags | segment->scratch_flags) &
+			   HB_BUFFER_SCRATCH_FLAG_HAS_UNSAFE_TO_BREAK;
+
+  hb_buffer_destroy (segment);
+  return true;
+}
+
+/* Returns false, without touching buffer, if previous can't be reused. */
+static bool
+_hb_shape_incremental (hb_shape_plan_t    *shape_plan,
+		       hb_font_t          *font,
+		       hb_buffer_t        *buffer,
+		       const hb_feature_t *features,
+		       unsigned int        num_features,
+		       hb_buffer_t        *previous,
+		       unsigned int        edit_start,
+		       unsigned int        edit_old_end,
+		       unsigned int        edit_new_end)
+{
+  unsigned int count = previous->len;
+  if (!count ||
+      !_has_monotone_clusters (previous, true) ||
+      !_has_monotone_clusters (buffer, false))
+    return false;
+
+  /* Glyphs touched by the edit, [first, last). */
+  unsigned int first = 0;
+  while (first < count && _logical_info (previous, first).cluster < edit_start)
+    first++;
+  if (first && (first == count || _logical_info (previous, first).cluster > edit_start))
+    first = _prev_cluster_start (previous, first);
+  unsigned int last = first;
+  while (last < count && _logical_info (previous, last).cluster < edit_old_end)
+    last++;
+
+  /* Reshape [start, end): the touched clusters, a margin, and up to the next
+   * safe boundaries.  Some glyphs past those are reshaped too, to check that
+   * the boundaries are still safe in the new text; if not, retry with a
+   * wider margin, until there is nothing left to reuse. */
+  for (unsigned int margin = HB_SHAPE_INCREMENTAL_MARGIN; ; margin *= 2)
+  {
+    unsigned int start = first;
+    for (unsigned int i = 0; i < margin && start; i++)
+      start = _prev_cluster_start (previous, start);
+    while (!_is_safe_to_break (previous, start))
+      start = _prev_cluster_start (previous, start);
+    unsigned int end = last;
+    for (unsigned int i = 0; i < margin && end < count; i++)
+      end = _next_cluster_start (previous, end);
+    while (!_is_safe_to_break (previous, end))
+      end = _next_cluster_start (previous, end);
+    if (start == 0 && end == count)
+      return false; /* Nothing to reuse. */
+
+    unsigned int check_start = start;
+    for (unsigned int i = 0; i < HB_SHAPE_INCREMENTAL_OVERLAP && check_start; i++)
+      check_start = _prev_cluster_start (previous, check_start);
+    while (!_is_safe_to_break (previous, check_start))
+      check_start = _prev_cluster_start (previous, check_start);
+    unsigned int check_end = end;
+    for (unsigned int i = 0; i < HB_SHAPE_INCREMENTAL_OVERLAP && check_end < count; i++)
+      check_end = _next_cluster_start (previous, check_end);
+    while (!_is_safe_to_break (previous, check_end))
+      check_end = _next_cluster_start (previous, check_end);
+
+    if (_hb_shape_incremental_range (shape_plan, font, buffer, features, num_features,
+				     previous, check_start, start, end, check_end,
+				     edit_old_end, edit_new_end))
+      return true;
+  }
+}
+
+/**
+ * hb_shape_incremental:
+ * @font: an #hb_font_t to use for shaping
+ * @buffer: an #hb_buffer_t holding the complete, edited, text to shape
+ * @features: (array length=num_features) (allow-none): an array of user
+ *    specified #hb_feature_t or %NULL
+ * @num_features: the length of @features array
+ * @previous: an #hb_buffer_t holding the result of shaping the text before
+ *    the edit, with the same @font, @features and buffer properties
+ * @edit_start: cluster value of the start of the edited text
+ * @edit_old_end: cluster value of the end of the edited text, before the edit
+ * @edit_new_end: cluster value of the end of the edited text, after the edit
+ *
+ * Shapes @buffer like hb_shape() does, but only reshapes the text around the
+ * edit, reusing the glyphs of @previous elsewhere.  The reshaped range is
+ * extended by a few clusters, and then to boundaries that no OpenType
+ * context matched in @previous crossed.  It is widened further until
+ * shaping it with some of the surrounding text leaves that text unchanged
+ * and its boundaries still safe to break at, so that the result is the same
+ * as shaping @buffer from scratch.
+ *
+ * Cluster values are the ones assigned when adding text to the buffers, and
+ * must be increasing in both; eg. add the whole paragraph with
+ * hb_buffer_add_utf8() and an @item_offset of 0.  The edit replaced the text
+ * between @edit_start and @edit_old_end with the text between @edit_start and
+ * @edit_new_end.
+ *
+ * Falls back to shaping all of @buffer if @previous can't be reused, eg.
+ * when not shaping with the "ot" shaper or when using
+ * %HB_BUFFER_CLUSTER_LEVEL_CHARACTERS.
+ *
+ * Return value: %FALSE if all shapers failed, %TRUE otherwise
+ *
+ * Since: 1.2.4
+ **/
+hb_bool_t
+hb_shape_incremental (hb_font_t          *font,
+		      hb_buffer_t        *buffer,
+		      const hb_feature_t *features,
+		      unsigned int        num_features,
+		      hb_buffer_t        *previous,
+		      unsigned int        edit_start,
+		      unsigned int        edit_old_end,
+		      unsigned int        edit_new_end)
+{
+  hb_shape_plan_t *shape_plan = hb_shape_plan_create_cached (font->face, &buffer->props, features, num_features, NULL);
+
+  bool reuse = 0 == strcmp (hb_shape_plan_get_shaper (shape_plan), "ot") &&
+	       buffer->content_type == HB_BUFFER_CONTENT_TYPE_UNICODE &&
+	       previous->content_type == HB_BUFFER_CONTENT_TYPE_GLYPHS &&
+	       previous->have_positions &&
+	       hb_segment_properties_equal (&buffer->props, &previous->props) &&
+	       buffer->cluster_level == previous->cluster_level &&
+	       buffer->cluster_level != HB_BUFFER_CLUSTER_LEVEL_CHARACTERS &&
+	       edit_start <= edit_old_end && edit_start <= edit_new_end;
+
+  hb_bool_t res = true;
+  if (!reuse || !_hb_shape_incremental (shape_plan, font, buffer, features, num_features,
+					previous, edit_start, edit_old_end, edit_new_end))
+    res = hb_shape_plan_execute (shape_plan, font, buffer, features, num_features);
+  hb_shape_plan_destroy (shape_plan);
+
+  if (res)
+    buffer->content_type = HB_BUFFER_CONTENT_TYPE_GLYPHS;
+  return res;
+}
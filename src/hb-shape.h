@@ -72,6 +72,63 @@ hb_shape_full (hb_font_t          *font,
 HB_EXTERN const char **
 hb_shape_list_shapers (void);
 
+HB_EXTERN hb_bool_t
+hb_shape_incremental (hb_font_t          *font,
+		      hb_buffer_t        *buffer,
+		      const hb_feature_t *features,
+		      unsigned int        num_features,
+		      hb_buffer_t        *previous,
+		      unsigned int        edit_start,
+		      unsigned int        edit_old_end,
+		      unsigned int        edit_new_end);
+
+
+/*
+ * Shape cache
+ */
+
+typedef struct hb_shape_cache_t hb_shape_cache_t;
+
+HB_EXTERN hb_shape_cache_t *
+hb_shape_cache_create (unsigned int max_entries);
+
+HB_EXTERN hb_shape_cache_t *
+hb_shape_cache_get_empty (void);
+
+HB_EXTERN hb_shape_cache_t *
+hb_shape_cache_reference (hb_shape_cache_t *cache);
+
+HB_EXTERN void
+hb_shape_cache_destroy (hb_shape_cache_t *cache);
+
+HB_EXTERN hb_bool_t
+hb_shape_cache_set_user_data (hb_shape_cache_t   *cache,
+			      hb_user_data_key_t *key,
+			      void *              data,
+			      hb_destroy_func_t   destroy,
+			      hb_bool_t           replace);
+
+HB_EXTERN void *
+hb_shape_cache_get_user_data (hb_shape_cache_t   *cache,
+			      hb_user_data_key_t *key);
+
+HB_EXTERN void
+hb_shape_cache_clear (hb_shape_cache_t *cache);
+
+HB_EXTERN void
+hb_shape_cache_get_stats (hb_shape_cache_t *cache,
+			  unsigned int     *hits,
+			  unsigned int     *misses,
+			  unsigned int     *entries);
+
+HB_EXTERN hb_bool_t
+hb_shape_cache_shape (hb_shape_cache_t   *cache,
+		      hb_font_t          *font,
+		      hb_buffer_t        *buffer,
+		      const hb_feature_t *features,
+		      unsigned int        num_features,
+		      const char * const *shaper_list);
+
 
 HB_END_DECLS
 
@@ -0,0 +1,95 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#ifndef HB_UCD_PRIVATE_HH
+#define HB_UCD_PRIVATE_HH
+
+#include "hb-private.hh"
+
+
+/*
+ * Flat Unicode character database, generated by gen-ucd-table.py.
+ *
+ * One three-stage lookup gives a record with all the properties we
+ * need per character, packed into 32 bits:
+ *
+ *   bits  0.. 4: general category, as hb_unicode_general_category_t;
+ *   bits  5..12: canonical combining class;
+ *   bits 13..20: script, as index into _hb_ucd_sc_map;
+ *   bits 21..24: Arabic joining type, as hb_arabic_joining_type_t;
+ *   bits 25..29: Bidi mirroring glyph, as index into _hb_ucd_bmg_map.
+ */
+
+extern HB_INTERNAL const hb_script_t _hb_ucd_sc_map[];
+extern HB_INTERNAL const int16_t _hb_ucd_bmg_map[];
+extern HB_INTERNAL const uint32_t _hb_ucd_records[];
+extern HB_INTERNAL const uint8_t _hb_ucd_u1[];
+extern HB_INTERNAL const uint16_t _hb_ucd_u2[];
+extern HB_INTERNAL const uint16_t _hb_ucd_u3[];
+
+static inline uint32_t
+_hb_ucd_record (hb_codepoint_t u)
+{
+  if (unlikely (u > 0x10FFFFu))
+    return _hb_ucd_records[0];
+  return _hb_ucd_records[_hb_ucd_u3[(_hb_ucd_u2[(_hb_ucd_u1[u >> 8] << 5) + ((u >> 3) & 31)] << 3) + (u & 7)]];
+}
+
+static inline hb_unicode_general_category_t
+_hb_ucd_general_category (uint32_t record)
+{
+  return (hb_unicode_general_category_t) (record & 31);
+}
+
+static inline hb_unicode_combining_class_t
+_hb_ucd_combining_class (uint32_t record)
+{
+  return (hb_unicode_combining_class_t) ((record >> 5) & 255);
+}
+
+static inline hb_script_t
+_hb_ucd_script (uint32_t record)
+{
+  return _hb_ucd_sc_map[(record >> 13) & 255];
+}
+
+static inline unsigned int
+_hb_ucd_joining_type (uint32_t record)
+{
+  return (record >> 21) & 15;
+}
+
+static inline hb_codepoint_t
+_hb_ucd_mirroring (uint32_t record, hb_codepoint_t u)
+{
+  return u + _hb_ucd_bmg_map[(record >> 25) & 31];
+}
+
+
+/* The built-in Unicode functions, backed by the tables above.  Calls
+ * through them take the inline lookups instead of the callbacks. */
+extern HB_INTERNAL const hb_unicode_funcs_t _hb_ucd_unicode_funcs;
+
+
+#endif /* HB_UCD_PRIVATE_HH */
@@ -0,0 +1,1739 @@
+/* == Start of generated table == */
+/*
+ * The following tables are generated by running:
+ *
+ *   ./gen-ucd-table.py UnicodeData.txt Scripts.txt BidiMirroring.txt ArabicShaping.txt
+ *
+ * on files with these headers:
+ *
+ * UnicodeData.txt does not have a header.
+ * # Scripts-8.0.0.txt
+ * # BidiMirroring-8.0.0.txt
+ * # ArabicShaping-8.0.0.txt
+ */
+
+#include "hb-ucd-private.hh"
+
+
+const hb_script_t _hb_ucd_sc_map[132] =
+{
+  HB_SCRIPT_UNKNOWN,
+  HB_SCRIPT_AHOM,
+  HB_SCRIPT_ANATOLIAN_HIEROGLYPHS,
+  HB_SCRIPT_ARABIC,
+  HB_SCRIPT_ARMENIAN,
+  HB_SCRIPT_AVESTAN,
+  HB_SCRIPT_BALINESE,
+  HB_SCRIPT_BAMUM,
+  HB_SCRIPT_BASSA_VAH,
+  HB_SCRIPT_BATAK,
+  HB_SCRIPT_BENGALI,
+  HB_SCRIPT_BOPOMOFO,
+  HB_SCRIPT_BRAHMI,
+  HB_SCRIPT_BRAILLE,
+  HB_SCRIPT_BUGINESE,
+  HB_SCRIPT_BUHID,
+  HB_SCRIPT_CANADIAN_SYLLABICS,
+  HB_SCRIPT_CARIAN,
+  HB_SCRIPT_CAUCASIAN_ALBANIAN,
+  HB_SCRIPT_CHAKMA,
+  HB_SCRIPT_CHAM,
+  HB_SCRIPT_CHEROKEE,
+  HB_SCRIPT_COMMON,
+  HB_SCRIPT_COPTIC,
+  HB_SCRIPT_CUNEIFORM,
+  HB_SCRIPT_CYPRIOT,
+  HB_SCRIPT_CYRILLIC,
+  HB_SCRIPT_DESERET,
+  HB_SCRIPT_DEVANAGARI,
+  HB_SCRIPT_DUPLOYAN,
+  HB_SCRIPT_EGYPTIAN_HIEROGLYPHS,
+  HB_SCRIPT_ELBASAN,
+  HB_SCRIPT_ETHIOPIC,
+  HB_SCRIPT_GEORGIAN,
+  HB_SCRIPT_GLAGOLITIC,
+  HB_SCRIPT_GOTHIC,
+  HB_SCRIPT_GRANTHA,
+  HB_SCRIPT_GREEK,
+  HB_SCRIPT_GUJARATI,
+  HB_SCRIPT_GURMUKHI,
+  HB_SCRIPT_HAN,
+  HB_SCRIPT_HANGUL,
+  HB_SCRIPT_HANUNOO,
+  HB_SCRIPT_HATRAN,
+  HB_SCRIPT_HEBREW,
+  HB_SCRIPT_HIRAGANA,
+  HB_SCRIPT_IMPERIAL_ARAMAIC,
+  HB_SCRIPT_INHERITED,
+  HB_SCRIPT_INSCRIPTIONAL_PAHLAVI,
+  HB_SCRIPT_INSCRIPTIONAL_PARTHIAN,
+  HB_SCRIPT_JAVANESE,
+  HB_SCRIPT_KAITHI,
+  HB_SCRIPT_KANNADA,
+  HB_SCRIPT_KATAKANA,
+  HB_SCRIPT_KAYAH_LI,
+  HB_SCRIPT_KHAROSHTHI,
+  HB_SCRIPT_KHMER,
+  HB_SCRIPT_KHOJKI,
+  HB_SCRIPT_KHUDAWADI,
+  HB_SCRIPT_LAO,
+  HB_SCRIPT_LATIN,
+  HB_SCRIPT_LEPCHA,
+  HB_SCRIPT_LIMBU,
+  HB_SCRIPT_LINEAR_A,
+  HB_SCRIPT_LINEAR_B,
+  HB_SCRIPT_LISU,
+  HB_SCRIPT_LYCIAN,
+  HB_SCRIPT_LYDIAN,
+  HB_SCRIPT_MAHAJANI,
+  HB_SCRIPT_MALAYALAM,
+  HB_SCRIPT_MANDAIC,
+  HB_SCRIPT_MANICHAEAN,
+  HB_SCRIPT_MEETEI_MAYEK,
+  HB_SCRIPT_MENDE_KIKAKUI,
+  HB_SCRIPT_MEROITIC_CURSIVE,
+  HB_SCRIPT_MEROITIC_HIEROGLYPHS,
+  HB_SCRIPT_MIAO,
+  HB_SCRIPT_MODI,
+  HB_SCRIPT_MONGOLIAN,
+  HB_SCRIPT_MRO,
+  HB_SCRIPT_MULTANI,
+  HB_SCRIPT_MYANMAR,
+  HB_SCRIPT_NABATAEAN,
+  HB_SCRIPT_NEW_TAI_LUE,
+  HB_SCRIPT_NKO,
+  HB_SCRIPT_OGHAM,
+  HB_SCRIPT_OLD_HUNGARIAN,
+  HB_SCRIPT_OLD_ITALIC,
+  HB_SCRIPT_OLD_NORTH_ARABIAN,
+  HB_SCRIPT_OLD_PERMIC,
+  HB_SCRIPT_OLD_PERSIAN,
+  HB_SCRIPT_OLD_SOUTH_ARABIAN,
+  HB_SCRIPT_OLD_TURKIC,
+  HB_SCRIPT_OL_CHIKI,
+  HB_SCRIPT_ORIYA,
+  HB_SCRIPT_OSMANYA,
+  HB_SCRIPT_PAHAWH_HMONG,
+  HB_SCRIPT_PALMYRENE,
+  HB_SCRIPT_PAU_CIN_HAU,
+  HB_SCRIPT_PHAGS_PA,
+  HB_SCRIPT_PHOENICIAN,
+  HB_SCRIPT_PSALTER_PAHLAVI,
+  HB_SCRIPT_REJANG,
+  HB_SCRIPT_RUNIC,
+  HB_SCRIPT_SAMARITAN,
+  HB_SCRIPT_SAURASHTRA,
+  HB_SCRIPT_SHARADA,
+  HB_SCRIPT_SHAVIAN,
+  HB_SCRIPT_SIDDHAM,
+  HB_SCRIPT_SIGNWRITING,
+  HB_SCRIPT_SINHALA,
+  HB_SCRIPT_SORA_SOMPENG,
+  HB_SCRIPT_SUNDANESE,
+  HB_SCRIPT_SYLOTI_NAGRI,
+  HB_SCRIPT_SYRIAC,
+  HB_SCRIPT_TAGALOG,
+  HB_SCRIPT_TAGBANWA,
+  HB_SCRIPT_TAI_LE,
+  HB_SCRIPT_TAI_THAM,
+  HB_SCRIPT_TAI_VIET,
+  HB_SCRIPT_TAKRI,
+  HB_SCRIPT_TAMIL,
+  HB_SCRIPT_TELUGU,
+  HB_SCRIPT_THAANA,
+  HB_SCRIPT_THAI,
+  HB_SCRIPT_TIBETAN,
+  HB_SCRIPT_TIFINAGH,
+  HB_SCRIPT_TIRHUTA,
+  HB_SCRIPT_UGARITIC,
+  HB_SCRIPT_VAI,
+  HB_SCRIPT_WARANG_CITI,
+  HB_SCRIPT_YI,
+};
+
+const int16_t _hb_ucd_bmg_map[25] =
+{
+       0,     1,    -1,     2,    -2,    16,   -16,     3,
+      -3,  2016,   138,  1824,  2104,  2108,  2106,  -138,
+       8,     7,    -8,    -7, -1824, -2016, -2104, -2106,
+   -2108,
+};
+
+const uint32_t _hb_ucd_records[724] =
+{
+  0x01000002u,0x0102C000u,0x0102C01Du,0x0102C015u,0x0102C017u,0x0302C016u,
+  0x0502C012u,0x0102C019u,0x0102C011u,0x0102C00Du,0x0702C019u,0x0902C019u,
+  0x01078009u,0x0702C016u,0x0902C012u,0x0102C018u,0x0102C010u,0x01078005u,
+  0x0102C01Au,0x01078007u,0x0B02C014u,0x0102C001u,0x0102C00Fu,0x0102C005u,
+  0x0D02C013u,0x01078008u,0x01078006u,0x0102C006u,0x01016018u,0x0105FCCCu,
+  0x0105FD0Cu,0x0105FB8Cu,0x0105FB0Cu,0x0105F94Cu,0x0105E02Cu,0x0105FE0Cu,
+  0x0105E00Cu,0x0105FD2Cu,0x0105FD4Cu,0x0104A009u,0x0104A005u,0x0104A018u,
+  0x0104A006u,0x0102E009u,0x0102E005u,0x0104A019u,0x01034009u,0x01034005u,
+  0x0103401Au,0x01035CCCu,0x0103400Bu,0x01008009u,0x01008006u,0x01008015u,
+  0x01008005u,0x01008011u,0x0100801Au,0x01008017u,0x01059B8Cu,0x01059CCCu,
+  0x01059BCCu,0x01059C8Cu,0x0105814Cu,0x0105816Cu,0x0105818Cu,0x010581ACu,
+  0x010581CCu,0x010581ECu,0x0105820Cu,0x0105822Cu,0x0105824Cu,0x0105826Cu,
+  0x0105828Cu,0x010582ACu,0x010582CCu,0x01058011u,0x010582ECu,0x01058015u,
+  0x0105830Cu,0x0105832Cu,0x01058007u,0x00006001u,0x0002C001u,0x01006019u,
+  0x00006019u,0x01006015u,0x00006017u,0x0100601Au,0x01007CCCu,0x010063CCu,
+  0x010063ECu,0x0100640Cu,0x00606007u,0x00006007u,0x00406007u,0x0062C006u,
+  0x0105E36Cu,0x0105E38Cu,0x0105E3ACu,0x0105E3CCu,0x0105E3ECu,0x0105E40Cu,
+  0x0105E42Cu,0x0105E44Cu,0x01007B8Cu,0x0100600Du,0x0105E46Cu,0x01006006u,
+  0x010E4015u,0x010E4001u,0x008E4007u,0x010E448Cu,0x006E4007u,0x00AE4007u,
+  0x004E4007u,0x010E5CCCu,0x010E5B8Cu,0x010F6007u,0x010F600Cu,0x010A800Du,
+  0x006A8007u,0x010A9CCCu,0x010A9B8Cu,0x010A8006u,0x010A801Au,0x010A8015u,
+  0x006A8006u,0x010D0007u,0x010D1CCCu,0x010D0006u,0x010D0015u,0x0048C007u,
+  0x0068C007u,0x0008C007u,0x0108DB8Cu,0x0108C015u,0x0100636Cu,0x0100638Cu,
+  0x010063ACu,0x0103800Cu,0x0103800Au,0x01038007u,0x010380ECu,0x0103812Cu,
+  0x01039CCCu,0x0103800Du,0x01038015u,0x01038006u,0x01014007u,0x0101400Cu,
+  0x0101400Au,0x010140ECu,0x0101412Cu,0x0101400Du,0x01014017u,0x0101400Fu,
+  0x0101401Au,0x0104E00Cu,0x0104E00Au,0x0104E007u,0x0104E0ECu,0x0104E12Cu,
+  0x0104E00Du,0x0104C00Cu,0x0104C00Au,0x0104C007u,0x0104C0ECu,0x0104C12Cu,
+  0x0104C00Du,0x0104C015u,0x0104C017u,0x010BC00Cu,0x010BC00Au,0x010BC007u,
+  0x010BC0ECu,0x010BC12Cu,0x010BC00Du,0x010BC01Au,0x010BC00Fu,0x010F200Cu,
+  0x010F2007u,0x010F200Au,0x010F212Cu,0x010F200Du,0x010F200Fu,0x010F201Au,
+  0x010F2017u,0x010F400Cu,0x010F400Au,0x010F4007u,0x010F412Cu,0x010F4A8Cu,
+  0x010F4B6Cu,0x010F400Du,0x010F400Fu,0x010F401Au,0x0106800Cu,0x0106800Au,
+  0x01068007u,0x010680ECu,0x0106812Cu,0x0106800Du,0x0108A00Cu,0x0108A00Au,
+  0x0108A007u,0x0108A12Cu,0x0108A00Du,0x0108A00Fu,0x0108A01Au,0x010DC00Au,
+  0x010DC007u,0x010DC12Cu,0x010DC00Cu,0x010DC00Du,0x010DC015u,0x010F8007u,
+  0x010F800Cu,0x010F8CECu,0x010F812Cu,0x010F8006u,0x010F8D6Cu,0x010F8015u,
+  0x010F800Du,0x01076007u,0x0107600Cu,0x01076ECCu,0x01076006u,0x01076F4Cu,
+  0x0107600Du,0x010FA007u,0x010FA01Au,0x010FA015u,0x010FBB8Cu,0x010FA00Du,
+  0x010FA00Fu,0x010FBB0Cu,0x030FA016u,0x050FA012u,0x010FA00Au,0x010FB02Cu,
+  0x010FB04Cu,0x010FA00Cu,0x010FB08Cu,0x010FBCCCu,0x010FA12Cu,0x010A2007u,
+  0x010A200Au,0x010A200Cu,0x010A20ECu,0x010A212Cu,0x010A200Du,0x010A2015u,
+  0x010A3B8Cu,0x010A201Au,0x01042009u,0x01042007u,0x01042006u,0x01052007u,
+  0x01040007u,0x01041CCCu,0x01040015u,0x0104000Fu,0x0104001Au,0x0102A009u,
+  0x0102A005u,0x01020011u,0x01020007u,0x01020015u,0x010AA01Du,0x010AA007u,
+  0x030AA016u,0x050AA012u,0x010CE007u,0x010CE00Eu,0x010E6007u,0x010E600Cu,
+  0x010E612Cu,0x01054007u,0x0105400Cu,0x0105412Cu,0x0101E007u,0x0101E00Cu,
+  0x010E8007u,0x010E800Cu,0x01070007u,0x0107000Cu,0x0107000Au,0x0107012Cu,
+  0x01070015u,0x01070006u,0x01070017u,0x01071CCCu,0x0107000Du,0x0107000Fu,
+  0x0109C015u,0x0009C011u,0x0069C015u,0x0109C00Cu,0x0009C001u,0x0109C00Du,
+  0x0069C007u,0x0069C006u,0x0009C007u,0x0109DC8Cu,0x0107C007u,0x0107C00Cu,
+  0x0107C00Au,0x0107DBCCu,0x0107DCCCu,0x0107DB8Cu,0x0107C01Au,0x0107C015u,
+  0x0107C00Du,0x010EA007u,0x010A6007u,0x010A600Du,0x010A600Fu,0x010A601Au,
+  0x0107001Au,0x0101C007u,0x0101DCCCu,0x0101DB8Cu,0x0101C00Au,0x0101C00Cu,
+  0x0101C015u,0x010EC007u,0x010EC00Au,0x010EC00Cu,0x010EC12Cu,0x010EDCCCu,
+  0x010EDB8Cu,0x010EC00Du,0x010EC015u,0x010EC006u,0x0105E00Bu,0x0100C00Cu,
+  0x0100C00Au,0x0100C007u,0x0100C0ECu,0x0100C12Au,0x0100C00Du,0x0100C015u,
+  0x0100C01Au,0x0100DCCCu,0x0100DB8Cu,0x010E000Cu,0x010E000Au,0x010E0007u,
+  0x010E012Au,0x010E012Cu,0x010E000Du,0x01012007u,0x010120ECu,0x0101200Au,
+  0x0101200Cu,0x0101212Au,0x01012015u,0x0107A007u,0x0107A00Au,0x0107A00Cu,
+  0x0107A0ECu,0x0107A015u,0x0107A00Du,0x010BA00Du,0x010BA007u,0x010BA006u,
+  0x010BA015u,0x010E0015u,0x0102C00Au,0x0102C007u,0x01034006u,0x0105FACCu,
+  0x0104A008u,0x0005E001u,0x0065E001u,0x0102C014u,0x0102C013u,0x0102C016u,
+  0x0102C01Bu,0x0102C01Cu,0x0302C014u,0x0502C013u,0x0102C009u,0x0107800Eu,
+  0x0F02C019u,0x1102C019u,0x1302C019u,0x0302C019u,0x0502C019u,0x1502C019u,
+  0x1702C019u,0x1902C019u,0x1B02C019u,0x1D02C019u,0x1F02C019u,0x2102C019u,
+  0x2302C019u,0x2502C019u,0x2702C019u,0x0101A01Au,0x0F02C016u,0x0302C012u,
+  0x0502C016u,0x1102C012u,0x2902C019u,0x2B02C019u,0x2D02C019u,0x2F02C019u,
+  0x3102C019u,0x01044009u,0x01044005u,0x0102E01Au,0x0102FCCCu,0x0102E015u,
+  0x0102E00Fu,0x01042005u,0x010FC007u,0x010FC006u,0x010FC015u,0x010FC12Cu,
+  0x0105001Au,0x01050006u,0x0105000Eu,0x0102C012u,0x0105FB4Cu,0x0105FC8Cu,
+  0x0105FBCCu,0x01053C0Au,0x0105A007u,0x0105E10Cu,0x0105A006u,0x0106A007u,
+  0x0106A006u,0x01016007u,0x0105201Au,0x0106A01Au,0x01050007u,0x01106007u,
+  0x01106006u,0x0110601Au,0x01082007u,0x01082006u,0x01082015u,0x01102007u,
+  0x01102006u,0x01102015u,0x0110200Du,0x01034007u,0x01034015u,0x0100E007u,
+  0x0100E00Eu,0x0100FCCCu,0x0100E015u,0x010E2007u,0x010E200Cu,0x010E212Cu,
+  0x010E200Au,0x010E201Au,0x006C6007u,0x002C6007u,0x000C6007u,0x010C6015u,
+  0x010D200Au,0x010D2007u,0x010D212Cu,0x010D2015u,0x010D200Du,0x0106C00Du,
+  0x0106C007u,0x0106C00Cu,0x0106DB8Cu,0x0106C015u,0x010CC007u,0x010CC00Cu,
+  0x010CC00Au,0x010CC12Au,0x010CC015u,0x0106400Cu,0x0106400Au,0x01064007u,
+  0x010640ECu,0x0106412Au,0x01064015u,0x0106400Du,0x010A2006u,0x01028007u,
+  0x0102800Cu,0x0102800Au,0x0102800Du,0x01028015u,0x010EE007u,0x010EFCCCu,
+  0x010EFB8Cu,0x010EE006u,0x010EE015u,0x01090007u,0x0109000Au,0x0109000Cu,
+  0x01090015u,0x01090006u,0x0109012Cu,0x0109000Du,0x01000004u,0x01000003u,
+  0x0105834Cu,0x01058019u,0x01006007u,0x01006018u,0x01006017u,0x01080007u,
+  0x0104A00Eu,0x0104A00Fu,0x0104A01Au,0x01084007u,0x01022007u,0x010AE007u,
+  0x010AE00Fu,0x01046007u,0x0104600Eu,0x010B2007u,0x010B3CCCu,0x01100007u,
+  0x01100015u,0x010B4007u,0x010B4015u,0x010B400Eu,0x01036009u,0x01036005u,
+  0x010D6007u,0x010BE007u,0x010BE00Du,0x0103E007u,0x01024007u,0x01024015u,
+  0x0107E007u,0x01032007u,0x0105C007u,0x0105C015u,0x0105C00Fu,0x010C2007u,
+  0x010C201Au,0x010C200Fu,0x010A4007u,0x010A400Fu,0x01056007u,0x0105600Fu,
+  0x010C8007u,0x010C800Fu,0x010C8015u,0x01086007u,0x01086015u,0x01096007u,
+  0x01094007u,0x0109400Fu,0x0106E007u,0x0106E00Cu,0x0106FB8Cu,0x0106FCCCu,
+  0x0106E02Cu,0x0106E12Cu,0x0106E00Fu,0x0106E015u,0x010B6007u,0x010B600Fu,
+  0x010B6015u,0x010B0007u,0x010B000Fu,0x0068E007u,0x0048E007u,0x0008E007u,
+  0x0008E01Au,0x0028E007u,0x0108FCCCu,0x0108FB8Cu,0x0068E00Fu,0x0048E00Fu,
+  0x0108E015u,0x0100A007u,0x0100A015u,0x01062007u,0x0106200Fu,0x01060007u,
+  0x0106000Fu,0x006CA007u,0x004CA007u,0x010CA015u,0x004CA00Fu,0x006CA00Fu,
+  0x000CA00Fu,0x010B8007u,0x010AC009u,0x010AC005u,0x010AC00Fu,0x0100600Fu,
+  0x0101800Au,0x0101800Cu,0x01018007u,0x0101812Cu,0x01018015u,0x0101800Fu,
+  0x0101800Du,0x0106600Cu,0x0106600Au,0x01066007u,0x0106612Cu,0x010660ECu,
+  0x01066015u,0x01066001u,0x010DE007u,0x010DE00Du,0x01027CCCu,0x01026007u,
+  0x0102600Cu,0x0102600Au,0x0102612Cu,0x0102600Du,0x01026015u,0x01088007u,
+  0x010880ECu,0x01088015u,0x010D400Cu,0x010D400Au,0x010D4007u,0x010D412Au,
+  0x010D4015u,0x010D40ECu,0x010D400Du,0x010DC00Fu,0x01072007u,0x0107200Au,
+  0x0107200Cu,0x0107212Au,0x010720ECu,0x01072015u,0x010A0007u,0x010A0015u,
+  0x01074007u,0x0107400Cu,0x0107400Au,0x010740ECu,0x0107412Cu,0x0107400Du,
+  0x0104800Cu,0x0104800Au,0x01048007u,0x010480ECu,0x0104812Au,0x01049CCCu,
+  0x010FE007u,0x010FE00Au,0x010FE00Cu,0x010FE12Cu,0x010FE0ECu,0x010FE015u,
+  0x010FE00Du,0x010D8007u,0x010D800Au,0x010D800Cu,0x010D812Cu,0x010D80ECu,
+  0x010D8015u,0x0109A007u,0x0109A00Au,0x0109A00Cu,0x0109A12Cu,0x0109A015u,
+  0x0109A00Du,0x010F0007u,0x010F000Cu,0x010F000Au,0x010F012Au,0x010F00ECu,
+  0x010F000Du,0x01002007u,0x0100200Cu,0x0100200Au,0x0100212Cu,0x0100200Du,
+  0x0100200Fu,0x01002015u,0x0100201Au,0x01104009u,0x01104005u,0x0110400Du,
+  0x0110400Fu,0x01104007u,0x010C4007u,0x01030007u,0x0103000Eu,0x01030015u,
+  0x0103C007u,0x01004007u,0x0109E007u,0x0109E00Du,0x0109E015u,0x01010007u,
+  0x0101002Cu,0x01010015u,0x010C0007u,0x010C1CCCu,0x010C0015u,0x010C001Au,
+  0x010C0006u,0x010C000Du,0x010C000Fu,0x01098007u,0x0109800Au,0x0109800Cu,
+  0x01098006u,0x0103A007u,0x0103A01Au,0x0103A00Cu,0x0103A02Cu,0x0103A015u,
+  0x0102DB0Au,0x0102DC4Au,0x0104BCCCu,0x010DA01Au,0x010DA00Cu,0x010DA015u,
+  0x01092007u,0x0109200Fu,0x01093B8Cu,0x0105A01Au,
+};
+
+const uint8_t _hb_ucd_u1[4352] =
+{
+     0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+    16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+    32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+    48,  49,  50,  51,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  53,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  54,
+    55,  56,  56,  56,  57,  58,  59,  60,  61,  62,  63,  64,  17,  17,  17,  17,
+    17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+    17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+    17,  17,  17,  17,  17,  17,  17,  65,  66,  66,  66,  66,  66,  66,  66,  66,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  52,  68,  69,  70,  71,  72,  73,
+    74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  87,
+    89,  90,  91,  92,  93,  94,  95,  96,  97,  87,  98,  87,  87,  87,  87,  87,
+    99,  99,  99, 100, 101, 102,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+   103, 103, 103, 103, 104,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87, 105, 105, 106,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87, 107, 107, 108, 109,  87,  87,  87, 110,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+   111,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87, 112,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+   113, 114, 115, 116, 117, 118, 119, 120, 121, 121, 122,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87, 123,  87,  87,  87,  87,  87, 124,  87,
+   125, 126, 127, 128, 129, 130, 131, 132, 133, 134,  87,  87,  87,  87,  87,  87,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52, 135,  52,  52,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52, 136, 137,  52,  52,  52,  52,  52,  52,  52,
+    52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52,  52, 138,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  52,  52, 139,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+   140, 141,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67, 142,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+    67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67, 142,
+};
+
+const uint16_t _hb_ucd_u2[4576] =
+{
+      0,    0,    0,    0,    1,    2,    3,    4,    5,    6,    6,    7,
+      8,    9,    9,   10,    0,    0,    0,    0,   11,   12,   13,   14,
+      6,    6,   15,   16,    9,    9,   17,    9,   18,   18,   18,   18,
+     18,   18,   18,   19,   19,   20,   18,   18,   18,   18,   18,   21,
+     22,   23,   24,   25,   26,   27,   28,   29,   30,   31,   19,   32,
+     18,   18,   33,   18,   18,   18,   18,   18,   18,   18,   34,   35,
+     36,   18,    9,    9,    9,    9,    9,    9,    9,    9,   37,    9,
+      9,    9,   38,   39,   40,   41,   42,   43,   44,   45,   43,   43,
+     46,   46,   47,   48,   49,   50,   51,   52,   53,   54,   55,   56,
+     57,   46,   58,   59,   60,   61,   62,   63,   64,   65,   66,   66,
+     66,   67,   68,   69,   70,   71,   72,   73,   74,   74,   74,   74,
+     74,   74,   75,   75,   75,   75,   75,   75,   76,   76,   76,   76,
+     77,   78,   76,   76,   76,   76,   76,   76,   79,   80,   76,   76,
+     76,   76,   76,   76,   76,   76,   76,   76,   76,   76,   81,   82,
+     82,   82,   83,   84,   85,   86,   86,   86,   86,   87,   88,   89,
+     90,   91,   92,   93,   94,   95,   96,   96,   96,   97,   98,   95,
+     99,  100,  101,  102,  103,  104,  105,  106,  107,  108,  109,  110,
+    111,  112,  113,  106,  106,  114,  114,  115,  106,  106,  106,  106,
+    116,  117,  118,  119,  120,  121,  111,  122,  123,  124,  125,  126,
+    127,  128,  129,  130,  131,  132,  106,  133,  106,  134,  135,  115,
+    136,  136,  136,  136,  137,  138,  139,   95,  140,  141,  142,  142,
+    142,  143,  144,  145,  146,  146,  147,  148,  149,  150,  151,  152,
+    153,  154,  155,  156,   95,   95,   95,   95,   95,   95,   95,   95,
+    106,  157,  158,   95,   95,   95,   95,   95,  159,  160,  161,  162,
+    163,  164,  164,  164,  164,  164,  164,  165,  166,  167,  168,  164,
+    169,  170,  171,  164,  172,  173,  174,  175,  175,  176,  177,  178,
+    179,  180,  181,  182,  183,  184,  185,  186,  187,  188,  189,  190,
+    190,  191,  192,  193,  194,  195,  196,  197,  198,  199,  200,   95,
+    201,  202,  203,  204,  204,  205,  206,  207,  208,  209,  210,   95,
+    211,  212,  213,  214,  215,  216,  217,  218,  218,  219,  220,  221,
+    222,  223,  224,  225,  226,  227,  228,   95,  229,  230,  231,  232,
+    233,  230,  234,  235,  236,  237,  238,   95,  239,  240,  241,  242,
+    243,  244,  245,  246,  246,  245,  246,  247,  248,  249,  250,  251,
+    252,  253,   95,  254,  255,  256,  257,  258,  258,  257,  259,  260,
+    261,  262,  263,  264,  265,  266,  267,   95,  268,  269,  270,  271,
+    271,  271,  271,  272,  273,  274,  275,  276,  277,  278,  279,  280,
+    281,  282,  283,  284,  282,  282,  285,  286,  283,  287,  288,  289,
+    290,  291,  292,   95,  293,  294,  294,  294,  294,  294,  295,  296,
+    297,  298,  299,  300,   95,   95,   95,   95,  301,  302,  303,  304,
+    305,  306,  307,  308,  309,  310,  311,  312,   95,   95,   95,   95,
+    313,  314,  315,  316,  317,  318,  319,  320,  321,  322,  321,  321,
+    321,  323,  324,  325,  326,  327,  328,  329,  328,  328,  328,  330,
+    331,  332,  333,  334,   95,   95,   95,   95,  335,  335,  335,  335,
+    335,  336,  337,  338,  339,  340,  341,  342,  343,  344,  345,  335,
+    346,  347,  339,  348,  349,  349,  349,  349,  350,  351,  352,  352,
+    352,  352,  352,  353,  354,  354,  354,  354,  354,  354,  354,  354,
+    354,  354,  354,  354,  354,  354,  354,  354,  354,  354,  354,  354,
+    354,  354,  354,  354,  354,  354,  354,  354,  354,  354,  354,  354,
+    355,  355,  355,  355,  355,  355,  355,  355,  355,  356,  357,  356,
+    355,  355,  355,  355,  355,  356,  355,  355,  355,  355,  356,  357,
+    356,  355,  357,  355,  355,  355,  355,  355,  355,  355,  356,  355,
+    355,  355,  355,  355,  355,  355,  355,  358,  359,  360,  361,  362,
+    355,  355,  363,  364,  365,  365,  365,  365,  365,  365,  365,  365,
+    365,  365,  366,  367,  368,  369,  369,  369,  369,  369,  369,  369,
+    369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,
+    369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,
+    369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,
+    369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,
+    369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,  369,
+    369,  369,  369,  369,  369,  369,  369,  369,  369,  370,  369,  369,
+    371,  372,  372,  373,  374,  374,  374,  374,  374,  374,  374,  374,
+    374,  375,  376,  377,  378,  379,  380,   95,  381,  381,  382,   95,
+    383,  383,  384,   95,  385,  386,  387,   95,  388,  388,  388,  388,
+    388,  388,  389,  390,  391,  392,  393,  394,  395,  396,  397,  398,
+    399,  400,  401,  402,  403,  403,  403,  403,  404,  403,  403,  403,
+    403,  403,  403,   95,  405,  403,  403,  403,  403,  406,  369,  369,
+    369,  369,  369,  369,  369,  369,  407,   95,  408,  408,  408,  409,
+    410,  411,  412,  413,  414,  415,  416,  416,  416,  417,  418,   95,
+    419,  419,  419,  419,  419,  420,  419,  419,  419,  421,  422,  423,
+    424,  424,  424,  424,  425,  425,  426,  427,  428,  428,  428,  428,
+    428,  428,  429,  430,  431,  432,  433,  434,  435,  436,  435,  436,
+    437,  438,  439,  440,   95,   95,   95,   95,   95,   95,   95,   95,
+    441,  442,  442,  442,  442,  442,  443,  444,  445,  446,  447,  448,
+    449,  450,  451,  452,  453,  454,  454,  454,  455,  456,  457,  458,
+    459,  459,  459,  459,  460,  461,  462,  463,  464,  464,  464,  464,
+    465,  466,  467,  468,  469,  470,  471,  472,  473,  473,  473,  474,
+     95,   95,   95,   95,   95,   95,   95,   95,  475,   95,  476,  477,
+    478,  479,  480,  481,    9,    9,    9,    9,  482,  483,   38,   38,
+     38,   38,   38,  484,  485,  486,    9,  487,    9,    9,    9,  488,
+     38,   38,   38,  489,  490,  491,  492,   46,   46,   46,  493,  494,
+     18,   18,   18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+     18,   18,   18,   18,   18,   18,  495,  496,   18,   18,   18,   18,
+     18,   18,   18,   18,   18,   18,   18,   18,   66,   63,  497,  498,
+     66,   63,   66,   63,  497,  498,   66,  499,   66,   63,   66,  497,
+     66,  500,   66,  500,   66,  500,  501,  502,  503,  504,  505,  506,
+     66,  507,  508,  509,  510,  511,  512,  513,  514,  515,  514,  516,
+    517,  514,  518,  519,  520,  521,  522,  523,  524,  525,   38,  526,
+    527,  527,  527,  528,   95,   95,  529,  530,  531,  532,  533,   95,
+    534,  535,  536,  537,  538,  539,  540,  541,  542,  543,  524,  524,
+    544,  544,  544,  544,  545,  546,  547,  548,  549,  550,  551,  551,
+    551,  552,  553,  551,  551,  551,  554,  555,  555,  556,  557,  555,
+    555,  555,  555,  558,  559,  555,  560,  555,  561,  562,  563,  563,
+    563,  564,  565,  566,  567,  568,  563,  555,  555,  569,  570,  563,
+    563,  571,  572,  573,  551,  574,  551,  551,  575,  576,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  577,  551,  551,  551,  578,
+    555,  555,  579,  551,  551,  551,  551,  554,  575,  551,  551,  580,
+    551,  551,  551,  551,  581,   95,   95,   95,  551,  580,   95,   95,
+    524,  524,  524,  524,  524,  524,  524,  582,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  583,  524,  524,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  584,  551,  585,  551,  551,  551,
+    551,  551,  551,  555,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  584,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  586,  587,  524,  524,  524,  582,  551,  551,  551,  551,  551,
+    588,  589,  590,  590,  591,  586,  555,  555,  592,  592,  592,  592,
+    592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,
+    592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,
+    592,  592,  592,  592,  555,  555,  555,  555,  555,  555,  555,  555,
+    555,  555,  555,  555,  555,  555,  555,  555,  593,  594,  595,  596,
+    555,  555,  555,  597,  598,  599,  600,  601,  555,  555,  602,  603,
+    555,  555,  555,  555,  555,  604,  558,  558,  555,  555,  555,  555,
+    558,  555,  555,  605,  606,  607,  608,  606,  609,  610,  611,  612,
+    613,  614,  613,  615,  616,  558,  599,  565,  551,  551,  551,  551,
+    551,  551,  555,  555,  617,  547,  551,  551,  551,  551,  618,  551,
+    551,  551,  619,  551,  551,  551,  551,  620,  551,  621,  622,   95,
+     95,  623,   95,   95,  624,  624,  624,  624,  624,  625,  626,  626,
+    626,  626,  626,  627,  628,  629,  630,  631,   71,   71,   71,   71,
+     71,   71,   71,   71,   71,   71,   71,   71,  632,  633,  634,  635,
+    636,  636,  636,  636,  637,  638,  639,  639,  639,  639,  639,  639,
+    639,  640,  641,  642,  355,  355,  357,   95,  357,  357,  357,  357,
+    357,  357,  357,  357,  643,  643,  643,  643,  644,  645,  646,  647,
+    648,  649,  514,  650,  651,   95,   95,   95,   95,   95,   95,   95,
+    652,  652,  652,  653,  652,  652,  652,  652,  652,  652,  652,  652,
+    652,  652,  654,   95,  652,  652,  652,  652,  652,  652,  652,  652,
+    652,  652,  652,  652,  652,  652,  652,  652,  652,  652,  652,  652,
+    652,  652,  652,  652,  652,  652,  655,   95,   95,   95,  551,  656,
+    657,  586,  658,  659,  660,  661,  662,  663,  664,  665,  665,  665,
+    665,  665,  665,  665,  665,  665,  666,  667,  668,  669,  669,  669,
+    669,  669,  669,  669,  669,  669,  669,  670,  671,  672,  672,  672,
+    672,  673,  674,  354,  354,  354,  354,  354,  354,  354,  354,  354,
+    354,  675,  676,  551,  672,  672,  672,  677,  551,  551,  551,  551,
+    656,   95,  669,  669,  678,  678,  678,  679,  524,  680,  551,  551,
+    551,  524,  681,  524,  678,  678,  678,  682,  524,  680,  551,  551,
+    551,  551,  681,  524,  551,  551,  683,  683,  683,  683,  683,  684,
+    683,  683,  683,  683,  683,  683,  683,  683,  683,  683,  683,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  686,   95,  551,  551,  551,  551,  551,  551,  551,  551,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  686,   95,   95,   95,   95,   95,  687,  687,  688,  687,
+    687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,
+    687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,
+    687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,
+    687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,
+    687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,
+    687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,  687,
+    687,  687,  687,  687,  687,  689,  690,  690,  690,  690,  690,  690,
+    691,   95,  692,  692,  692,  692,  692,  693,  694,  694,  694,  694,
+    694,  694,  694,  694,  694,  694,  694,  694,  694,  694,  694,  694,
+    694,  694,  694,  694,  694,  694,  694,  694,  694,  694,  694,  694,
+    694,  694,  694,  694,  694,  695,  694,  694,  696,  697,   95,   95,
+     76,   76,   76,   76,   76,  698,  699,  700,   76,   76,   76,  701,
+    702,  702,  702,  702,  702,  702,  702,  702,  703,  704,  705,   95,
+     43,   43,  706,   41,  707,   18,   20,   18,   18,   18,   18,   18,
+     18,   18,  708,  709,   18,  710,  711,   18,   18,  712,  713,   95,
+     95,   95,   95,   95,   95,   95,  714,  715,  716,  717,  718,  718,
+    719,  720,  721,  722,  723,  723,  723,  723,  723,  723,  724,   95,
+    725,  726,  726,  726,  726,  726,  727,  728,  729,  730,  731,  732,
+    733,  733,  734,  735,  736,  737,  738,  738,  739,  740,  741,  741,
+    742,  743,  744,  745,  354,  354,  354,  746,  747,  748,  748,  748,
+    748,  748,  749,  750,  751,  752,  753,  754,  755,  335,  339,  756,
+    757,  757,  757,  757,  757,  758,  759,   95,  760,  761,  762,  763,
+    335,  335,  764,  765,  766,  766,  766,  766,  766,  766,  767,  768,
+    769,   95,   95,  770,  771,  772,  773,   95,  774,  774,  774,   95,
+    357,  357,    9,    9,    9,    9,    9,  775,  776,   95,  777,  777,
+    777,  777,  777,  777,  777,  777,  777,  777,  771,  771,  771,  771,
+    778,  779,  780,  781,  354,  354,  354,  354,  354,  354,  354,  354,
+    354,  354,  354,  354,  354,  354,  354,  354,  354,  354,  354,  354,
+    782,   95,  354,  354,  675,  783,  354,  354,  354,  354,  354,  782,
+    784,  784,  784,  784,  784,  784,  784,  784,  784,  784,  784,  784,
+    784,  784,  784,  784,  784,  784,  784,  784,  784,  784,  784,  784,
+    784,  784,  784,  784,  784,  784,  784,  784,  785,  785,  785,  785,
+    785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
+    785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
+    785,  785,  785,  785,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  686,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  786,   95,   95,   95,   95,
+    787,   95,  788,  789,   96,  790,  791,  792,  793,   96,  794,  794,
+    794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  795,  796,
+    797,   95,  798,  794,  794,  794,  794,  794,  794,  794,  794,  794,
+    794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  794,
+    794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  794,
+    794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  794,  799,
+     95,   95,  794,  794,  794,  794,  794,  794,  794,  794,  800,  794,
+    794,  794,  794,  794,  794,   95,   95,   95,   95,   95,  794,  801,
+    802,  802,  803,  804,  805,  806,  807,  808,  809,  810,  811,  812,
+    813,  814,  815,  794,  794,  794,  794,  794,  794,  794,  794,  794,
+    794,  794,  794,  794,  794,  794,  794,  816,  817,    2,    3,    4,
+      5,    6,    6,    7,    8,    9,    9,  818,  819,  669,  820,  669,
+    669,  669,  669,  821,  354,  354,  354,  675,  822,  822,  822,  823,
+    824,  825,   95,  826,  827,  828,  827,  827,  829,  827,  827,  830,
+    827,  831,  827,  831,   95,   95,   95,   95,  827,  827,  827,  827,
+    827,  827,  827,  827,  827,  827,  827,  827,  827,  827,  827,  832,
+    833,  524,  524,  524,  524,  524,  834,  551,  835,  835,  835,  835,
+    835,  835,  836,  837,  838,  839,  551,  656,  840,   95,   95,   95,
+     95,   95,  551,  551,  551,  551,  551,  841,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+    842,  842,  842,  843,  844,  844,  844,  844,  844,  844,  845,   95,
+    846,  524,  524,  847,  848,  848,  848,  848,  849,   95,  850,  850,
+    851,  852,  853,  853,  853,  853,  854,  855,  856,  856,  856,  857,
+    858,  858,  858,  858,  859,  858,  860,   95,   95,   95,   95,   95,
+    861,  861,  861,  861,  861,  862,  862,  862,  862,  862,  863,  863,
+    863,  863,  863,  863,  864,  864,  864,  865,  866,  867,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,  868,  868,  868,  868,
+    868,   95,  869,  869,  869,  869,  869,  869,  870,  871,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  872,  872,  872,  872,  872,  872,  872,  872,
+    872,  872,  872,  872,  872,  872,  872,  872,  872,  872,  872,  872,
+    872,  872,  872,  872,  872,  872,  872,  872,  872,  872,  872,  872,
+    872,  872,  872,  872,  872,  872,  873,   95,  872,  872,  874,   95,
+    872,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,  875,  876,  877,  877,
+    877,  877,  878,  879,  880,  880,  881,  882,  883,  883,  884,  885,
+    886,  886,  886,  887,  888,  889,   95,   95,   95,   95,   95,   95,
+    890,  890,  891,  892,  893,  893,  894,  895,  896,  896,  896,  897,
+     95,   95,   95,   95,   95,   95,   95,   95,  898,  898,  898,  898,
+    899,  899,  899,  900,  901,  901,  902,  901,  901,  901,  901,  901,
+    903,  904,  905,  906,  907,  907,  908,  909,  910,   95,  911,  912,
+    913,  913,  913,  914,  915,  915,  915,  916,   95,   95,   95,   95,
+    917,  918,  919,  920,  921,  922,  923,   95,  924,  924,  924,  924,
+    924,  924,  925,  926,  927,  927,  928,  929,  930,  930,  931,  932,
+    933,  934,  935,  936,   95,  937,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  938,  938,  938,  938,  938,  938,  938,  938,
+    938,  939,   95,   95,   95,   95,   95,   95,  940,  940,  940,  940,
+    940,  940,  941,   95,  942,  942,  942,  942,  942,  942,  943,  944,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,  945,  945,  945,  946,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  947,  948,  948,  948,  948,  948,  948,  949,
+    950,  951,  952,  953,  954,  955,   95,  956,  957,  958,  958,  958,
+    958,  958,  959,  960,  961,   95,  962,  962,  962,  963,  964,  965,
+    966,  967,  967,  967,  968,  969,  970,  971,  972,   95,  973,  973,
+    973,  973,  974,   95,  975,  976,  976,  976,  976,  976,  977,  978,
+    979,  980,  981,  982,  983,  984,  985,   95,  986,  986,  987,  986,
+    986,  988,  989,  990,   95,   95,   95,   95,   95,   95,   95,   95,
+    991,  992,  993,  994,  993,  995,  996,  996,  996,  996,  996,  997,
+    998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1005, 1006, 1007, 1008,
+   1009, 1010, 1011, 1012, 1013, 1014, 1014,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95, 1015, 1015, 1015, 1015, 1015, 1015, 1016, 1017,
+   1018,   95, 1019, 1020,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   1021, 1021, 1021, 1021, 1021, 1022, 1023, 1024, 1025, 1026, 1026, 1027,
+     95,   95,   95,   95, 1028, 1028, 1028, 1028, 1028, 1028, 1029, 1030,
+   1031,   95, 1032, 1033,   95,   95,   95,   95, 1034, 1034, 1034, 1034,
+   1034, 1035, 1036,   95, 1037, 1038,   95,   95,   95,   95,   95,   95,
+   1039, 1039, 1039, 1040, 1041, 1042, 1043, 1044,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95, 1045, 1045, 1045, 1045, 1046, 1046, 1046, 1046,
+   1047, 1048, 1049, 1050,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1052,
+   1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+   1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+   1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+   1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+   1053, 1053, 1053, 1054,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+   1055, 1055, 1055, 1055, 1055, 1056, 1057,   95, 1053, 1053, 1053, 1053,
+   1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+   1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1058,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95, 1059, 1059, 1059, 1059,
+   1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+   1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+   1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1060,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061,
+   1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061,
+   1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061,
+   1061, 1061, 1061, 1061, 1062,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  702,  702,  702,  702,  702,  702,  702,  702,
+    702,  702,  702,  702,  702,  702,  702,  702,  702,  702,  702,  702,
+    702,  702,  702,  702,  702,  702,  702,  702,  702,  702,  702,  702,
+    702,  702,  702,  702,  702,  702,  702, 1063, 1064, 1064, 1064, 1065,
+   1066, 1067,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95, 1068, 1068, 1068, 1069, 1070,   95, 1071, 1071, 1071, 1071,
+   1071, 1071, 1072, 1073, 1074,   95, 1075, 1076, 1077, 1071, 1071, 1078,
+   1071, 1071,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+   1080,   95, 1081, 1082, 1082, 1082, 1082, 1083,   95, 1084, 1085, 1086,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   1087,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95, 1088, 1088, 1088, 1088,
+   1088, 1088, 1088, 1088, 1088, 1088, 1088, 1088, 1088, 1089, 1088, 1090,
+   1088, 1091, 1088, 1092, 1093,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  619,   95,
+    551,  551,  551,  551,  581, 1094,  551,  551,  551,  551,  551,  551,
+   1095, 1096, 1097, 1098, 1099, 1100,  551,  551,  551, 1101,  551,  551,
+    551,  551,  551,  551,  551, 1102,   95,   95,  838,  838,  838,  838,
+    838,  838,  838,  838, 1103,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  581,   95,  524,  524, 1104,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   1105, 1105, 1105, 1106, 1107, 1107, 1108, 1105, 1105, 1109, 1110, 1107,
+   1107, 1105, 1105, 1105, 1106, 1107, 1107, 1111, 1112, 1113, 1109, 1114,
+   1115, 1107, 1105, 1105, 1105, 1106, 1107, 1107, 1116, 1117, 1118, 1119,
+   1107, 1107, 1107, 1120, 1121, 1122, 1123, 1107, 1107, 1108, 1105, 1105,
+   1109, 1107, 1107, 1107, 1105, 1105, 1105, 1106, 1107, 1107, 1108, 1105,
+   1105, 1109, 1107, 1107, 1107, 1105, 1105, 1105, 1106, 1107, 1107, 1108,
+   1105, 1105, 1109, 1107, 1107, 1107, 1105, 1105, 1105, 1106, 1107, 1107,
+   1124, 1105, 1105, 1105, 1125, 1107, 1107, 1126, 1127, 1105, 1105, 1128,
+   1107, 1107, 1129, 1108, 1105, 1105, 1130, 1107, 1107, 1131, 1132, 1105,
+   1105, 1133, 1107, 1107, 1107, 1134, 1105, 1105, 1105, 1125, 1107, 1107,
+   1126, 1135,    3,    3,    3,    3,    3,    3, 1136, 1136, 1136, 1136,
+   1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
+   1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136, 1136,
+   1136, 1136, 1136, 1136, 1137, 1137, 1137, 1137, 1137, 1137, 1138, 1139,
+   1137, 1137, 1137, 1137, 1137, 1140, 1141, 1136, 1142, 1143,   95, 1144,
+   1145, 1137,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+   1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+   1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146,
+   1147, 1148, 1149,   95,   95,   95,   95,   95, 1150,  794,  794,  794,
+   1151, 1152, 1153, 1154, 1155, 1156, 1151, 1157, 1151, 1153, 1153, 1158,
+    794, 1159,  794, 1160, 1161, 1159,  794, 1160,   95,   95,   95,   95,
+     95,   95, 1162,   95,  551,  551,  551,  551,  551,  656,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  656,   95,
+    551,  581, 1094,  551, 1094,  551, 1094,  551,  551,  551,  619,   95,
+    524, 1163,  551,  551,  551,  581,  551,  551,  551,  551,  551,  551,
+    551,  656,  551,  551,  551,  551,  551,  580,   95,   95,   95,   95,
+     95,   95,   95,   95, 1164,  551,  551,  551, 1165,   95,  551,  551,
+    551,  551,  551,  580,  551, 1102,  622,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551, 1166,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551, 1167,
+    551,  551,  551,  551, 1168,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  551,  551,  551,  551, 1102,   95,  551, 1169,  656,   95,
+    551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551,  656,   95,  551,  551,  551,  551,  551,  551,  551,  551,
+    551,  551, 1169,   95,   95,   95,   95,   95,  551,  656,  551,  551,
+    551,  551,  551,  551,  551,   95,  551,  622,  551,  551,  551,  551,
+    551,   95,  551,  551,  551,  619,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,  551, 1102,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95, 1169,   95,   95,   95,
+     95,   95,   95,   95, 1102,   95,   95,   95,   95,   95,   95,   95,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685, 1170,   95,   95,   95,   95,   95,  685,  685,  685,  685,
+    685,  685, 1171,   95,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  686,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,  685,
+    685,  685,  685,  685,  685,  685,  685,  685,  786,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,  685,  685,  685,  686,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+     95,   95,   95,   95, 1172,   95,   95,   95, 1173, 1173, 1173, 1173,
+   1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173,   95,   95,   95,   95,
+     95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+    802,  802,  802,  802,  802,  802,  802,  802,  802,  802,  802,  802,
+    802,  802,  802,  802,  802,  802,  802,  802,  802,  802,  802,  802,
+    802,  802,  802,  802,  802,  802,   95,   95,  785,  785,  785,  785,
+    785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
+    785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,  785,
+    785,  785,  785, 1174,
+};
+
+const uint16_t _hb_ucd_u3[9400] =
+{
+     1,   1,   1,   1,   1,   1,   1,   1,   2,   3,   3,   3,
+     4,   3,   3,   3,   5,   6,   3,   7,   3,   8,   3,   3,
+     9,   9,   9,   9,   9,   9,   9,   9,   9,   9,   3,   3,
+    10,   7,  11,   3,   3,  12,  12,  12,  12,  12,  12,  12,
+    12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  12,  13,
+     3,  14,  15,  16,  15,  17,  17,  17,  17,  17,  17,  17,
+    17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  13,
+     7,  14,   7,   1,   2,   3,   4,   4,   4,   4,  18,   3,
+    15,  18,  19,  20,   7,  21,  18,  15,  18,   7,  22,  22,
+    15,  23,   3,   3,  15,  22,  19,  24,  22,  22,  22,   3,
+    12,  12,  12,  12,  12,  12,  12,   7,  12,  12,  12,  12,
+    12,  12,  12,  17,  17,  17,  17,  17,  17,  17,  17,   7,
+    12,  17,  12,  17,  12,  17,  12,  17,  17,  12,  17,  12,
+    17,  12,  17,  12,  17,  17,  12,  17,  12,  17,  12,  17,
+    12,  12,  17,  12,  17,  12,  17,  17,  17,  12,  12,  17,
+    12,  17,  12,  12,  17,  12,  12,  12,  17,  17,  12,  12,
+    12,  12,  17,  12,  12,  17,  12,  12,  12,  17,  17,  17,
+    12,  12,  17,  12,  12,  17,  12,  17,  12,  17,  12,  12,
+    17,  12,  17,  17,  12,  17,  12,  12,  17,  12,  12,  12,
+    17,  12,  17,  12,  12,  17,  17,  19,  12,  17,  17,  17,
+    19,  19,  19,  19,  12,  25,  17,  12,  25,  17,  12,  25,
+    17,  12,  17,  12,  17,  12,  17,  12,  17,  17,  12,  17,
+    17,  12,  25,  17,  12,  17,  12,  12,  12,  17,  12,  17,
+    17,  17,  17,  17,  17,  17,  12,  12,  17,  12,  12,  17,
+    17,  12,  17,  12,  12,  12,  12,  17,  17,  17,  17,  17,
+    19,  17,  17,  17,  26,  26,  26,  26,  26,  26,  26,  26,
+    26,  27,  27,  27,  27,  27,  27,  27,  27,  27,  15,  15,
+    15,  15,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+    27,  27,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,
+    15,  15,  15,  15,  26,  26,  26,  26,  26,  15,  15,  15,
+    15,  15,  28,  28,  27,  15,  27,  15,  29,  29,  29,  29,
+    29,  29,  29,  29,  29,  29,  29,  29,  29,  30,  31,  31,
+    31,  31,  30,  32,  31,  31,  31,  31,  31,  33,  33,  31,
+    31,  31,  31,  33,  33,  31,  31,  31,  31,  31,  31,  31,
+    31,  31,  31,  31,  34,  34,  34,  34,  34,  31,  31,  31,
+    31,  29,  29,  29,  29,  29,  29,  29,  29,  35,  29,  31,
+    31,  31,  29,  29,  29,  31,  31,  36,  29,  29,  29,  31,
+    31,  31,  31,  29,  30,  31,  31,  29,  37,  38,  38,  37,
+    38,  38,  37,  29,  29,  29,  29,  29,  39,  40,  39,  40,
+    27,  41,  39,  40,   0,   0,  42,  40,  40,  40,   3,  39,
+     0,   0,   0,   0,  41,  15,  39,   3,  39,  39,  39,   0,
+    39,   0,  39,  39,  40,  39,  39,  39,  39,  39,  39,  39,
+    39,  39,  39,  39,  39,  39,  39,  39,  39,  39,   0,  39,
+    39,  39,  39,  39,  39,  39,  39,  39,  40,  40,  40,  40,
+    40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,  40,
+    40,  40,  40,  39,  40,  40,  39,  39,  39,  40,  40,  40,
+    39,  40,  39,  40,  39,  40,  39,  40,  39,  40,  43,  44,
+    43,  44,  43,  44,  43,  44,  43,  44,  43,  44,  43,  44,
+    40,  40,  40,  40,  39,  40,  45,  39,  40,  39,  39,  40,
+    40,  39,  39,  39,  46,  46,  46,  46,  46,  46,  46,  46,
+    47,  47,  47,  47,  47,  47,  47,  47,  46,  47,  46,  47,
+    46,  47,  46,  47,  46,  47,  48,  49,  49,  29,  29,  49,
+    50,  50,  46,  47,  46,  47,  46,  47,  46,  46,  47,  46,
+    47,  46,  47,  46,  47,  46,  47,  46,  47,  46,  47,  47,
+     0,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+    51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,   0,
+     0,  52,  53,  53,  53,  53,  53,  53,   0,  54,  54,  54,
+    54,  54,  54,  54,  54,  54,  54,  54,  54,  54,  54,  54,
+     0,   3,  55,   0,   0,  56,  56,  57,   0,  58,  59,  59,
+    59,  59,  58,  59,  59,  59,  60,  58,  59,  59,  59,  59,
+    59,  59,  58,  58,  58,  58,  58,  58,  59,  59,  58,  59,
+    59,  60,  61,  59,  62,  63,  64,  65,  66,  67,  68,  69,
+    70,  71,  71,  72,  73,  74,  75,  76,  77,  78,  79,  77,
+    59,  58,  77,  70,   0,   0,   0,   0,   0,   0,   0,   0,
+    80,  80,  80,  80,  80,  80,  80,  80,  80,  80,  80,   0,
+     0,   0,   0,   0,  80,  80,  80,  77,  77,   0,   0,   0,
+    81,  81,  81,  81,  81,  82,  83,  83,  84,  85,  85,  86,
+     3,  85,  87,  87,  88,  88,  88,  88,  88,  88,  88,  88,
+    89,  90,  91,   3,  21,   0,  85,   3,  92,  93,  94,  94,
+    94,  94,  92,  94,  92,  94,  92,  92,  92,  92,  92,  94,
+    94,  94,  94,  92,  92,  92,  92,  92,  92,  92,  92,  92,
+    92,  92,  92,  92,  95,  92,  92,  92,  92,  92,  92,  92,
+    94,  92,  92,  96,  97,  98,  99, 100, 101, 102, 103,  29,
+    29,  31, 104,  88,  88,  88,  88,  88, 104,  88,  88, 104,
+   105, 105, 105, 105, 105, 105, 105, 105, 105, 105,  85,  85,
+    85,  85,  92,  92, 106,  94,  94,  94,  93,  94,  94,  94,
+    94,  94,  94,  94,  94,  94,  94,  94,  94,  94,  92,  92,
+    92,  92,  92,  92,  94,  92,  92,  94,  94,  94,  94,  94,
+    94,  94,  94,  94,  92,  94,  92,  94,  92,  92,  94,  94,
+    85,  94,  88,  88,  88,  88,  88,  88,  88,  82,  87,  88,
+    88,  88,  88, 104,  88, 107, 107,  88,  88,  87, 104,  88,
+    88, 104,  94,  94, 105, 105,  92,  92,  92,  87,  87,  92,
+   108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+   108, 108,   0, 109, 110, 111, 112, 112, 112, 113, 113, 114,
+   114, 114, 112, 112, 112, 112, 114, 112, 112, 112, 112, 112,
+   112, 112, 112, 112, 114, 112, 113, 112, 114, 112, 112, 113,
+   115, 116, 115, 115, 116, 115, 115, 116, 116, 116, 115, 116,
+   116, 115, 116, 115, 115, 115, 116, 115, 116, 115, 116, 115,
+   116, 115, 115,   0,   0, 114, 112, 112,  92,  94,  94,  94,
+    92,  92,  92,  92,  92,  92,  92,  94,  94,  92,  92,  92,
+    92,  94,  92,  94,  94,  92,  92,  92, 117, 117, 117, 117,
+   117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 118, 118,
+   118, 118, 118, 118, 118, 118, 118, 118, 118, 117,   0,   0,
+     0,   0,   0,   0, 119, 119, 119, 119, 119, 119, 119, 119,
+   119, 119, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+   120, 120, 120, 120, 120, 120, 120, 121, 121, 121, 121, 121,
+   121, 121, 122, 121, 123, 123, 124, 125, 125, 125, 126,   0,
+     0,   0,   0,   0, 127, 127, 127, 127, 127, 127, 127, 127,
+   127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 129, 128,
+   128, 128, 128, 128, 128, 128, 128, 128, 129, 128, 128, 128,
+   129, 128, 128, 128, 128, 128,   0,   0, 130, 130, 130, 130,
+   130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,   0,
+   131, 132, 132, 132, 132, 132, 131, 131, 132, 131, 132, 132,
+   132, 132, 132, 132, 132, 132, 132, 132, 131, 132, 133, 133,
+   133, 134, 134, 134,   0,   0, 135,   0,  92,  92,  94,  94,
+    94,  93,  94,  92,  92,  94,  94,  92,  92,   0,   0,   0,
+     0,   0,   0, 104,  88,  88, 104,  88,  88, 104,  88,  88,
+    88, 104, 104, 104, 136, 137, 138,  88,  88,  88, 104,  88,
+    88, 104, 104,  88,  88,  88,  88,  88, 139, 139, 139, 140,
+   141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+   141, 141, 139, 140, 142, 141, 140, 140, 140, 139, 139, 139,
+   139, 139, 139, 139, 139, 140, 140, 140, 140, 143, 140, 140,
+   141,  29,  31, 144, 144, 139, 139, 139, 141, 141, 139, 139,
+     3,   3, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+   146, 147, 141, 141, 141, 141, 141, 141, 148, 149, 150, 150,
+     0, 148, 148, 148, 148, 148, 148, 148, 148,   0,   0, 148,
+   148,   0,   0, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+   148, 148, 148, 148, 148,   0, 148, 148, 148, 148, 148, 148,
+   148,   0, 148,   0,   0,   0, 148, 148, 148, 148,   0,   0,
+   151, 148, 150, 150, 150, 149, 149, 149, 149,   0,   0, 150,
+   150,   0,   0, 150, 150, 152, 148,   0,   0,   0,   0,   0,
+     0,   0,   0, 150,   0,   0,   0,   0, 148, 148,   0, 148,
+   148, 148, 149, 149,   0,   0, 153, 153, 153, 153, 153, 153,
+   153, 153, 153, 153, 148, 148, 154, 154, 155, 155, 155, 155,
+   155, 155, 156, 154,   0,   0,   0,   0,   0, 157, 157, 158,
+     0, 159, 159, 159, 159, 159, 159,   0,   0,   0,   0, 159,
+   159,   0,   0, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+   159, 159, 159, 159, 159,   0, 159, 159, 159, 159, 159, 159,
+   159,   0, 159, 159,   0, 159, 159,   0, 159, 159,   0,   0,
+   160,   0, 158, 158, 158, 157, 157,   0,   0,   0,   0, 157,
+   157,   0,   0, 157, 157, 161,   0,   0,   0, 157,   0,   0,
+     0,   0,   0,   0,   0, 159, 159, 159, 159,   0, 159,   0,
+     0,   0,   0,   0,   0,   0, 162, 162, 162, 162, 162, 162,
+   162, 162, 162, 162, 157, 157, 159, 159, 159, 157,   0,   0,
+     0, 163, 163, 164,   0, 165, 165, 165, 165, 165, 165, 165,
+   165, 165,   0, 165, 165, 165,   0, 165, 165, 165, 165, 165,
+   165, 165, 165, 165, 165, 165, 165, 165, 165,   0, 165, 165,
+   165, 165, 165, 165, 165,   0, 165, 165,   0, 165, 165, 165,
+   165, 165,   0,   0, 166, 165, 164, 164, 164, 163, 163, 163,
+   163, 163,   0, 163, 163, 164,   0, 164, 164, 167,   0,   0,
+   165,   0,   0,   0,   0,   0,   0,   0, 165, 165, 163, 163,
+     0,   0, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+   169, 170,   0,   0,   0,   0,   0,   0,   0, 165,   0,   0,
+     0,   0,   0,   0,   0, 171, 172, 172,   0, 173, 173, 173,
+   173, 173, 173, 173, 173,   0,   0, 173, 173,   0,   0, 173,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+   173,   0, 173, 173, 173, 173, 173, 173, 173,   0, 173, 173,
+     0, 173, 173, 173, 173, 173,   0,   0, 174, 173, 172, 171,
+   172, 171, 171, 171, 171,   0,   0, 172, 172,   0,   0, 172,
+   172, 175,   0,   0,   0,   0,   0,   0,   0,   0, 171, 172,
+     0,   0,   0,   0, 173, 173,   0, 173, 173, 173, 171, 171,
+     0,   0, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+   177, 173, 178, 178, 178, 178, 178, 178,   0,   0, 179, 180,
+     0, 180, 180, 180, 180, 180, 180,   0,   0,   0, 180, 180,
+   180,   0, 180, 180, 180, 180,   0,   0,   0, 180, 180,   0,
+   180,   0, 180, 180,   0,   0,   0, 180, 180,   0,   0,   0,
+   180, 180, 180, 180, 180, 180, 180, 180, 180, 180,   0,   0,
+     0,   0, 181, 181, 179, 181, 181,   0,   0,   0, 181, 181,
+   181,   0, 181, 181, 181, 182,   0,   0, 180,   0,   0,   0,
+     0,   0,   0, 181,   0,   0,   0,   0,   0,   0, 183, 183,
+   183, 183, 183, 183, 183, 183, 183, 183, 184, 184, 184, 185,
+   185, 185, 185, 185, 185, 186, 185,   0,   0,   0,   0,   0,
+   187, 188, 188, 188,   0, 189, 189, 189, 189, 189, 189, 189,
+   189,   0, 189, 189, 189,   0, 189, 189, 189, 189, 189, 189,
+   189, 189, 189, 189, 189, 189, 189, 189, 189, 189,   0,   0,
+     0, 189, 187, 187, 187, 188, 188, 188, 188,   0, 187, 187,
+   187,   0, 187, 187, 187, 190,   0,   0,   0,   0,   0,   0,
+     0, 191, 192,   0, 189, 189, 189,   0,   0,   0,   0,   0,
+   189, 189, 187, 187,   0,   0, 193, 193, 193, 193, 193, 193,
+   193, 193, 193, 193, 194, 194, 194, 194, 194, 194, 194, 195,
+     0, 196, 197, 197,   0, 198, 198, 198, 198, 198, 198, 198,
+   198,   0, 198, 198, 198,   0, 198, 198, 198, 198, 198, 198,
+   198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+     0, 198, 198, 198, 198, 198,   0,   0, 199, 198, 197, 196,
+   197, 197, 197, 197, 197,   0, 196, 197, 197,   0, 197, 197,
+   196, 200,   0,   0,   0,   0,   0,   0,   0, 197, 197,   0,
+     0,   0,   0,   0,   0,   0, 198,   0, 198, 198, 196, 196,
+     0,   0, 201, 201, 201, 201, 201, 201, 201, 201, 201, 201,
+     0, 198, 198,   0,   0,   0,   0,   0,   0, 202, 203, 203,
+     0, 204, 204, 204, 204, 204, 204, 204, 204,   0, 204, 204,
+   204,   0, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+   204, 204, 204, 204, 204, 204, 204,   0,   0, 204, 203, 203,
+   203, 202, 202, 202, 202,   0, 203, 203, 203,   0, 203, 203,
+   203, 205, 204,   0,   0,   0,   0,   0,   0,   0,   0, 203,
+     0,   0,   0,   0,   0,   0,   0, 204, 204, 204, 202, 202,
+     0,   0, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+   207, 207, 207, 207, 207, 207,   0,   0,   0, 208, 204, 204,
+   204, 204, 204, 204,   0,   0, 209, 209,   0, 210, 210, 210,
+   210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+   210, 210, 210,   0,   0,   0, 210, 210, 210, 210, 210, 210,
+   210, 210,   0, 210, 210, 210, 210, 210, 210, 210, 210, 210,
+     0, 210,   0,   0,   0,   0, 211,   0,   0,   0,   0, 209,
+   209, 209, 212, 212, 212,   0, 212,   0, 209, 209, 209, 209,
+   209, 209, 209, 209,   0,   0,   0,   0,   0,   0, 213, 213,
+   213, 213, 213, 213, 213, 213, 213, 213,   0,   0, 209, 209,
+   214,   0,   0,   0,   0, 215, 215, 215, 215, 215, 215, 215,
+   215, 215, 215, 215, 215, 215, 215, 215, 215, 216, 215, 215,
+   216, 216, 216, 216, 217, 217, 218,   0,   0,   0,   0,   4,
+   215, 215, 215, 215, 215, 215, 219, 216, 220, 220, 220, 220,
+   216, 216, 216, 221, 222, 222, 222, 222, 222, 222, 222, 222,
+   222, 222, 221, 221,   0,   0,   0,   0,   0, 223, 223,   0,
+   223,   0,   0, 223, 223,   0, 223,   0,   0, 223,   0,   0,
+     0,   0,   0,   0, 223, 223, 223, 223,   0, 223, 223, 223,
+   223, 223, 223, 223,   0, 223, 223, 223,   0, 223,   0, 223,
+     0,   0, 223, 223,   0, 223, 223, 223, 223, 224, 223, 223,
+   224, 224, 224, 224, 225, 225,   0, 224, 224, 223,   0,   0,
+   223, 223, 223, 223, 223,   0, 226,   0, 227, 227, 227, 227,
+   224, 224,   0,   0, 228, 228, 228, 228, 228, 228, 228, 228,
+   228, 228,   0,   0, 223, 223, 223, 223, 229, 230, 230, 230,
+   231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+   231, 231, 231, 230, 231, 230, 230, 230, 232, 232, 230, 230,
+   230, 230, 230, 230, 233, 233, 233, 233, 233, 233, 233, 233,
+   233, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+   230, 232, 230, 232, 230, 235, 236, 237, 236, 237, 238, 238,
+   229, 229, 229, 229, 229, 229, 229, 229,   0, 229, 229, 229,
+   229, 229, 229, 229, 229, 229, 229, 229, 229,   0,   0,   0,
+     0, 239, 240, 241, 242, 241, 241, 241, 241, 241, 240, 240,
+   240, 240, 241, 238, 240, 241, 243, 243, 244, 231, 243, 243,
+   229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241,
+   241, 241, 241, 241,   0, 241, 241, 241, 241, 241, 241, 241,
+   241, 241, 241, 241, 241,   0, 230, 230, 230, 230, 230, 230,
+   230, 230, 232, 230, 230, 230, 230, 230, 230,   0, 230, 230,
+   231, 231, 231, 231, 231,  18,  18,  18,  18, 231, 231,   0,
+     0,   0,   0,   0, 245, 245, 245, 245, 245, 245, 245, 245,
+   245, 245, 245, 246, 246, 247, 247, 247, 247, 246, 247, 247,
+   247, 247, 247, 248, 246, 249, 249, 246, 246, 247, 247, 245,
+   250, 250, 250, 250, 250, 250, 250, 250, 250, 250, 251, 251,
+   251, 251, 251, 251, 245, 245, 245, 245, 245, 245, 246, 246,
+   247, 247, 245, 245, 245, 245, 247, 247, 247, 245, 246, 246,
+   246, 245, 245, 246, 246, 246, 246, 246, 246, 246, 245, 245,
+   245, 247, 247, 247, 247, 245, 245, 245, 245, 245, 247, 246,
+   246, 247, 247, 246, 246, 246, 246, 246, 246, 252, 245, 246,
+   250, 250, 246, 246, 246, 247, 253, 253, 254, 254, 254, 254,
+   254, 254, 254, 254, 254, 254, 254, 254, 254, 254,   0, 254,
+     0,   0,   0,   0,   0, 254,   0,   0, 255, 255, 255, 255,
+   255, 255, 255, 255, 255, 255, 255,   3, 256, 255, 255, 255,
+   257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258,
+   258, 258, 258, 258, 258,   0, 258, 258, 258, 258,   0,   0,
+   258, 258, 258, 258, 258, 258, 258,   0, 258, 258, 258,   0,
+     0, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+   260, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+   261, 261, 261, 261, 261, 261, 261, 261, 261,   0,   0,   0,
+   262, 262, 262, 262, 262, 262, 262, 262, 262, 262,   0,   0,
+     0,   0,   0,   0, 263, 263, 263, 263, 263, 263, 263, 263,
+   263, 263, 263, 263, 263, 263,   0,   0, 264, 264, 264, 264,
+   264, 264,   0,   0, 265, 266, 266, 266, 266, 266, 266, 266,
+   266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+   266, 267, 267, 266, 268, 269, 269, 269, 269, 269, 269, 269,
+   269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 269, 270,
+   271,   0,   0,   0, 272, 272, 272, 272, 272, 272, 272, 272,
+   272, 272, 272,   3,   3,   3, 273, 273, 273, 272, 272, 272,
+   272, 272, 272, 272, 272,   0,   0,   0,   0,   0,   0,   0,
+   274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+   274,   0, 274, 274, 274, 274, 275, 275, 276,   0,   0,   0,
+   277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 278, 278,
+   279,   3,   3,   0, 280, 280, 280, 280, 280, 280, 280, 280,
+   280, 280, 281, 281,   0,   0,   0,   0, 282, 282, 282, 282,
+   282, 282, 282, 282, 282, 282, 282, 282, 282,   0, 282, 282,
+   282,   0, 283, 283,   0,   0,   0,   0, 284, 284, 284, 284,
+   284, 284, 284, 284, 284, 284, 284, 284, 285, 285, 286, 285,
+   285, 285, 285, 285, 285, 285, 286, 286, 286, 286, 286, 286,
+   286, 286, 285, 286, 286, 285, 285, 285, 285, 285, 285, 285,
+   285, 285, 287, 285, 288, 288, 288, 289, 288, 288, 288, 290,
+   284, 291,   0,   0, 292, 292, 292, 292, 292, 292, 292, 292,
+   292, 292,   0,   0,   0,   0,   0,   0, 293, 293, 293, 293,
+   293, 293, 293, 293, 293, 293,   0,   0,   0,   0,   0,   0,
+   294, 294,   3,   3, 294,   3, 295, 296, 294, 294, 296, 297,
+   297, 297, 298,   0, 299, 299, 299, 299, 299, 299, 299, 299,
+   299, 299,   0,   0,   0,   0,   0,   0, 300, 300, 300, 300,
+   300, 300, 300, 300, 300, 300, 300, 301, 300, 300, 300, 300,
+   302, 302, 302, 302, 302, 302, 302, 300, 300, 303, 300,   0,
+     0,   0,   0,   0, 266, 266, 266, 266, 266, 266,   0,   0,
+   304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304,
+   304, 304, 304,   0, 305, 305, 305, 306, 306, 306, 306, 305,
+   305, 306, 306, 306,   0,   0,   0,   0, 306, 306, 305, 306,
+   306, 306, 306, 306, 306, 307, 308, 309,   0,   0,   0,   0,
+   310,   0,   0,   0, 311, 311, 312, 312, 312, 312, 312, 312,
+   312, 312, 312, 312, 313, 313, 313, 313, 313, 313, 313, 313,
+   313, 313, 313, 313, 313, 313,   0,   0, 313, 313, 313, 313,
+   313,   0,   0,   0, 314, 314, 314, 314, 314, 314, 314, 314,
+   314, 314, 314, 314,   0,   0,   0,   0, 314, 314,   0,   0,
+     0,   0,   0,   0, 315, 315, 315, 315, 315, 315, 315, 315,
+   315, 315, 316,   0,   0,   0, 317, 317, 318, 318, 318, 318,
+   318, 318, 318, 318, 319, 319, 319, 319, 319, 319, 319, 319,
+   319, 319, 319, 319, 319, 319, 319, 320, 321, 322, 322, 323,
+     0,   0, 324, 324, 325, 325, 325, 325, 325, 325, 325, 325,
+   325, 325, 325, 325, 325, 326, 327, 326, 327, 327, 327, 327,
+   327, 327, 327,   0, 328, 326, 327, 326, 326, 327, 327, 327,
+   327, 327, 327, 327, 327, 326, 326, 326, 326, 326, 326, 327,
+   327, 329, 329, 329, 329, 329, 329, 329, 329,   0,   0, 330,
+   331, 331, 331, 331, 331, 331, 331, 331, 331, 331,   0,   0,
+     0,   0,   0,   0, 332, 332, 332, 332, 332, 332, 332, 333,
+   332, 332, 332, 332, 332, 332,   0,   0,  29,  29,  29,  29,
+    29,  31,  31,  31,  31,  31,  31,  29,  29,  31, 334,   0,
+   335, 335, 335, 335, 336, 337, 337, 337, 337, 337, 337, 337,
+   337, 337, 337, 337, 337, 337, 337, 337, 338, 336, 335, 335,
+   335, 335, 335, 336, 335, 336, 336, 336, 336, 336, 335, 336,
+   339, 337, 337, 337, 337, 337, 337, 337,   0,   0,   0,   0,
+   340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 341, 341,
+   341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342,
+   342, 342, 342, 343, 344, 343, 343, 343, 343, 343, 343, 343,
+   342, 342, 342, 342, 342, 342, 342, 342, 342,   0,   0,   0,
+   345, 345, 346, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+   347, 347, 347, 347, 347, 346, 345, 345, 345, 345, 346, 346,
+   345, 345, 348, 349, 345, 345, 347, 347, 350, 350, 350, 350,
+   350, 350, 350, 350, 350, 350, 347, 347, 347, 347, 347, 347,
+   351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 351,
+   351, 351, 352, 353, 354, 354, 353, 353, 353, 354, 353, 354,
+   354, 354, 355, 355,   0,   0,   0,   0,   0,   0,   0,   0,
+   356, 356, 356, 356, 357, 357, 357, 357, 357, 357, 357, 357,
+   357, 357, 357, 357, 358, 358, 358, 358, 358, 358, 358, 358,
+   359, 359, 359, 359, 359, 359, 359, 359, 358, 358, 359, 360,
+     0,   0,   0, 361, 361, 361, 361, 361, 362, 362, 362, 362,
+   362, 362, 362, 362, 362, 362,   0,   0,   0, 357, 357, 357,
+   363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 364, 364,
+   364, 364, 364, 364, 364, 364, 364, 364, 364, 364, 364, 364,
+   365, 365, 365, 365, 365, 365, 366, 366, 367, 367, 367, 367,
+   367, 367, 367, 367,  29,  29,  29,   3,  34,  31,  31,  31,
+    31,  31,  29,  29,  31,  31,  31,  31,  29, 368,  34,  34,
+    34,  34,  34,  34,  34, 369, 369, 369, 369,  31, 369, 369,
+   369, 369, 368, 368,  29, 369, 369,   0,  29,  29,   0,   0,
+     0,   0,   0,   0,  17,  17,  17,  17,  17,  17,  40,  40,
+    40,  40,  40,  47,  26,  26,  26,  26,  26,  26,  26,  26,
+    26,  42,  42,  42,  42,  42,  26,  26,  26,  26,  42,  42,
+    42,  42,  42,  17,  17,  17,  17,  17, 370,  17,  17,  17,
+    17,  17,  17,  17,  17,  17,  17,  26,  26,  26,  26,  26,
+    26,  26,  26,  26,  26,  26,  26,  42,  29,  29,  31,  29,
+    29,  29,  29,  29,  29,  29,  31,  29,  29,  38, 371,  31,
+    33,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,
+    29,  29,   0,   0,   0,   0,   0,   0,  37,  31,  29,  31,
+    12,  17,  12,  17,  12,  17,  17,  17,  17,  17,  17,  17,
+    17,  17,  12,  17,  40,  40,  40,  40,  40,  40,   0,   0,
+    39,  39,  39,  39,  39,  39,   0,   0,   0,  39,   0,  39,
+     0,  39,   0,  39, 372, 372, 372, 372, 372, 372, 372, 372,
+    40,  40,  40,  40,  40,   0,  40,  40,  39,  39,  39,  39,
+   372,  41,  40,  41,  41,  41,  40,  40,  40,   0,  40,  40,
+    39,  39,  39,  39, 372,  41,  41,  41,  40,  40,  40,  40,
+     0,   0,  40,  40,  39,  39,  39,  39,   0,  41,  41,  41,
+    39,  39,  39,  39,  39,  41,  41,  41,   0,   0,  40,  40,
+    40,   0,  40,  40,  39,  39,  39,  39, 372,  41,  41,   0,
+     2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  21,
+   373, 374,  21,  21,   8,   8,   8,   8,   8,   8,   3,   3,
+   375, 376, 377, 375, 375, 376, 377, 375,   3,   3,   3,   3,
+     3,   3,   3,   3, 378, 379,  21,  21,  21,  21,  21,   2,
+     3, 380, 381,   3,   3,   3,   3,  16,  16,   3,   3,   3,
+     7,   5,   6,   3,   3,   3,   7,   3,  16,   3,   3,   3,
+     3,   3,   3,   3,   3,   3,   3,   2,  21,  21,  21,  21,
+    21,   0,  82,  82,  82,  82,  21,  21,  21,  21,  21,  21,
+    22,  26,   0,   0,  22,  22,  22,  22,  22,  22,   7,   7,
+     7,   5,   6,  26,  22,  22,  22,  22,  22,  22,  22,  22,
+    22,  22,   7,   7,   7,   5,   6,   0,  26,  26,  26,  26,
+    26,   0,   0,   0,   4,   4,   4,   4,   4,   4,   4,   4,
+     4,   4,   4,   4,   4,   4,   4,   0,  29,  29,  34,  34,
+    29,  29,  29,  29,  34,  34,  34,  29,  29, 334, 334, 334,
+   334,  29, 334, 334, 334,  34,  34,  29,  31,  29,  34,  34,
+    31,  31,  31,  31,  29,   0,   0,   0,   0,   0,   0,   0,
+    18,  18, 382,  18,  18,  18,  18, 382,  18,  18,  23, 382,
+   382, 382,  23,  23, 382, 382, 382,  23,  18, 382,  18,  18,
+     7, 382, 382, 382, 382, 382,  18,  18,  18,  18,  18,  18,
+   382,  18,  39,  18, 382,  18,  12,  12, 382, 382,  18,  23,
+   382, 382,  12, 382,  23, 369, 369, 369, 369,  23,  18,  18,
+    23,  23, 382, 382,   7,   7,   7,   7,   7, 382,  23,  23,
+    23,  23,  18,   7,  18,  18,  17,  18, 383, 383, 383, 383,
+   383, 383, 383, 383, 383, 383, 383,  12,  17, 383, 383, 383,
+   383,  22,  18,  18,   0,   0,   0,   0,   7,   7,   7,   7,
+     7,  18,  18,  18,  18,  18,   7,   7,  18,  18,  18,  18,
+     7,  18,  18,   7,  18,  18,   7,  18,  18,  18,  18,  18,
+    18,  18,   7,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+    18,  18,  18,  18,  18,  18,   7,   7,  18,  18,   7,  18,
+     7,  18,  18,  18,  18,  18,  18,  18,   7,   7,   7,   7,
+     7,   7,   7,   7,   7,   7,   7,   7, 384, 384, 384, 385,
+   385, 385,   7,   7,   7,   7,   7,   7,   7, 386,   7,   7,
+     7,   7,   7,   7, 387, 388,   7,   7,   7,   7,   7, 389,
+     7,   7,   7,   7,   7,   7, 387, 388, 387, 388,   7,   7,
+     7,   7,   7,   7, 387, 388, 387, 388, 387, 388, 387, 388,
+     7,   7, 387, 388, 387, 388, 387, 388, 387, 388, 387, 388,
+   387, 388, 387, 388,   7,   7,   7, 387, 388, 387, 388,   7,
+     7,   7,   7,   7, 390,   7,   7,   7,   7,   7,   7,   7,
+     7,   7, 387, 388,   7,   7, 391,   7, 392, 393,   7, 393,
+     7,   7,   7,   7,   7, 387, 388, 387, 388, 394,   7,   7,
+   387, 388,   7,   7,   7,   7, 387, 388, 387, 388, 387, 388,
+   387, 388,   7,   7, 387, 388, 395, 395, 395,   7, 396, 396,
+     7,   7, 397, 397, 397, 398, 398,   7,   5,   6,   5,   6,
+    18,  18,  18,  18,   7,   7,  18,  18,  18,  18,  18,  18,
+    18,   5,   6,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     7,  18,  18,  18,  18,  18,  18,   7,   7,   7,   7,   7,
+     7,   7,   7,   7,  18,  18,  18,  18,  18,  18,  18,   0,
+     0,   0,   0,   0,  18,  18,  18,  18,  18,  18,  18,   0,
+    22,  22,  22,  22,  18,  18,  18,  18,  18,  18,  22,  22,
+    22,  22,  22,  22,  18,  18,  18,  18,  18,  18,  18,   7,
+    18,   7,  18,  18,  18,  18,  18,  18,   5,   6,   5,   6,
+     5,   6,   5,   6,   5,   6,   5,   6,   5,   6,  22,  22,
+     7,   7,   7, 387, 388,   5,   6,   7, 387, 388,   7,  10,
+     7,  11,   7,   7,   7,   7,   7,   7,   7, 387, 388,   7,
+     7,   7, 387, 388, 387, 388,   5,   6, 399, 399, 399, 399,
+   399, 399, 399, 399,   7,   7,   7,   5,   6,   5,   6,   5,
+     6,   5,   6,   5,   6, 400, 401, 402, 403,   5,   6,   5,
+     6,   5,   6,   5,   6,   7,   7,   7,   7,   7,   7,   7,
+   404,   7,   7,   7,   7,   7,   7,   7, 387, 388,   7,   7,
+   387, 388,   7,   7,   7,   7,   7,   7,   7,   7,   7, 387,
+   388, 387, 388,   7, 387, 388,   7,   7,   5,   6,   5,   6,
+     7,   7,   7,   7,   7,   7,   7,   7,   7, 405,   7,   7,
+   387, 388,   7,   7,   5,   6,   7,   7,   7,   7,   7, 387,
+   388, 387, 388,   7,   7, 387, 388,   7,   7, 387, 388, 387,
+   388, 387, 388, 387, 388,   7,   7,   7,   7,   7,   7, 387,
+   388,   7,   7,   7,   7, 387, 388, 387, 388, 387, 388, 387,
+     7, 387, 388,   7,   7,   7, 387, 388, 387, 388, 387, 388,
+   387, 388,   7, 387, 388,   7,   7, 387, 388,   7,   7,   7,
+     7,   7,   7, 387, 388, 387, 388, 387, 388, 387, 388, 387,
+   388, 387, 388,   7,   7,   7,   7,   7,   7, 387, 388, 387,
+     7,   7,   7,   7,   7,   7, 406,   7,   7,   7,   7, 407,
+   408, 407,   7,   7,   7,   7,   7,   7,   7,  18,  18,   7,
+    18,  18,  18,  18,   0,   0,  18,  18,  18,  18,  18,  18,
+    18,  18,   0,   0,  18,  18,   0,   0,   0,  18,  18,  18,
+    18,   0,  18,  18,  18,  18,  18,  18,  18,  18,   0,   0,
+     0,   0,   0,   0,   0,   0,   0,   0,  18,  18,  18,  18,
+   409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409, 409,
+   409, 409, 409,   0, 410, 410, 410, 410, 410, 410, 410, 410,
+   410, 410, 410, 410, 410, 410, 410,   0,  12,  17,  12,  12,
+    12,  17,  17,  12,  17,  12,  17,  12,  17,  12,  12,  12,
+    12,  17,  12,  17,  17,  12,  17,  17,  17,  17,  17,  17,
+    26,  26,  12,  12,  43,  44,  43,  44,  44, 411, 411, 411,
+   411, 411, 411,  43,  44,  43,  44, 412, 412, 412,  43,  44,
+     0,   0,   0,   0,   0, 413, 413, 413, 413, 414, 413, 413,
+   415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415, 415,
+   415, 415,   0, 415,   0,   0,   0,   0,   0, 415,   0,   0,
+   416, 416, 416, 416, 416, 416, 416, 416,   0,   0,   0,   0,
+     0,   0,   0, 417, 418,   0,   0,   0,   0,   0,   0,   0,
+     0,   0,   0,   0,   0,   0,   0, 419,  49,  49,  49,  49,
+    49,  49,  49,  49,   3,   3, 380, 381, 380, 381,   3,   3,
+     3, 380, 381,   3, 380, 381,   3,   3,   3,   3,   3,   3,
+     3,   3,   3,   8,   3,   3,   8,   3, 380, 381,   3,   3,
+   380, 381,   5,   6,   5,   6,   5,   6,   5,   6,   3,   3,
+     3,   3,   3,  27,   3,   3,   8,   8,   3,   3,   3,   3,
+     8,   3, 377,   0,   0,   0,   0,   0, 420, 420, 420, 420,
+   420, 420, 420, 420, 420, 420,   0, 420, 420, 420, 420, 420,
+   420, 420, 420, 420,   0,   0,   0,   0, 420, 420, 420, 420,
+   420, 420,   0,   0,  18,  18,  18,  18,   0,   0,   0,   0,
+     2,   3,   3,   3,  18, 421, 369, 422,   5,   6,  18,  18,
+     5,   6,   5,   6,   5,   6,   5,   6,   8, 377, 423, 423,
+    18, 422, 422, 422, 422, 422, 422, 422, 422, 422, 424, 425,
+    30, 426, 427, 427,   8,  27,  27,  27,  27,  27,  18,  18,
+   422, 422, 422, 421, 369,   3,  18,  18,   0, 428, 428, 428,
+   428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+   428, 428, 428, 428, 428, 428, 428,   0,   0, 429, 429,  15,
+    15, 430, 430, 428,   8, 431, 431, 431, 431, 431, 431, 431,
+   431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431,   3,
+    27, 432, 432, 431,   0,   0,   0,   0,   0, 433, 433, 433,
+   433, 433, 433, 433, 433, 433, 433, 433, 433, 433, 433, 433,
+   433, 433,   0,   0,   0, 257, 257, 257, 257, 257, 257, 257,
+   257, 257, 257, 257, 257, 257, 257,   0,  18,  18,  22,  22,
+    22,  22,  18,  18, 433, 433, 433,   0,   0,   0,   0,   0,
+   434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434,
+   434, 434, 434,   0,  22,  22,  18,  18,  18,  18,  18,  18,
+    18,  22,  22,  22,  22,  22,  22,  22, 434, 434, 434, 434,
+   434, 434, 434,  18, 435, 435, 435, 435, 435, 435, 435, 435,
+   435, 435, 435, 435, 435, 435, 435,   0, 436, 436, 436, 436,
+   436, 436, 436, 436, 436, 436, 436, 436, 436, 436,   0,   0,
+   437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437, 437,
+   437, 438, 437, 437, 437, 437, 437, 437, 437,   0,   0,   0,
+   439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439, 439,
+   439, 439, 439,   0, 440, 440, 440, 440, 440, 440, 440, 440,
+   441, 441, 441, 441, 441, 441, 442, 442, 443, 443, 443, 443,
+   443, 443, 443, 443, 443, 443, 443, 443, 444, 445, 445, 445,
+   446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 443, 443,
+     0,   0,   0,   0,  46,  47,  46,  47,  46,  47, 447,  49,
+    50,  50,  50, 448,  49,  49,  49,  49,  49,  49,  49,  49,
+    49,  49, 448, 370,  46,  47,  46,  47, 370, 370,  49,  49,
+   449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449, 449,
+   449, 449, 450, 450, 450, 450, 450, 450, 450, 450, 450, 450,
+   451, 451, 452, 452, 452, 452, 452, 452,  15,  15,  15,  15,
+    15,  15,  15,  27,  15,  15,  12,  17,  12,  17,  12,  17,
+    26,  17,  17,  17,  17,  17,  17,  17,  17,  12,  17,  12,
+    17,  12,  12,  17,  27,  15,  15,  12,  17,  12,  17,  19,
+    12,  17,  12,  17,  17,  17,  12,  17,  12,  17,  12,  12,
+    12,  12,   0,   0,  12,  12,  12,  12,  12,  17,  12,  17,
+     0,   0,   0,   0,   0,   0,   0,  19,  26,  26,  17,  19,
+    19,  19,  19,  19, 453, 453, 454, 453, 453, 453, 455, 453,
+   453, 453, 453, 454, 453, 453, 453, 453, 453, 453, 453, 453,
+   453, 453, 453, 453, 453, 453, 453, 456, 456, 454, 454, 456,
+   457, 457, 457, 457,   0,   0,   0,   0,  22,  22,  22,  22,
+    22,  22,  18,  18,   4,  18,   0,   0,   0,   0,   0,   0,
+   458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 459, 460,
+   461, 461, 461, 461, 462, 462, 463, 463, 463, 463, 463, 463,
+   463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463,
+   462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 462,
+   462, 462, 462, 462, 464,   0,   0,   0,   0,   0,   0,   0,
+     0,   0, 465, 465, 466, 466, 466, 466, 466, 466, 466, 466,
+   466, 466,   0,   0,   0,   0,   0,   0, 144, 144, 144, 144,
+   144, 144, 144, 144, 144, 144, 141, 141, 141, 141, 141, 141,
+   146, 146, 146, 141, 146, 141,   0,   0, 467, 467, 467, 467,
+   467, 467, 467, 467, 467, 467, 468, 468, 468, 468, 468, 468,
+   468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
+   468, 468, 469, 469, 469, 469, 469, 470, 470, 470,   3, 471,
+   472, 472, 472, 472, 472, 472, 472, 472, 472, 472, 472, 472,
+   472, 472, 472, 473, 473, 473, 473, 473, 473, 473, 473, 473,
+   473, 473, 474, 475,   0,   0,   0,   0,   0,   0,   0,   0,
+     0,   0,   0, 476, 257, 257, 257, 257, 257,   0,   0,   0,
+   477, 477, 477, 478, 479, 479, 479, 479, 479, 479, 479, 479,
+   479, 479, 479, 479, 479, 479, 479, 480, 478, 478, 477, 477,
+   477, 477, 478, 478, 477, 478, 478, 478, 481, 482, 482, 482,
+   482, 482, 482, 482, 482, 482, 482, 482, 482, 482,   0,  27,
+   483, 483, 483, 483, 483, 483, 483, 483, 483, 483,   0,   0,
+     0,   0, 482, 482, 245, 245, 245, 245, 245, 247, 484, 245,
+   250, 250, 245, 245, 245, 245, 245,   0, 485, 485, 485, 485,
+   485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 487,
+   487, 486, 486, 487, 487, 486, 486,   0, 485, 485, 485, 486,
+   485, 485, 485, 485, 485, 485, 485, 485, 486, 487,   0,   0,
+   488, 488, 488, 488, 488, 488, 488, 488, 488, 488,   0,   0,
+   489, 489, 489, 489, 484, 245, 245, 245, 245, 245, 245, 253,
+   253, 253, 245, 246, 247, 246, 245, 245, 490, 490, 490, 490,
+   490, 490, 490, 490, 491, 490, 491, 491, 492, 490, 490, 491,
+   491, 490, 490, 490, 490, 490, 491, 491, 490, 491, 490,   0,
+     0,   0,   0,   0,   0,   0,   0, 490, 490, 493, 494, 494,
+   495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 495, 496,
+   497, 497, 496, 496, 498, 498, 495, 499, 499, 496, 500,   0,
+     0, 258, 258, 258, 258, 258, 258,   0,  17,  17,  17,  15,
+    26,  26,  26,  26,  17,  17,  17,  17,  17,  40,   0,   0,
+   264, 264, 264, 264, 264, 264, 264, 264, 495, 495, 495, 496,
+   496, 497, 496, 496, 497, 496, 496, 498, 496, 500,   0,   0,
+   501, 501, 501, 501, 501, 501, 501, 501, 501, 501,   0,   0,
+     0,   0,   0,   0, 257, 257, 257, 257,   0,   0,   0,   0,
+     0,   0,   0, 257, 257, 257, 257, 257, 502, 502, 502, 502,
+   502, 502, 502, 502, 503, 503, 503, 503, 503, 503, 503, 503,
+   436, 436,   0,   0,   0,   0,   0,   0,  17,  17,  17,  17,
+    17,  17,  17,   0,   0,   0,   0,  54,  54,  54,  54,  54,
+     0,   0,   0,   0,   0,  80, 504,  80,  80, 505,  80,  80,
+    80,  80,  80,  80,  80,  80,  80,  80,  80,  80,  80,   0,
+    80,  80,  80,  80,  80,   0,  80,   0,  80,  80,   0,  80,
+    80,   0,  80,  80, 506, 506, 506, 506, 506, 506, 506, 506,
+   506, 506, 507, 507, 507, 507, 507, 507, 507, 507, 507, 507,
+   507, 507, 507, 507, 507, 507,   0,   0,   0,   0,   0,   0,
+     0,   0,   0, 506, 506, 506, 506, 506, 506, 506, 506, 506,
+   506, 506, 423, 377,   0,   0, 506, 506, 506, 506, 506, 506,
+   506, 506, 506, 506, 508,  87,   0,   0,  36,  36,  36,  36,
+    36,  36,  36,  36,   3,   3,   3,   3,   3,   3,   3, 377,
+   423,   3,   0,   0,   0,   0,   0,   0,  29,  29,  29,  29,
+    29,  29,  29,  31,  31,  31,  31,  31,  31,  31,  49,  49,
+     3,   8,   8,  16,  16, 377, 423, 377, 423, 377, 423, 377,
+   423, 377, 423, 377, 423, 377, 423, 377, 423,   3,   3, 377,
+   423,   3,   3,   3,   3,  16,  16,  16,   3,   3,   3,   0,
+     3,   3,   3,   3,   8,   5,   6,   5,   6,   5,   6,   3,
+     3,   3,   7,   8, 387, 388,   7,   0,   3,   4,   3,   3,
+     0,   0,   0,   0, 506, 506, 506, 506, 506,   0, 506, 506,
+   506, 506, 506, 506, 506,   0,   0,  21,   0,   3,   3,   3,
+     4,   3,   3,   3,  17,  17,  17,  13,   7,  14,   7,   5,
+     6,   3,   5,   6,   3,   3, 431, 431,  27, 431, 431, 431,
+   431, 431, 431, 431, 431, 431, 431, 431, 431, 431,  27,  27,
+     0,   0, 257, 257, 257, 257, 257, 257,   0,   0, 257, 257,
+   257,   0,   0,   0,   4,   4,   7,  15,  18,   4,   4,   0,
+    18,   7,   7,   7,   7,  18,  18,   0,   0,  21,  21,  21,
+    18,  18,   0,   0, 509, 509, 509, 509, 509, 509, 509, 509,
+   509, 509, 509, 509,   0, 509, 509, 509, 509, 509, 509, 509,
+   509, 509, 509,   0, 509, 509, 509,   0, 509, 509,   0, 509,
+   509, 509, 509, 509, 509, 509,   0,   0, 509, 509, 509,   0,
+     0,   0,   0,   0,   3,   3,   3,   0,   0,   0,   0,  22,
+    22,  22,  22,  22,   0,   0,   0,  18, 510, 510, 510, 510,
+   510, 510, 510, 510, 510, 510, 510, 510, 510, 511, 511, 511,
+   511, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512,
+   512, 512, 512, 512, 512, 512, 511, 511, 512,   0,   0,   0,
+   512,   0,   0,   0,   0,   0,   0,   0,  18,  18,  18,  18,
+    18,  31,   0,   0, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513,   0,   0,   0, 514, 514, 514, 514,
+   514, 514, 514, 514, 514,   0,   0,   0,   0,   0,   0,   0,
+    31,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,
+     0,   0,   0,   0, 515, 515, 515, 515, 515, 515, 515, 515,
+   516, 516, 516, 516,   0,   0,   0,   0, 517, 517, 517, 517,
+   517, 517, 517, 517, 517, 518, 517, 517, 517, 517, 517, 517,
+   517, 517, 518,   0,   0,   0,   0,   0, 519, 519, 519, 519,
+   519, 519, 519, 519, 519, 519, 519, 519, 519, 519, 520, 520,
+   520, 520, 520,   0,   0,   0,   0,   0, 521, 521, 521, 521,
+   521, 521, 521, 521, 521, 521, 521, 521, 521, 521,   0, 522,
+   523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523, 523,
+     0,   0,   0,   0, 524, 525, 525, 525, 525, 525,   0,   0,
+   526, 526, 526, 526, 526, 526, 526, 526, 527, 527, 527, 527,
+   527, 527, 527, 527, 528, 528, 528, 528, 528, 528, 528, 528,
+   529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529, 529,
+   529, 529,   0,   0, 530, 530, 530, 530, 530, 530, 530, 530,
+   530, 530,   0,   0,   0,   0,   0,   0, 531, 531, 531, 531,
+   531, 531, 531, 531, 532, 532, 532, 532, 532, 532, 532, 532,
+   532, 532, 532, 532,   0,   0,   0,   0,   0,   0,   0,   0,
+     0,   0,   0, 533, 534, 534, 534, 534, 534, 534, 534, 534,
+   534, 534, 534, 534, 534, 534, 534,   0, 534, 534, 534, 534,
+   534, 534,   0,   0, 535, 535, 535, 535, 535, 535,   0,   0,
+   535,   0, 535, 535, 535, 535, 535, 535, 535, 535, 535, 535,
+   535, 535, 535, 535, 535, 535, 535, 535, 535, 535,   0, 535,
+   535,   0,   0,   0, 535,   0,   0, 535, 536, 536, 536, 536,
+   536, 536, 536, 536, 536, 536, 536, 536, 536, 536,   0, 537,
+   538, 538, 538, 538, 538, 538, 538, 538, 539, 539, 539, 539,
+   539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 540,
+   540, 541, 541, 541, 541, 541, 541, 541, 542, 542, 542, 542,
+   542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542,   0,
+     0,   0,   0,   0,   0,   0,   0, 543, 543, 543, 543, 543,
+   543, 543, 543, 543, 544, 544, 544, 544, 544, 544, 544, 544,
+   544, 544, 544,   0, 544, 544,   0,   0,   0,   0,   0, 545,
+   545, 545, 545, 545, 546, 546, 546, 546, 546, 546, 546, 546,
+   546, 546, 546, 546, 546, 546, 547, 547, 547, 547, 547, 547,
+     0,   0,   0, 548, 549, 549, 549, 549, 549, 549, 549, 549,
+   549, 549,   0,   0,   0,   0,   0, 550, 551, 551, 551, 551,
+   551, 551, 551, 551, 552, 552, 552, 552, 552, 552, 552, 552,
+     0,   0,   0,   0, 553, 553, 552, 552, 553, 553, 553, 553,
+   553, 553, 553, 553,   0,   0, 553, 553, 553, 553, 553, 553,
+   554, 555, 555, 555,   0, 555, 555,   0,   0,   0,   0,   0,
+   555, 556, 555, 557, 554, 554, 554, 554,   0, 554, 554, 554,
+     0, 554, 554, 554, 554, 554, 554, 554, 554, 554, 554, 554,
+   554, 554, 554, 554, 554, 554, 554, 554,   0,   0,   0,   0,
+   557, 558, 556,   0,   0,   0,   0, 559, 560, 560, 560, 560,
+   560, 560, 560, 560, 561, 561, 561, 561, 561, 561, 561, 561,
+   561,   0,   0,   0,   0,   0,   0,   0, 562, 562, 562, 562,
+   562, 562, 562, 562, 562, 562, 562, 562, 562, 563, 563, 564,
+   565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565,
+   565, 566, 566, 566, 567, 567, 567, 567, 567, 568, 569, 568,
+   570, 568, 568, 569, 569, 571, 568, 568, 568, 568, 568, 567,
+   567, 567, 567, 571, 567, 567, 567, 567, 567, 568, 567, 567,
+   567, 568, 569, 569, 568, 572, 573,   0,   0,   0,   0, 574,
+   574, 574, 574, 575, 576, 576, 576, 576, 576, 576, 576,   0,
+   577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577,
+   577, 577,   0,   0,   0, 578, 578, 578, 578, 578, 578, 578,
+   579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579, 579,
+   579, 579,   0,   0, 580, 580, 580, 580, 580, 580, 580, 580,
+   581, 581, 581, 581, 581, 581, 581, 581, 581, 581, 581,   0,
+     0,   0,   0,   0, 582, 582, 582, 582, 582, 582, 582, 582,
+   583, 584, 583, 584, 584, 584, 583, 583, 583, 584, 583, 583,
+   584, 583, 584, 584, 583, 584,   0,   0,   0,   0,   0,   0,
+     0, 585, 585, 585, 585,   0,   0,   0,   0, 586, 586, 586,
+   586, 587, 587, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+   589,   0,   0,   0,   0,   0,   0,   0, 590, 590, 590, 590,
+   590, 590, 590, 590, 590, 590, 590,   0,   0,   0,   0,   0,
+   591, 591, 591, 591, 591, 591, 591, 591, 591, 591, 591,   0,
+     0,   0,   0,   0,   0,   0, 592, 592, 592, 592, 592, 592,
+   593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 593, 593,
+   593, 593, 593,   0, 594, 595, 594, 596, 596, 596, 596, 596,
+   596, 596, 596, 596, 596, 596, 596, 596, 595, 595, 595, 595,
+   595, 595, 595, 595, 595, 595, 595, 595, 595, 595, 597, 598,
+   598, 598, 598, 598, 598, 598,   0,   0,   0,   0, 599, 599,
+   599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599,
+   599, 599, 599, 599, 599, 599, 600, 600, 600, 600, 600, 600,
+   600, 600, 600, 600,   0,   0,   0,   0,   0,   0,   0, 597,
+   601, 601, 602, 603, 603, 603, 603, 603, 603, 603, 603, 603,
+   603, 603, 603, 603, 602, 602, 602, 601, 601, 601, 601, 602,
+   602, 604, 605, 606, 606, 607, 606, 606, 606, 606,   0,   0,
+     0,   0,   0,   0, 608, 608, 608, 608, 608, 608, 608, 608,
+   608,   0,   0,   0,   0,   0,   0,   0, 609, 609, 609, 609,
+   609, 609, 609, 609, 609, 609,   0,   0,   0,   0,   0,   0,
+   610, 610, 610, 611, 611, 611, 611, 611, 611, 611, 611, 611,
+   611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 611, 612,
+   612, 612, 612, 612, 613, 612, 612, 612, 612, 612, 612, 614,
+   614,   0, 615, 615, 615, 615, 615, 615, 615, 615, 615, 615,
+   616, 616, 616, 616,   0,   0,   0,   0, 617, 617, 617, 617,
+   617, 617, 617, 617, 617, 617, 617, 618, 619, 619, 617,   0,
+   620, 620, 621, 622, 622, 622, 622, 622, 622, 622, 622, 622,
+   622, 622, 622, 622, 622, 622, 622, 621, 621, 621, 620, 620,
+   620, 620, 620, 620, 620, 620, 620, 621, 623, 622, 622, 622,
+   622, 624, 624, 624, 624, 624, 625, 620, 620, 624,   0,   0,
+   626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 622, 624,
+   622, 624, 624, 624,   0, 627, 627, 627, 627, 627, 627, 627,
+   627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627,
+   627,   0,   0,   0, 628, 628, 628, 628, 628, 628, 628, 628,
+   628, 628,   0, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+   629, 629, 629, 630, 630, 630, 629, 629, 630, 631, 632, 630,
+   633, 633, 633, 633, 633, 633,   0,   0, 634, 634, 634, 634,
+   634, 634, 634,   0, 634,   0, 634, 634, 634, 634,   0, 634,
+   634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+   634, 634,   0, 634, 634, 635,   0,   0,   0,   0,   0,   0,
+   636, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636,
+   636, 636, 636, 637, 638, 638, 638, 637, 637, 637, 637, 637,
+   637, 639, 640,   0,   0,   0,   0,   0, 641, 641, 641, 641,
+   641, 641, 641, 641, 641, 641,   0,   0,   0,   0,   0,   0,
+   642, 642, 643, 643,   0, 644, 644, 644, 644, 644, 644, 644,
+   644,   0,   0, 644, 644,   0,   0, 644, 644, 644, 644, 644,
+   644, 644, 644, 644, 644, 644, 644, 644, 644,   0, 644, 644,
+   644, 644, 644, 644, 644,   0, 644, 644,   0, 644, 644, 644,
+   644, 644,   0,   0, 645, 644, 643, 643, 642, 643, 643, 643,
+   643,   0,   0, 643, 643,   0,   0, 643, 643, 646,   0,   0,
+   644,   0,   0,   0,   0,   0,   0, 643,   0,   0,   0,   0,
+     0, 644, 644, 644, 644, 644, 643, 643,   0,   0, 647, 647,
+   647, 647, 647, 647, 647,   0,   0,   0, 648, 648, 648, 648,
+   648, 648, 648, 648, 649, 649, 649, 650, 650, 650, 650, 650,
+   650, 649, 650, 649, 649, 649, 649, 650, 650, 649, 651, 652,
+   648, 648, 653, 648, 654, 654, 654, 654, 654, 654, 654, 654,
+   654, 654,   0,   0,   0,   0,   0,   0, 655, 655, 655, 655,
+   655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 655, 656,
+   656, 656, 657, 657, 657, 657,   0,   0, 656, 656, 656, 656,
+   657, 657, 656, 658, 659, 660, 660, 660, 660, 660, 660, 660,
+   660, 660, 660, 660, 660, 660, 660, 660, 655, 655, 655, 655,
+   657, 657,   0,   0, 661, 661, 661, 661, 661, 661, 661, 661,
+   662, 662, 662, 663, 663, 663, 663, 663, 663, 663, 663, 662,
+   662, 663, 662, 664, 663, 665, 665, 665, 661,   0,   0,   0,
+   666, 666, 666, 666, 666, 666, 666, 666, 666, 666,   0,   0,
+     0,   0,   0,   0, 667, 667, 667, 667, 667, 667, 667, 667,
+   667, 667, 667, 668, 669, 668, 669, 669, 668, 668, 668, 668,
+   668, 668, 670, 671, 672, 672, 672, 672, 672, 672, 672, 672,
+   672, 672,   0,   0,   0,   0,   0,   0, 673, 673, 673, 673,
+   673, 673, 673, 673, 673, 673,   0,   0,   0, 674, 674, 674,
+   675, 675, 674, 674, 674, 674, 675, 674, 674, 674, 674, 676,
+     0,   0,   0,   0, 677, 677, 677, 677, 677, 677, 677, 677,
+   677, 677, 678, 678, 679, 679, 679, 680, 681, 681, 681, 681,
+   681, 681, 681, 681, 682, 682, 682, 682, 682, 682, 682, 682,
+   683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 684, 684,
+   684, 684, 684, 684, 684, 684, 684,   0,   0,   0,   0,   0,
+     0,   0,   0,   0,   0,   0,   0, 685, 686, 686, 686, 686,
+   686, 686, 686, 686, 686,   0,   0,   0,   0,   0,   0,   0,
+   687, 687, 687, 687, 687, 687, 687, 687, 687, 687,   0,   0,
+     0,   0,   0,   0, 688, 688, 688, 688, 688, 688, 688, 688,
+   688, 688, 688, 688, 688, 688, 688,   0, 689, 689, 689, 689,
+   689,   0,   0,   0, 687, 687, 687, 687,   0,   0,   0,   0,
+   690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690, 690,
+   690, 690, 690,   0, 691, 691, 691, 691, 691, 691, 691, 691,
+   691, 691, 691, 691, 691, 691, 691,   0, 449,   0,   0,   0,
+     0,   0,   0,   0, 692, 692, 692, 692, 692, 692, 692, 692,
+   692, 692, 692, 692, 692, 692, 692,   0, 693, 693, 693, 693,
+   693, 693, 693, 693, 693, 693,   0,   0,   0,   0, 694, 694,
+   695, 695, 695, 695, 695, 695, 695, 695, 695, 695, 695, 695,
+   695, 695,   0,   0, 696, 696, 696, 696, 696, 697,   0,   0,
+   698, 698, 698, 698, 698, 698, 698, 698, 699, 699, 699, 699,
+   699, 699, 699, 700, 700, 700, 700, 700, 701, 701, 701, 701,
+   702, 702, 702, 702, 700, 701,   0,   0, 703, 703, 703, 703,
+   703, 703, 703, 703, 703, 703,   0, 704, 704, 704, 704, 704,
+   704, 704,   0, 698, 698, 698, 698, 698,   0,   0,   0,   0,
+     0, 698, 698, 698, 705, 705, 705, 705, 705, 705, 705, 705,
+   705, 705, 705, 705, 705,   0,   0,   0, 705, 706, 706, 706,
+   706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706, 706,
+   706, 706, 706, 706, 706, 706, 706,   0,   0,   0,   0,   0,
+     0,   0,   0, 707, 707, 707, 707, 708, 708, 708, 708, 708,
+   708, 708, 708, 708, 708, 708, 708, 708, 431, 428,   0,   0,
+     0,   0,   0,   0, 709, 709, 709, 709, 709, 709, 709, 709,
+   709, 709, 709,   0,   0,   0,   0,   0, 709, 709, 709, 709,
+   709,   0,   0,   0, 709,   0,   0,   0,   0,   0,   0,   0,
+   709, 709,   0,   0, 710, 711, 712, 713,  21,  21,  21,  21,
+     0,   0,   0,   0,   0,  18,  18,  18,  18,  18,  18,  18,
+    18,  18,  18,  18,  18, 714, 714,  34,  34,  34,  18,  18,
+    18, 715, 714, 714, 714, 714, 714,  21,  21,  21,  21,  21,
+    21,  21,  21,  31,  31,  31,  31,  31,  31,  31,  31,  18,
+    18,  29,  29,  29,  29,  29,  31,  31,  18,  18,  18,  18,
+    18,  18,  29,  29,  29,  29,  18,  18,  18,   0,   0,   0,
+     0,   0,   0,   0, 512, 512, 716, 716, 716, 512,   0,   0,
+    22,  22,   0,   0,   0,   0,   0,   0, 382, 382, 382, 382,
+   382, 382, 382, 382, 382, 382,  23,  23,  23,  23,  23,  23,
+    23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+   382, 382, 382, 382, 382, 382, 382, 382, 382, 382,  23,  23,
+    23,  23,  23,  23,  23,   0,  23,  23,  23,  23,  23,  23,
+   382,   0, 382, 382,   0,   0, 382,   0,   0, 382, 382,   0,
+     0, 382, 382, 382, 382,   0, 382, 382,  23,  23,   0,  23,
+     0,  23,  23,  23,  23,  23,  23,  23,   0,  23,  23,  23,
+    23,  23,  23,  23, 382, 382,   0, 382, 382, 382, 382,   0,
+     0, 382, 382, 382, 382, 382, 382, 382, 382,   0, 382, 382,
+   382, 382, 382, 382, 382,   0,  23,  23, 382, 382,   0, 382,
+   382, 382, 382,   0, 382, 382, 382, 382, 382,   0, 382,   0,
+     0,   0, 382, 382, 382, 382, 382, 382, 382,   0,  23,  23,
+    23,  23,  23,  23,  23,  23,  23,  23,  23,  23,   0,   0,
+   382,   7,  23,  23,  23,  23,  23,  23,  23,  23,  23,   7,
+    23,  23,  23,  23,  23,  23, 382, 382, 382, 382, 382, 382,
+   382, 382, 382,   7,  23,  23,  23,  23,  23,  23,  23,  23,
+    23,   7,  23,  23, 382, 382, 382, 382, 382,   7,  23,  23,
+    23,  23,  23,  23,  23,  23,  23,   7,  23,  23,  23,  23,
+    23,  23, 382, 382, 382, 382, 382, 382, 382, 382, 382,   7,
+    23,   7,  23,  23,  23,  23,  23,  23,  23,  23, 382,  23,
+     0,   0,   9,   9, 717, 717, 717, 717, 717, 717, 717, 717,
+   718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718, 718,
+   718, 718, 718, 717, 717, 717, 717, 718, 718, 718, 718, 718,
+   718, 718, 718, 718, 718, 717, 717, 717, 717, 717, 717, 717,
+   717, 718, 717, 717, 717, 717, 717, 717, 718, 717, 717, 719,
+   719, 719, 719, 719,   0,   0,   0,   0,   0,   0,   0, 718,
+   718, 718, 718, 718,   0, 718, 718, 718, 718, 718, 718, 718,
+   720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720, 720,
+   720,   0,   0, 721, 721, 721, 721, 721, 721, 721, 721, 721,
+   722, 722, 722, 722, 722, 722, 722,   0, 506, 506, 506, 506,
+     0, 506, 506, 506,   0, 506, 506,   0, 506,   0,   0, 506,
+     0, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506,   0,
+   506, 506, 506, 506,   0, 506,   0, 506,   0,   0,   0,   0,
+     0,   0, 506,   0,   0,   0,   0, 506,   0, 506,   0, 506,
+     0, 506, 506, 506,   0, 506,   0, 506,   0, 506,   0, 506,
+     0, 506, 506, 506, 506,   0, 506,   0, 506, 506,   0, 506,
+   506, 506, 506, 506, 506, 506, 506, 506,   0,   0,   0,   0,
+     0, 506, 506, 506,   0, 506, 506, 506,  83,  83,   0,   0,
+     0,   0,   0,   0,  22,  22,  22,  22,  22,   0,   0,   0,
+     0,   0,   0,   0,   0,   0,  18,  18, 723,  18,  18,   0,
+     0,   0,   0,   0,  18,  18,  18,  15,  15,  15,  15,  15,
+    18,  18,   0,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     0,  18,  18,  18,  18,  18,  18,  18,  18,   0,   0,   0,
+   436, 436, 436, 436, 436, 436, 436,   0, 436, 436, 436, 436,
+   436,   0,   0,   0,   0,  21,   0,   0,   0,   0,   0,   0,
+    21,  21,  21,  21,  21,  21,  21,  21, 503, 503, 503, 503,
+   503, 503,   0,   0,
+};
+
+/* Table size: 35778 bytes */
+
+/* == End of generated table == */
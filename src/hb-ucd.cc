@@ -0,0 +1,167 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "hb-private.hh"
+
+#include "hb-unicode-private.hh"
+#include "hb-ucd-private.hh"
+
+#include "ucdn.h"
+
+
+/* The per-character properties come from the flat table; composition,
+ * decomposition and East Asian width from UCDN, which the table is
+ * generated to match. */
+
+static hb_unicode_combining_class_t
+hb_ucd_combining_class (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+			hb_codepoint_t      unicode,
+			void               *user_data HB_UNUSED)
+{
+  return _hb_ucd_combining_class (_hb_ucd_record (unicode));
+}
+
+static unsigned int
+hb_ucd_eastasian_width (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+			hb_codepoint_t      unicode,
+			void               *user_data HB_UNUSED)
+{
+  int w = ucdn_get_east_asian_width (unicode);
+  return (w == UCDN_EAST_ASIAN_F || w == UCDN_EAST_ASIAN_W) ? 2 : 1;
+}
+
+static hb_unicode_general_category_t
+hb_ucd_general_category (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+			 hb_codepoint_t      unicode,
+			 void               *user_data HB_UNUSED)
+{
+  return _hb_ucd_general_category (_hb_ucd_record (unicode));
+}
+
+static hb_codepoint_t
+hb_ucd_mirroring (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+		  hb_codepoint_t      unicode,
+		  void               *user_data HB_UNUSED)
+{
+  return _hb_ucd_mirroring (_hb_ucd_record (unicode), unicode);
+}
+
+static hb_script_t
+hb_ucd_script (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+	       hb_codepoint_t      unicode,
+	       void               *user_data HB_UNUSED)
+{
+  return _hb_ucd_script (_hb_ucd_record (unicode));
+}
+
+static hb_bool_t
+hb_ucd_compose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+		hb_codepoint_t      a,
+		hb_codepoint_t      b,
+		hb_codepoint_t     *ab,
+		void               *user_data HB_UNUSED)
+{
+  return ucdn_compose (ab, a, b);
+}
+
+static hb_bool_t
+hb_ucd_decompose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+		  hb_codepoint_t      ab,
+		  hb_codepoint_t     *a,
+		  hb_codepoint_t     *b,
+		  void               *user_data HB_UNUSED)
+{
+  return ucdn_decompose (ab, a, b);
+}
+
+static unsigned int
+hb_ucd_decompose_compatibility (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+				hb_codepoint_t      u,
+				hb_codepoint_t     *decomposed,
+				void               *user_data HB_UNUSED)
+{
+  return ucdn_compat_decompose (u, decomposed);
+}
+
+
+const hb_unicode_funcs_t _hb_ucd_unicode_funcs = {
+  HB_OBJECT_HEADER_STATIC,
+
+  NULL, /* parent */
+  true, /* immutable */
+  {
+#define HB_UNICODE_FUNC_IMPLEMENT(name) hb_ucd_##name,
+    HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS
+#undef HB_UNICODE_FUNC_IMPLEMENT
+  }
+};
+
+extern "C" HB_INTERNAL
+hb_unicode_funcs_t *
+hb_ucd_get_unicode_funcs (void)
+{
+  return const_cast<hb_unicode_funcs_t *> (&_hb_ucd_unicode_funcs);
+}
+
+
+#ifdef MAIN
+#include <stdio.h>
+
+extern "C" hb_unicode_funcs_t *hb_ucdn_get_unicode_funcs (void);
+
+/* Checks the table against UCDN, both through the inline lookups and
+ * through the callbacks. */
+int
+main (void)
+{
+  hb_unicode_funcs_t *ucd = hb_ucd_get_unicode_funcs ();
+  hb_unicode_funcs_t *ucdn = hb_ucdn_get_unicode_funcs ();
+  unsigned int errors = 0;
+
+  for (hb_codepoint_t u = 0; u <= 0x110001u; u++)
+  {
+#define CHECK(name) \
+    if (ucd->name (u) != ucdn->name (u) || \
+	ucd->func.name (ucd, u, NULL) != ucdn->name (u)) \
+    { \
+      if (errors++ < 100) \
+	fprintf (stderr, "U+%04X: " #name " is %u, UCDN says %u\n", \
+		 u, (unsigned int) ucd->name (u), (unsigned int) ucdn->name (u)); \
+    }
+    CHECK (combining_class);
+    CHECK (general_category);
+    CHECK (mirroring);
+    CHECK (script);
+#undef CHECK
+  }
+
+  if (errors)
+  {
+    fprintf (stderr, "%u differences\n", errors);
+    return 1;
+  }
+  return 0;
+}
+
+#endif
@@ -33,6 +33,7 @@
 
 #include "hb-private.hh"
 #include "hb-object-private.hh"
+#include "hb-ucd-private.hh"
 
 
 extern HB_INTERNAL const uint8_t _hb_modified_combining_class[256];
@@ -69,10 +70,26 @@ struct hb_unicode_funcs_t {
 
   bool immutable;
 
-#define HB_UNICODE_FUNC_IMPLEMENT(return_type, name) \
+  /* The built-in functions, when we have them, are looked up inline. */
+#ifdef HAVE_UCDN
+#define HB_UNICODE_FUNC_IMPLEMENT_UCD(return_type, name, ucd_expr) \
+  inline return_type name (hb_codepoint_t unicode) \
+  { \
+    if (likely (this == &_hb_ucd_unicode_funcs)) return ucd_expr; \
+    return func.name (this, unicode, user_data.name); \
+  }
+#else
+#define HB_UNICODE_FUNC_IMPLEMENT_UCD(return_type, name, ucd_expr) \
   inline return_type name (hb_codepoint_t unicode) { return func.name (this, unicode, user_data.name); }
-HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
-#undef HB_UNICODE_FUNC_IMPLEMENT
+#endif
+  HB_UNICODE_FUNC_IMPLEMENT_UCD (hb_unicode_combining_class_t, combining_class, _hb_ucd_combining_class (_hb_ucd_record (unicode)))
+  HB_UNICODE_FUNC_IMPLEMENT_UCD (hb_unicode_general_category_t, general_category, _hb_ucd_general_category (_hb_ucd_record (unicode)))
+  HB_UNICODE_FUNC_IMPLEMENT_UCD (hb_codepoint_t, mirroring, _hb_ucd_mirroring (_hb_ucd_record (unicode), unicode))
+  HB_UNICODE_FUNC_IMPLEMENT_UCD (hb_script_t, script, _hb_ucd_script (_hb_ucd_record (unicode)))
+#undef HB_UNICODE_FUNC_IMPLEMENT_UCD
+
+  inline unsigned int eastasian_width (hb_codepoint_t unicode)
+  { return func.eastasian_width (this, unicode, user_data.eastasian_width); }
 
   inline hb_bool_t compose (hb_codepoint_t a, hb_codepoint_t b,
 			    hb_codepoint_t *ab)
@@ -1024,6 +1024,9 @@ retry:
     pos->y_offset = y_mult * info->var2.i32;
   }
 
+  /* Uniscribe doesn't tell us where contexts matched. */
+  buffer->unsafe_to_break_all ();
+
   if (backward)
     hb_buffer_reverse (buffer);
 
@@ -0,0 +1,184 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "hb-private.hh"
+
+#include "hb-buffer-private.hh"
+#include "hb-ot-shape-complex-indic-private.hh"
+#include "hb-ot-shape-complex-use-private.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* Times the Indic and USE category lookups, one at a time and batched, on
+ * the characters of each Unicode block the tables cover. */
+
+static const struct block_t {
+  const char *name;
+  hb_codepoint_t first;
+  hb_codepoint_t last;
+} blocks[] = {
+  {"Basic Latin", 0x0000u, 0x007Fu},
+  {"Combining Diacritical Marks", 0x0300u, 0x036Fu},
+  {"Devanagari", 0x0900u, 0x097Fu},
+  {"Bengali", 0x0980u, 0x09FFu},
+  {"Gurmukhi", 0x0A00u, 0x0A7Fu},
+  {"Gujarati", 0x0A80u, 0x0AFFu},
+  {"Oriya", 0x0B00u, 0x0B7Fu},
+  {"Tamil", 0x0B80u, 0x0BFFu},
+  {"Telugu", 0x0C00u, 0x0C7Fu},
+  {"Kannada", 0x0C80u, 0x0CFFu},
+  {"Malayalam", 0x0D00u, 0x0D7Fu},
+  {"Sinhala", 0x0D80u, 0x0DFFu},
+  {"Myanmar", 0x1000u, 0x109Fu},
+  {"Tagalog", 0x1700u, 0x171Fu},
+  {"Hanunoo", 0x1720u, 0x173Fu},
+  {"Buhid", 0x1740u, 0x175Fu},
+  {"Tagbanwa", 0x1760u, 0x177Fu},
+  {"Khmer", 0x1780u, 0x17FFu},
+  {"Limbu", 0x1900u, 0x194Fu},
+  {"Tai Le", 0x1950u, 0x197Fu},
+  {"New Tai Lue", 0x1980u, 0x19DFu},
+  {"Buginese", 0x1A00u, 0x1A1Fu},
+  {"Tai Tham", 0x1A20u, 0x1AAFu},
+  {"Balinese", 0x1B00u, 0x1B7Fu},
+  {"Sundanese", 0x1B80u, 0x1BBFu},
+  {"Batak", 0x1BC0u, 0x1BFFu},
+  {"Lepcha", 0x1C00u, 0x1C4Fu},
+  {"Vedic Extensions", 0x1CD0u, 0x1CFFu},
+  {"General Punctuation", 0x2000u, 0x206Fu},
+  {"Superscripts and Subscripts", 0x2070u, 0x209Fu},
+  {"Geometric Shapes", 0x25A0u, 0x25FFu},
+  {"Syloti Nagri", 0xA800u, 0xA82Fu},
+  {"Phags-pa", 0xA840u, 0xA87Fu},
+  {"Saurashtra", 0xA880u, 0xA8DFu},
+  {"Devanagari Extended", 0xA8E0u, 0xA8FFu},
+  {"Kayah Li", 0xA900u, 0xA92Fu},
+  {"Rejang", 0xA930u, 0xA95Fu},
+  {"Javanese", 0xA980u, 0xA9DFu},
+  {"Myanmar Extended-B", 0xA9E0u, 0xA9FFu},
+  {"Cham", 0xAA00u, 0xAA5Fu},
+  {"Myanmar Extended-A", 0xAA60u, 0xAA7Fu},
+  {"Tai Viet", 0xAA80u, 0xAADFu},
+  {"Meetei Mayek Extensions", 0xAAE0u, 0xAAFFu},
+  {"Meetei Mayek", 0xABC0u, 0xABFFu},
+  {"Variation Selectors", 0xFE00u, 0xFE0Fu},
+  {"Kharoshthi", 0x10A00u, 0x10A5Fu},
+  {"Brahmi", 0x11000u, 0x1107Fu},
+  {"Kaithi", 0x11080u, 0x110CFu},
+  {"Chakma", 0x11100u, 0x1114Fu},
+  {"Mahajani", 0x11150u, 0x1117Fu},
+  {"Sharada", 0x11180u, 0x111DFu},
+  {"Sinhala Archaic Numbers", 0x111E0u, 0x111FFu},
+  {"Khojki", 0x11200u, 0x1124Fu},
+  {"Multani", 0x11280u, 0x112AFu},
+  {"Khudawadi", 0x112B0u, 0x112FFu},
+  {"Grantha", 0x11300u, 0x1137Fu},
+  {"Tirhuta", 0x11480u, 0x114DFu},
+  {"Siddham", 0x11580u, 0x115FFu},
+  {"Modi", 0x11600u, 0x1165Fu},
+  {"Takri", 0x11680u, 0x116CFu},
+  {"Ahom", 0x11700u, 0x1174Fu},
+};
+
+#define BUFFER_LENGTH 4096
+
+static hb_glyph_info_t info[BUFFER_LENGTH];
+static INDIC_TABLE_ELEMENT_TYPE indic_categories[BUFFER_LENGTH];
+static USE_TABLE_ELEMENT_TYPE use_categories[BUFFER_LENGTH];
+
+static double
+elapsed (clock_t start, unsigned int iterations)
+{
+  /* In nanoseconds per character. */
+  return (clock () - start) * 1e9 / CLOCKS_PER_SEC / iterations / BUFFER_LENGTH;
+}
+
+int
+main (int argc, char **argv)
+{
+  unsigned int iterations = argc > 1 ? atoi (argv[1]) : 1000;
+  if (!iterations)
+  {
+    fprintf (stderr, "usage: %s [iterations]\n", argv[0]);
+    exit (1);
+  }
+
+  unsigned int sum = 0;
+  bool ok = true;
+
+  printf ("%-32s %12s %12s %12s %12s\n", "ns/char", "indic", "indic-batch", "use", "use-batch");
+  for (unsigned int b = 0; b < ARRAY_LENGTH (blocks); b++)
+  {
+    const block_t &block = blocks[b];
+    unsigned int size = block.last - block.first + 1;
+    for (unsigned int i = 0; i < BUFFER_LENGTH; i++)
+      info[i].codepoint = block.first + i % size;
+
+    clock_t start = clock ();
+    for (unsigned int n = 0; n < iterations; n++)
+      for (unsigned int i = 0; i < BUFFER_LENGTH; i++)
+	sum += hb_indic_get_categories (info[i].codepoint);
+    double indic = elapsed (start, iterations);
+
+    start = clock ();
+    for (unsigned int n = 0; n < iterations; n++)
+      hb_indic_get_categories_batch (BUFFER_LENGTH,
+				     &info[0].codepoint, sizeof (info[0]),
+				     indic_categories, sizeof (indic_categories[0]));
+    double indic_batch = elapsed (start, iterations);
+
+    start = clock ();
+    for (unsigned int n = 0; n < iterations; n++)
+      for (unsigned int i = 0; i < BUFFER_LENGTH; i++)
+	sum += hb_use_get_categories (info[i].codepoint);
+    double use = elapsed (start, iterations);
+
+    start = clock ();
+    for (unsigned int n = 0; n < iterations; n++)
+      hb_use_get_categories_batch (BUFFER_LENGTH,
+				   &info[0].codepoint, sizeof (info[0]),
+				   use_categories, sizeof (use_categories[0]));
+    double use_batch = elapsed (start, iterations);
+
+    for (unsigned int i = 0; i < BUFFER_LENGTH; i++)
+      if (indic_categories[i] != hb_indic_get_categories (info[i].codepoint) ||
+	  use_categories[i] != hb_use_get_categories (info[i].codepoint))
+      {
+	fprintf (stderr, "U+%04X: batched lookup differs\n", info[i].codepoint);
+	ok = false;
+	break;
+      }
+
+    printf ("%-32s %12.2f %12.2f %12.2f %12.2f\n", block.name, indic, indic_batch, use, use_batch);
+  }
+
+  /* Keep the one-at-a-time loops from being optimized away. */
+  if (sum == 0)
+    printf ("\n");
+
+  return ok ? 0 : 1;
+}
@@ -124,6 +124,30 @@ hb_test_bug_redhat (unsigned int number)
 }
 
 
+/* Fonts */
+
+/* Loads a font file; font_path is relative to srcdir. */
+static inline hb_face_t *
+hb_test_open_font_file (const char *font_path)
+{
+  char *path = g_build_filename (srcdir (), font_path, NULL);
+  char *data;
+  gsize len;
+  hb_blob_t *blob;
+  hb_face_t *face;
+
+  if (!g_file_get_contents (path, &data, &len, NULL))
+    g_error ("%s not found", path);
+  g_free (path);
+
+  blob = hb_blob_create (data, len, HB_MEMORY_MODE_READONLY, data, g_free);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+
+  return face;
+}
+
+
 /* Wrap glib test functions to simplify.  Should have been in glib already. */
 
 /* Drops the "test_" prefix and converts '_' to '/'.
@@ -0,0 +1,131 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+
+#include "hb-test.h"
+
+#include <hb-ot.h>
+
+/* Unit tests for hb-ot-layout.h */
+
+
+static const char *stats_font_path = "../shaping/fonts/sha1sum/c4e48b0886ef460f532fb49f00047ec92c432ec0.ttf";
+
+static void
+shape (hb_font_t *font)
+{
+  static const hb_codepoint_t text[] = {0x0643, 0x0645, 0x062B, 0x0644, 0x0627, 0x064E, 0x0020, 0x0643};
+  hb_buffer_t *buffer = hb_buffer_create ();
+
+  hb_buffer_add_utf32 (buffer, text, G_N_ELEMENTS (text), 0, G_N_ELEMENTS (text));
+  hb_buffer_guess_segment_properties (buffer);
+  g_assert (hb_shape_full (font, buffer, NULL, 0, NULL));
+  hb_buffer_destroy (buffer);
+}
+
+/* Adds up the statistics of all lookups in table_tag. */
+static void
+get_table_stats (hb_face_t *face, hb_tag_t table_tag,
+		 hb_ot_layout_lookup_stats_t *total)
+{
+  unsigned int count = hb_ot_layout_table_get_lookup_count (face, table_tag);
+  hb_ot_layout_lookup_stats_t stats;
+  unsigned int i;
+
+  memset (total, 0, sizeof (*total));
+  for (i = 0; i < count; i++)
+  {
+    g_assert (hb_ot_layout_lookup_get_stats (face, table_tag, i, &stats));
+    g_assert_cmpuint (stats.glyphs_matched, <=, stats.glyphs_examined);
+    if (!stats.applications)
+      g_assert_cmpuint (stats.glyphs_examined, ==, 0);
+    total->applications += stats.applications;
+    total->glyphs_examined += stats.glyphs_examined;
+    total->glyphs_matched += stats.glyphs_matched;
+  }
+
+  /* Out of range. */
+  g_assert (!hb_ot_layout_lookup_get_stats (face, table_tag, count, &stats));
+  g_assert_cmpuint (stats.applications, ==, 0);
+}
+
+static void
+test_ot_layout_lookup_stats (void)
+{
+  hb_face_t *face = hb_test_open_font_file (stats_font_path);
+  hb_font_t *font = hb_font_create (face);
+  hb_ot_layout_lookup_stats_t gsub, gpos, stats;
+
+  hb_ot_font_set_funcs (font);
+
+  /* Not enabled. */
+  shape (font);
+  g_assert (!hb_ot_layout_lookup_get_stats (face, HB_OT_TAG_GSUB, 0, &stats));
+  g_assert_cmpuint (stats.applications, ==, 0);
+  hb_ot_layout_lookup_stats_reset (face);
+
+  g_assert (hb_ot_layout_lookup_stats_enable (face));
+  g_assert (hb_ot_layout_lookup_stats_enable (face));
+  get_table_stats (face, HB_OT_TAG_GSUB, &gsub);
+  g_assert_cmpuint (gsub.applications, ==, 0);
+
+  shape (font);
+  get_table_stats (face, HB_OT_TAG_GSUB, &gsub);
+  get_table_stats (face, HB_OT_TAG_GPOS, &gpos);
+  g_assert_cmpuint (gsub.applications, >, 0);
+  g_assert_cmpuint (gsub.glyphs_matched, >, 0);
+  g_assert_cmpuint (gpos.applications, >, 0);
+  g_assert_cmpuint (gpos.glyphs_matched, >, 0);
+
+  /* Statistics add up over shaping calls. */
+  shape (font);
+  get_table_stats (face, HB_OT_TAG_GSUB, &stats);
+  g_assert_cmpuint (stats.applications, ==, 2 * gsub.applications);
+  g_assert_cmpuint (stats.glyphs_examined, ==, 2 * gsub.glyphs_examined);
+  g_assert_cmpuint (stats.glyphs_matched, ==, 2 * gsub.glyphs_matched);
+
+  hb_ot_layout_lookup_stats_reset (face);
+  get_table_stats (face, HB_OT_TAG_GSUB, &gsub);
+  get_table_stats (face, HB_OT_TAG_GPOS, &gpos);
+  g_assert_cmpuint (gsub.applications, ==, 0);
+  g_assert_cmpuint (gsub.glyphs_examined, ==, 0);
+  g_assert_cmpuint (gpos.applications, ==, 0);
+  g_assert_cmpuint (gpos.glyphs_examined, ==, 0);
+
+  g_assert (!hb_ot_layout_lookup_get_stats (face, HB_TAG ('k','e','r','n'), 0, &stats));
+
+  hb_font_destroy (font);
+  hb_face_destroy (face);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  hb_test_init (&argc, &argv);
+
+  hb_test_add (test_ot_layout_lookup_stats);
+
+  return hb_test_run();
+}
@@ -0,0 +1,435 @@
+/*
+ * Copyright © 2016  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ */
+
+#include "hb-test.h"
+
+#include <hb-ot.h>
+
+/* Unit tests for hb-shape.h with OpenType fonts */
+
+
+static hb_font_t *
+open_font (const char *font_path)
+{
+  hb_face_t *face;
+  hb_font_t *font;
+
+  face = hb_test_open_font_file (font_path);
+  font = hb_font_create (face);
+  hb_face_destroy (face);
+  hb_ot_font_set_funcs (font);
+
+  return font;
+}
+
+static void
+assert_same_glyphs (hb_buffer_t *buffer, hb_buffer_t *expected)
+{
+  unsigned int len, expected_len, i;
+  hb_glyph_info_t *glyphs, *expected_glyphs;
+  hb_glyph_position_t *positions, *expected_positions;
+
+  glyphs = hb_buffer_get_glyph_infos (buffer, &len);
+  positions = hb_buffer_get_glyph_positions (buffer, NULL);
+  expected_glyphs = hb_buffer_get_glyph_infos (expected, &expected_len);
+  expected_positions = hb_buffer_get_glyph_positions (expected, NULL);
+
+  g_assert_cmpint (len, ==, expected_len);
+  for (i = 0; i < len; i++) {
+    g_assert_cmphex (glyphs[i].codepoint, ==, expected_glyphs[i].codepoint);
+    g_assert_cmphex (glyphs[i].cluster,   ==, expected_glyphs[i].cluster);
+    g_assert_cmphex (hb_glyph_info_get_glyph_flags (&glyphs[i]), ==,
+		     hb_glyph_info_get_glyph_flags (&expected_glyphs[i]));
+    g_assert_cmpint (positions[i].x_advance, ==, expected_positions[i].x_advance);
+    g_assert_cmpint (positions[i].y_advance, ==, expected_positions[i].y_advance);
+    g_assert_cmpint (positions[i].x_offset,  ==, expected_positions[i].x_offset);
+    g_assert_cmpint (positions[i].y_offset,  ==, expected_positions[i].y_offset);
+  }
+}
+
+static hb_buffer_t *
+create_buffer (const hb_codepoint_t *text, unsigned int len,
+	       hb_buffer_cluster_level_t cluster_level)
+{
+  hb_buffer_t *buffer = hb_buffer_create ();
+  hb_buffer_add_utf32 (buffer, text, len, 0, len);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_buffer_set_cluster_level (buffer, cluster_level);
+  return buffer;
+}
+
+
+typedef struct {
+  const char *font_path;
+  hb_codepoint_t characters[8];
+} incremental_test_t;
+
+static const incremental_test_t incremental_tests[] = {
+  /* Malayalam; the ZWNJ decides whether reph forms across the edit. */
+  {"../shaping/fonts/sha1sum/270b89df543a7e48e206a2d830c0e10e5265c630.ttf",
+   {0x0D31, 0x0D4D, 0x200C, 0x200D, 0x0D15}},
+  /* Devanagari. */
+  {"../shaping/fonts/sha1sum/d629e7fedc0b350222d7987345fe61613fa3929a.ttf",
+   {0x0915, 0x093F, 0x094D, 0x0930, 0x200D, 0x200C, 0x0020}},
+  /* Arabic, with cursive attachment and marks. */
+  {"../shaping/fonts/sha1sum/c4e48b0886ef460f532fb49f00047ec92c432ec0.ttf",
+   {0x0643, 0x0645, 0x062B, 0x0644, 0x0627, 0x0020}},
+};
+
+#define INCREMENTAL_MAX_TEXT 60
+#define INCREMENTAL_MAX_INSERT 4
+#define INCREMENTAL_ITERATIONS 5000
+
+static unsigned int
+incremental_random (unsigned int *seed, unsigned int n)
+{
+  *seed = *seed * 1103515245 + 12345;
+  return (*seed >> 16) % n;
+}
+
+/* Random edits of random text must shape the same as with hb_shape(). */
+static void
+test_shape_incremental_random (void)
+{
+  unsigned int t;
+
+  for (t = 0; t < G_N_ELEMENTS (incremental_tests); t++)
+  {
+    const incremental_test_t *test = &incremental_tests[t];
+    hb_font_t *font = open_font (test->font_path);
+    unsigned int num_characters = 0;
+    unsigned int seed = t + 1;
+    unsigned int n;
+
+    while (num_characters < G_N_ELEMENTS (test->characters) && test->characters[num_characters])
+      num_characters++;
+
+    for (n = 0; n < INCREMENTAL_ITERATIONS; n++)
+    {
+      hb_codepoint_t old_text[INCREMENTAL_MAX_TEXT];
+      hb_codepoint_t new_text[INCREMENTAL_MAX_TEXT + INCREMENTAL_MAX_INSERT];
+      unsigned int old_len, new_len, edit_start, edit_old_end, inserted, i;
+      hb_buffer_cluster_level_t cluster_level;
+      hb_buffer_t *previous, *buffer, *expected;
+
+      old_len = 1 + incremental_random (&seed, INCREMENTAL_MAX_TEXT);
+      for (i = 0; i < old_len; i++)
+	old_text[i] = test->characters[incremental_random (&seed, num_characters)];
+      edit_start = incremental_random (&seed, old_len + 1);
+      edit_old_end = edit_start + incremental_random (&seed, old_len - edit_start + 1);
+      inserted = incremental_random (&seed, INCREMENTAL_MAX_INSERT + 1);
+
+      new_len = 0;
+      for (i = 0; i < edit_start; i++)
+	new_text[new_len++] = old_text[i];
+      for (i = 0; i < inserted; i++)
+	new_text[new_len++] = test->characters[incremental_random (&seed, num_characters)];
+      for (i = edit_old_end; i < old_len; i++)
+	new_text[new_len++] = old_text[i];
+
+      cluster_level = incremental_random (&seed, 2) ?
+		      HB_BUFFER_CLUSTER_LEVEL_MONOTONE_CHARACTERS :
+		      HB_BUFFER_CLUSTER_LEVEL_MONOTONE_GRAPHEMES;
+
+      previous = create_buffer (old_text, old_len, cluster_level);
+      hb_shape (font, previous, NULL, 0);
+
+      buffer = create_buffer (new_text, new_len, cluster_level);
+      g_assert (hb_shape_incremental (font, buffer, NULL, 0, previous,
+				      edit_start, edit_old_end, edit_start + inserted));
+
+      expected = create_buffer (new_text, new_len, cluster_level);
+      hb_shape (font, expected, NULL, 0);
+
+      assert_same_glyphs (buffer, expected);
+
+      hb_buffer_destroy (expected);
+      hb_buffer_destroy (buffer);
+      hb_buffer_destroy (previous);
+    }
+
+    hb_font_destroy (font);
+  }
+}
+
+
+static const hb_codepoint_t cache_text[] = {0x0643, 0x0645, 0x062B, 0x0644, 0x0627, 0x064E, 0x0020, 0x0643};
+static const char *cache_font_path = "../shaping/fonts/sha1sum/c4e48b0886ef460f532fb49f00047ec92c432ec0.ttf";
+
+/* Shapes text both through cache and with hb_shape_full(), and checks
+ * that the results agree. */
+static void
+shape_cached (hb_shape_cache_t *cache, hb_font_t *font,
+	      const hb_codepoint_t *text, unsigned int len,
+	      hb_buffer_flags_t flags, hb_codepoint_t pre_context)
+{
+  hb_buffer_t *buffer, *expected;
+  hb_buffer_t *buffers[2];
+  unsigned int i;
+
+  for (i = 0; i < 2; i++)
+  {
+    buffers[i] = hb_buffer_create ();
+    hb_buffer_set_flags (buffers[i], flags);
+    if (pre_context)
+      hb_buffer_add_utf32 (buffers[i], &pre_context, 1, 1, 0);
+    hb_buffer_add_utf32 (buffers[i], text, len, 0, len);
+    hb_buffer_guess_segment_properties (buffers[i]);
+  }
+  buffer = buffers[0];
+  expected = buffers[1];
+
+  g_assert (hb_shape_cache_shape (cache, font, buffer, NULL, 0, NULL));
+  g_assert (hb_shape_full (font, expected, NULL, 0, NULL));
+  assert_same_glyphs (buffer, expected);
+
+  hb_buffer_destroy (expected);
+  hb_buffer_destroy (buffer);
+}
+
+static void
+assert_cache_stats (hb_shape_cache_t *cache,
+		    unsigned int expected_hits,
+		    unsigned int expected_misses,
+		    unsigned int expected_entries)
+{
+  unsigned int hits, misses, entries;
+
+  hb_shape_cache_get_stats (cache, &hits, &misses, &entries);
+  g_assert_cmpuint (hits, ==, expected_hits);
+  g_assert_cmpuint (misses, ==, expected_misses);
+  g_assert_cmpuint (entries, ==, expected_entries);
+}
+
+static void
+test_shape_cache_hit (void)
+{
+  hb_font_t *font = open_font (cache_font_path);
+  hb_shape_cache_t *cache = hb_shape_cache_create (64);
+  unsigned int len = G_N_ELEMENTS (cache_text);
+
+  assert_cache_stats (cache, 0, 0, 0);
+
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 0, 1, 1);
+
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 2, 1, 1);
+
+  shape_cached (cache, font, cache_text, len - 1, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 2, 2, 2);
+
+  /* Counts survive clearing. */
+  hb_shape_cache_clear (cache);
+  assert_cache_stats (cache, 2, 2, 0);
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 2, 3, 1);
+
+  hb_shape_cache_destroy (cache);
+  hb_font_destroy (font);
+}
+
+static void
+test_shape_cache_key (void)
+{
+  hb_font_t *font = open_font (cache_font_path);
+  hb_shape_cache_t *cache = hb_shape_cache_create (64);
+  unsigned int len = G_N_ELEMENTS (cache_text);
+  int x_scale, y_scale;
+
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 0, 1, 1);
+
+  hb_font_get_scale (font, &x_scale, &y_scale);
+  hb_font_set_scale (font, x_scale * 2, y_scale * 2);
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 0, 2, 2);
+
+  hb_font_set_ppem (font, 12, 12);
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 0, 3, 3);
+
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_BOT, 0);
+  assert_cache_stats (cache, 0, 4, 4);
+
+  /* Joining with the context changes the shape of the first letter. */
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0x0644);
+  assert_cache_stats (cache, 0, 5, 5);
+
+  /* Back to the settings of the first call. */
+  hb_font_set_ppem (font, 0, 0);
+  hb_font_set_scale (font, x_scale, y_scale);
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 1, 5, 5);
+
+  hb_shape_cache_destroy (cache);
+  hb_font_destroy (font);
+}
+
+static void
+test_shape_cache_eviction (void)
+{
+  hb_font_t *font = open_font (cache_font_path);
+  hb_shape_cache_t *cache = hb_shape_cache_create (16);
+  unsigned int hits, misses, entries, i;
+
+  for (i = 0; i < 200; i++)
+  {
+    hb_codepoint_t text[2] = {cache_text[i % G_N_ELEMENTS (cache_text)], 0x0030 + i};
+    shape_cached (cache, font, text, 2, HB_BUFFER_FLAG_DEFAULT, 0);
+  }
+
+  hb_shape_cache_get_stats (cache, &hits, &misses, &entries);
+  g_assert_cmpuint (hits, ==, 0);
+  g_assert_cmpuint (misses, ==, 200);
+  g_assert_cmpuint (entries, >, 0);
+  g_assert_cmpuint (entries, <=, 16);
+
+  hb_shape_cache_destroy (cache);
+  hb_font_destroy (font);
+}
+
+static void
+test_shape_cache_empty (void)
+{
+  hb_font_t *font = open_font (cache_font_path);
+  hb_shape_cache_t *cache;
+  unsigned int len = G_N_ELEMENTS (cache_text);
+
+  cache = hb_shape_cache_create (0);
+  g_assert (cache == hb_shape_cache_get_empty ());
+
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  shape_cached (cache, font, cache_text, len, HB_BUFFER_FLAG_DEFAULT, 0);
+  assert_cache_stats (cache, 0, 0, 0);
+
+  hb_shape_cache_clear (cache);
+  hb_shape_cache_destroy (cache);
+  hb_font_destroy (font);
+}
+
+
+/* Fallback mark positioning in a sub-font follows the parent's scale. */
+static void
+test_shape_sub_font_parent_scale (void)
+{
+  static const hb_codepoint_t text[] = {0x0078, 0x030A, 0x0058, 0x030A};
+  hb_font_t *parent = open_font ("../shaping/fonts/sha1sum/6466d38c62e73a39202435a4f73bf5d6acbb73c0.ttf");
+  hb_font_t *font = hb_font_create_sub_font (parent);
+  hb_font_t *fresh;
+  hb_buffer_t *buffer, *expected;
+  int x_scale, y_scale;
+
+  buffer = create_buffer (text, G_N_ELEMENTS (text), HB_BUFFER_CLUSTER_LEVEL_CHARACTERS);
+  hb_shape (font, buffer, NULL, 0);
+  hb_buffer_destroy (buffer);
+
+  /* Coarse enough for the parent's rounding to show through. */
+  hb_font_set_scale (parent, 10, 10);
+
+  buffer = create_buffer (text, G_N_ELEMENTS (text), HB_BUFFER_CLUSTER_LEVEL_CHARACTERS);
+  hb_shape (font, buffer, NULL, 0);
+
+  hb_font_get_scale (font, &x_scale, &y_scale);
+  fresh = hb_font_create_sub_font (parent);
+  hb_font_set_scale (fresh, x_scale, y_scale);
+  expected = create_buffer (text, G_N_ELEMENTS (text), HB_BUFFER_CLUSTER_LEVEL_CHARACTERS);
+  hb_shape (fresh, expected, NULL, 0);
+
+  assert_same_glyphs (buffer, expected);
+
+  hb_buffer_destroy (expected);
+  hb_buffer_destroy (buffer);
+  hb_font_destroy (fresh);
+  hb_font_destroy (font);
+  hb_font_destroy (parent);
+}
+
+/* Preparing the Arabic fallback lookups ahead of time changes nothing
+ * but when they are built. */
+static void
+test_shape_fallback_prepare (void)
+{
+  static const hb_codepoint_t text[] = {0x0633, 0x064F, 0x0644, 0x064E, 0x0651, 0x0627, 0x0651, 0x0650, 0x0645, 0x062A, 0x06CC};
+  const char *font_path = "../shaping/fonts/sha1sum/df768b9c257e0c9c35786c47cae15c46571d56be.ttf";
+  hb_font_t *font, *other;
+  hb_buffer_t *buffer, *expected;
+  hb_codepoint_t glyph;
+  unsigned int len;
+
+  /* Fallback built on first use. */
+  font = open_font (font_path);
+  g_assert (!hb_ot_layout_has_substitution (hb_font_get_face (font)));
+  expected = create_buffer (text, G_N_ELEMENTS (text), HB_BUFFER_CLUSTER_LEVEL_MONOTONE_GRAPHEMES);
+  hb_shape (font, expected, NULL, 0);
+  hb_font_destroy (font);
+
+  /* Fallback prepared, on a new face. */
+  font = open_font (font_path);
+  g_assert (hb_ot_shape_fallback_prepare (font));
+  g_assert (hb_ot_shape_fallback_prepare (font));
+  buffer = create_buffer (text, G_N_ELEMENTS (text), HB_BUFFER_CLUSTER_LEVEL_MONOTONE_GRAPHEMES);
+  hb_shape (font, buffer, NULL, 0);
+  assert_same_glyphs (buffer, expected);
+  hb_buffer_destroy (buffer);
+
+  /* Another font of the face shares it. */
+  other = hb_font_create (hb_font_get_face (font));
+  hb_ot_font_set_funcs (other);
+  buffer = create_buffer (text, G_N_ELEMENTS (text), HB_BUFFER_CLUSTER_LEVEL_MONOTONE_GRAPHEMES);
+  hb_shape (other, buffer, NULL, 0);
+  assert_same_glyphs (buffer, expected);
+  hb_buffer_destroy (buffer);
+
+  /* The initial form came from the fallback lookups. */
+  g_assert (hb_font_get_nominal_glyph (font, 0x0633, &glyph));
+  len = hb_buffer_get_length (expected);
+  g_assert_cmpuint (len, >, 0);
+  g_assert_cmphex (hb_buffer_get_glyph_infos (expected, NULL)[len - 1].codepoint, !=, glyph);
+
+  hb_buffer_destroy (expected);
+  hb_font_destroy (other);
+  hb_font_destroy (font);
+}
+
+
+int
+main (int argc, char **argv)
+{
+  hb_test_init (&argc, &argv);
+
+  hb_test_add (test_shape_incremental_random);
+
+  hb_test_add (test_shape_cache_hit);
+  hb_test_add (test_shape_cache_key);
+  hb_test_add (test_shape_cache_eviction);
+  hb_test_add (test_shape_cache_empty);
+
+  hb_test_add (test_shape_sub_font_parent_scale);
+
+  hb_test_add (test_shape_fallback_prepare);
+
+  return hb_test_run();
+}
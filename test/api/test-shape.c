@@ -120,11 +120,13 @@ test_shape (void)
     const hb_codepoint_t output_glyphs[] = {1, 2, 3, 1};
     const hb_position_t output_x_advances[] = {9, 5, 5, 10};
     const hb_position_t output_x_offsets[] = {0, -1, 0, 0};
+    const hb_glyph_flags_t output_flags[] = {0, HB_GLYPH_FLAG_UNSAFE_TO_BREAK, 0, 0};
     unsigned int i;
     g_assert_cmpint (len, ==, 4);
     for (i = 0; i < len; i++) {
       g_assert_cmphex (glyphs[i].codepoint, ==, output_glyphs[i]);
       g_assert_cmphex (glyphs[i].cluster,   ==, i);
+      g_assert_cmphex (hb_glyph_info_get_glyph_flags (&glyphs[i]), ==, output_flags[i]);
     }
     for (i = 0; i < len; i++) {
       g_assert_cmpint (output_x_advances[i], ==, positions[i].x_advance);
@@ -138,6 +140,69 @@ test_shape (void)
   hb_font_destroy (font);
 }
 
+static void
+test_shape_incremental (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  hb_font_funcs_t *ffuncs;
+  hb_font_t *font;
+  hb_buffer_t *previous, *buffer, *expected;
+  const char old_text[] = "TesTTesTTesTTesTTesTTesT";
+  const char new_text[] = "TesTTesTTesTTeTTesTTesTTesT";
+  unsigned int len, expected_len, i;
+  hb_glyph_info_t *glyphs, *expected_glyphs;
+  hb_glyph_position_t *positions, *expected_positions;
+
+  blob = hb_blob_create (test_data, sizeof (test_data), HB_MEMORY_MODE_READONLY, NULL, NULL);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+  font = hb_font_create (face);
+  hb_face_destroy (face);
+  hb_font_set_scale (font, 10, 10);
+
+  ffuncs = hb_font_funcs_create ();
+  hb_font_funcs_set_glyph_h_advance_func (ffuncs, glyph_h_advance_func, NULL, NULL);
+  hb_font_funcs_set_glyph_func (ffuncs, glyph_func, malloc (10), free);
+  hb_font_funcs_set_glyph_h_kerning_func (ffuncs, glyph_h_kerning_func, NULL, NULL);
+  hb_font_set_funcs (font, ffuncs, NULL, NULL);
+  hb_font_funcs_destroy (ffuncs);
+
+  previous = hb_buffer_create ();
+  hb_buffer_set_direction (previous, HB_DIRECTION_LTR);
+  hb_buffer_add_utf8 (previous, old_text, -1, 0, -1);
+  hb_shape (font, previous, NULL, 0);
+
+  /* "sT" at 14 replaced with "TTesT". */
+  buffer = hb_buffer_create ();
+  hb_buffer_set_direction (buffer, HB_DIRECTION_LTR);
+  hb_buffer_add_utf8 (buffer, new_text, -1, 0, -1);
+  g_assert (hb_shape_incremental (font, buffer, NULL, 0, previous, 14, 16, 19));
+
+  expected = hb_buffer_create ();
+  hb_buffer_set_direction (expected, HB_DIRECTION_LTR);
+  hb_buffer_add_utf8 (expected, new_text, -1, 0, -1);
+  hb_shape (font, expected, NULL, 0);
+
+  glyphs = hb_buffer_get_glyph_infos (buffer, &len);
+  positions = hb_buffer_get_glyph_positions (buffer, NULL);
+  expected_glyphs = hb_buffer_get_glyph_infos (expected, &expected_len);
+  expected_positions = hb_buffer_get_glyph_positions (expected, NULL);
+
+  g_assert_cmpint (len, ==, expected_len);
+  for (i = 0; i < len; i++) {
+    g_assert_cmphex (glyphs[i].codepoint, ==, expected_glyphs[i].codepoint);
+    g_assert_cmphex (glyphs[i].cluster,   ==, expected_glyphs[i].cluster);
+    g_assert_cmpint (positions[i].x_advance, ==, expected_positions[i].x_advance);
+    g_assert_cmpint (positions[i].x_offset,  ==, expected_positions[i].x_offset);
+  }
+
+  hb_buffer_destroy (expected);
+  hb_buffer_destroy (buffer);
+  hb_buffer_destroy (previous);
+  hb_font_destroy (font);
+}
+
 static void
 test_shape_clusters (void)
 {
@@ -199,6 +264,7 @@ main (int argc, char **argv)
   hb_test_init (&argc, &argv);
 
   hb_test_add (test_shape);
+  hb_test_add (test_shape_incremental);
   hb_test_add (test_shape_clusters);
   /* TODO test fallback shaper */
   /* TODO test shaper_full */
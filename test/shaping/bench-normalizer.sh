@@ -0,0 +1,41 @@
+#!/bin/bash
+
+# Times shaping every test in the given .tests files N times each, with
+# the single-pass normalizer and with the reference one
+# (HB_OPTIONS=normalize-in-rounds).
+#
+# Usage: bench-normalizer.sh [-n N] [TESTS-FILE...]
+
+test "x$srcdir" = x && srcdir=.
+test "x$top_builddir" = x && top_builddir=../..
+
+hb_shape=$top_builddir/util/hb-shape$EXEEXT
+
+iterations=1000
+if test "x$1" = x-n; then
+	iterations=$2
+	shift 2
+fi
+
+if test $# = 0; then
+	set "$srcdir"/tests/*.tests
+fi
+
+shape_all ()
+{
+	for f in "$@"; do
+		while IFS=: read fontfile options unicodes glyphs_expected; do
+			if echo "$fontfile" | grep -q '^#'; then
+				continue
+			fi
+			$srcdir/hb-unicode-encode "$unicodes" |
+			$hb_shape --num-iterations=$iterations $options "$srcdir/$fontfile" > /dev/null
+		done < "$f"
+	done
+}
+
+echo "Single-pass normalizer, $iterations iterations:"
+time HB_OPTIONS= shape_all "$@"
+echo
+echo "Reference normalizer, $iterations iterations:"
+time HB_OPTIONS=normalize-in-rounds shape_all "$@"
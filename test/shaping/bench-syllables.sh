@@ -0,0 +1,46 @@
+#!/bin/bash
+
+# Times shaping long Indic, Myanmar and USE texts N times each; mostly
+# useful to compare syllable machine changes.  Each text file is shaped
+# as one paragraph.  Any font will do, as the syllable machines run
+# whether or not it has glyphs for the text.
+#
+# Usage: bench-syllables.sh [-n N] FONT-FILE [TEXT-FILE...]
+
+test "x$srcdir" = x && srcdir=.
+test "x$top_builddir" = x && top_builddir=../..
+
+hb_shape=$top_builddir/util/hb-shape$EXEEXT
+
+iterations=100
+if test "x$1" = x-n; then
+	iterations=$2
+	shift 2
+fi
+
+if test $# = 0; then
+	echo "Usage: $0 [-n N] FONT-FILE [TEXT-FILE...]" >&2
+	exit 1
+fi
+fontfile=$1
+shift
+
+shape_all ()
+{
+	for f in "$@"; do
+		tr '\n' ' ' < "$f" |
+		$hb_shape --num-iterations=$iterations "$fontfile" > /dev/null
+	done
+}
+
+if test $# != 0; then
+	echo "$iterations iterations:"
+	time shape_all "$@"
+	exit
+fi
+
+for shaper in indic myanmar use; do
+	echo "shaper-$shaper texts, $iterations iterations:"
+	time shape_all `find "$srcdir/texts/in-tree/shaper-$shaper" -name '*.txt' | sort`
+	echo
+done
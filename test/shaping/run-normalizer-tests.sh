@@ -0,0 +1,41 @@
+#!/bin/sh
+
+# Shapes every test in the given .tests files with the single-pass
+# normalizer and with the reference one (HB_OPTIONS=normalize-in-rounds),
+# and fails if any of them differ.
+
+test "x$srcdir" = x && srcdir=.
+test "x$builddir" = x && builddir=.
+test "x$top_builddir" = x && top_builddir=../..
+
+hb_shape=$top_builddir/util/hb-shape$EXEEXT
+
+fails=0
+
+if test $# = 0; then
+	set "$srcdir"/tests/*.tests
+fi
+
+for f in "$@"; do
+	echo "Comparing normalizers on $f"
+	while IFS=: read fontfile options unicodes glyphs_expected; do
+		if echo "$fontfile" | grep -q '^#'; then
+			continue
+		fi
+		glyphs=`$srcdir/hb-unicode-encode "$unicodes" | $hb_shape $options "$srcdir/$fontfile"`
+		reference=`$srcdir/hb-unicode-encode "$unicodes" | HB_OPTIONS=normalize-in-rounds $hb_shape $options "$srcdir/$fontfile"`
+		if ! test "x$glyphs" = "x$reference"; then
+			echo "Mismatch for $fontfile:$unicodes" >&2
+			echo "Single-pass: $glyphs" >&2
+			echo "Reference:   $reference" >&2
+			fails=$((fails+1))
+		fi
+	done < "$f"
+done
+
+if test $fails != 0; then
+	echo "$fails tests differ."
+	exit 1
+else
+	echo "All tests match."
+fi
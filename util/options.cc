@@ -265,6 +265,7 @@ view_options_t::add_options (option_parser_t *parser)
     {"foreground",	0, 0, G_OPTION_ARG_STRING,	&this->fore,			"Set foreground color (default: " DEFAULT_FORE ")",	"rrggbb/rrggbbaa"},
     {"line-space",	0, 0, G_OPTION_ARG_DOUBLE,	&this->line_space,		"Set space between lines (default: 0)",			"units"},
     {"margin",		0, 0, G_OPTION_ARG_CALLBACK,	(gpointer) &parse_margin,	"Margin around output (default: " G_STRINGIFY(DEFAULT_MARGIN) ")","one to four numbers"},
+    {"render-jobs",	0, 0, G_OPTION_ARG_INT,		&this->render_jobs,		"Render image output in N bands on parallel threads",	"N"},
     {NULL}
   };
   parser->add_group (entries,
@@ -294,6 +295,9 @@ shape_options_t::add_options (option_parser_t *parser)
     {"cluster-level",	0, 0, G_OPTION_ARG_INT,		&this->cluster_level,		"Cluster merging level (default: 0)",	"0/1/2"},
     {"normalize-glyphs",0, 0, G_OPTION_ARG_NONE,	&this->normalize_glyphs,	"Rearrange glyph clusters in nominal order",	NULL},
     {"num-iterations",	0, 0, G_OPTION_ARG_INT,		&this->num_iterations,		"Run shaper N times (default: 1)",	"N"},
+    {"jobs",		0, 0, G_OPTION_ARG_INT,		&this->num_jobs,		"Shape lines on N threads, keeping output order; reports throughput to stderr",	"N"},
+    {"lookup-stats",	0, 0, G_OPTION_ARG_NONE,	&this->lookup_stats,		"Print per-lookup statistics to stderr when done",	NULL},
+    {"benchmark",	0, 0, G_OPTION_ARG_NONE,	&this->benchmark,		"Time each shaping call and print latency percentiles to stderr when done",	NULL},
     {NULL}
   };
   parser->add_group (entries,
@@ -350,6 +354,231 @@ shape_options_t::add_options (option_parser_t *parser)
 		     this);
 }
 
+struct lookup_stats_entry_t
+{
+  hb_tag_t table_tag;
+  unsigned int lookup_index;
+  hb_ot_layout_lookup_stats_t stats;
+};
+
+static gint
+lookup_stats_entry_cmp (gconstpointer pa, gconstpointer pb)
+{
+  const lookup_stats_entry_t *a = (const lookup_stats_entry_t *) pa;
+  const lookup_stats_entry_t *b = (const lookup_stats_entry_t *) pb;
+  /* Most expensive first. */
+  if (a->stats.cycles != b->stats.cycles)
+    return a->stats.cycles < b->stats.cycles ? 1 : -1;
+  if (a->stats.glyphs_examined != b->stats.glyphs_examined)
+    return a->stats.glyphs_examined < b->stats.glyphs_examined ? 1 : -1;
+  if (a->table_tag != b->table_tag)
+    return a->table_tag == HB_OT_TAG_GSUB ? -1 : 1;
+  return (int) a->lookup_index - (int) b->lookup_index;
+}
+
+void
+shape_options_t::print_lookup_stats (hb_face_t *face, FILE *fp)
+{
+  static const hb_tag_t table_tags[] = {HB_OT_TAG_GSUB, HB_OT_TAG_GPOS};
+  GArray *entries = g_array_new (false, false, sizeof (lookup_stats_entry_t));
+  uint64_t total_cycles = 0;
+
+  for (unsigned int t = 0; t < ARRAY_LENGTH (table_tags); t++)
+  {
+    unsigned int count = hb_ot_layout_table_get_lookup_count (face, table_tags[t]);
+    for (unsigned int i = 0; i < count; i++)
+    {
+      lookup_stats_entry_t entry;
+      entry.table_tag = table_tags[t];
+      entry.lookup_index = i;
+      if (!hb_ot_layout_lookup_get_stats (face, entry.table_tag, i, &entry.stats) ||
+	  !entry.stats.applications)
+	continue;
+      total_cycles += entry.stats.cycles;
+      g_array_append_val (entries, entry);
+    }
+  }
+  g_array_sort (entries, lookup_stats_entry_cmp);
+
+  fprintf (fp, "%-6s%8s%14s%16s%16s%18s%8s\n",
+	   "table", "lookup", "applications", "examined", "matched", "cycles", "%");
+  for (unsigned int i = 0; i < entries->len; i++)
+  {
+    const lookup_stats_entry_t &entry = g_array_index (entries, lookup_stats_entry_t, i);
+    fprintf (fp, "%-6s%8u%14" G_GUINT64_FORMAT "%16" G_GUINT64_FORMAT "%16" G_GUINT64_FORMAT "%18" G_GUINT64_FORMAT "%8.2f\n",
+	     entry.table_tag == HB_OT_TAG_GSUB ? "GSUB" : "GPOS",
+	     entry.lookup_index,
+	     (guint64) entry.stats.applications,
+	     (guint64) entry.stats.glyphs_examined,
+	     (guint64) entry.stats.glyphs_matched,
+	     (guint64) entry.stats.cycles,
+	     total_cycles ? 100. * entry.stats.cycles / total_cycles : 0.);
+  }
+
+  g_array_free (entries, true);
+}
+
+struct benchmark_sample_t
+{
+  hb_segment_properties_t props;
+  unsigned int length;		/* In characters, before shaping. */
+  gint64 ns;
+};
+
+void
+shape_options_t::add_benchmark_sample (hb_buffer_t *buffer, unsigned int length, gint64 ns)
+{
+  if (!benchmark_samples)
+  {
+    benchmark_first_calls = g_array_new (false, false, sizeof (benchmark_sample_t));
+    benchmark_samples = g_array_new (false, false, sizeof (benchmark_sample_t));
+  }
+
+  benchmark_sample_t sample;
+  hb_buffer_get_segment_properties (buffer, &sample.props);
+  sample.length = length;
+  sample.ns = ns;
+
+  /* The first call with some segment properties creates the shape plan,
+   * and the very first call loads the face tables, so those are kept
+   * apart from the steady state. */
+  for (unsigned int i = 0; i < benchmark_first_calls->len; i++)
+    if (hb_segment_properties_equal (&g_array_index (benchmark_first_calls, benchmark_sample_t, i).props,
+				     &sample.props))
+    {
+      g_array_append_val (benchmark_samples, sample);
+      return;
+    }
+  g_array_append_val (benchmark_first_calls, sample);
+}
+
+static gint
+benchmark_ns_cmp (gconstpointer pa, gconstpointer pb)
+{
+  gint64 a = *(const gint64 *) pa;
+  gint64 b = *(const gint64 *) pb;
+  return a < b ? -1 : a > b ? 1 : 0;
+}
+
+static unsigned int
+benchmark_length_bucket (unsigned int length)
+{
+  unsigned int bucket = 0;
+  while (length)
+  {
+    bucket++;
+    length >>= 1;
+  }
+  return bucket;
+}
+
+static void
+benchmark_script_label (hb_script_t script, char label[5])
+{
+  if (script == HB_SCRIPT_INVALID)
+  {
+    strcpy (label, "-");
+    return;
+  }
+  hb_tag_to_string (hb_script_to_iso15924_tag (script), label);
+  label[4] = '\0';
+}
+
+/* Prints one row of nearest-rank percentiles of the times in ns, which
+ * it sorts. */
+static void
+print_benchmark_row (FILE *fp, const char *label, GArray *ns)
+{
+  if (!ns->len)
+    return;
+  g_array_sort (ns, benchmark_ns_cmp);
+  gint64 total = 0;
+  for (unsigned int i = 0; i < ns->len; i++)
+    total += g_array_index (ns, gint64, i);
+#define PERCENTILE(p) (g_array_index (ns, gint64, (ns->len * p + 99) / 100 - 1) / 1000.)
+  fprintf (fp, "  %-12s%10u%12.2f%10.2f%10.2f%10.2f%12.2f\n",
+	   label, ns->len, total / 1000. / ns->len,
+	   PERCENTILE (50), PERCENTILE (90), PERCENTILE (99), PERCENTILE (100));
+#undef PERCENTILE
+  g_array_set_size (ns, 0);
+}
+
+void
+shape_options_t::print_benchmark (FILE *fp)
+{
+  if (!benchmark_samples)
+    return;
+
+  fprintf (fp, "First calls (plan creation, face data loading):\n");
+  fprintf (fp, "  %-8s%-10s%-12s%8s%12s\n", "script", "direction", "language", "chars", "us");
+  for (unsigned int i = 0; i < benchmark_first_calls->len; i++)
+  {
+    const benchmark_sample_t &sample = g_array_index (benchmark_first_calls, benchmark_sample_t, i);
+    char script[5];
+    benchmark_script_label (sample.props.script, script);
+    const char *language = hb_language_to_string (sample.props.language);
+    fprintf (fp, "  %-8s%-10s%-12s%8u%12.2f\n",
+	     script, hb_direction_to_string (sample.props.direction),
+	     language ? language : "-", sample.length, sample.ns / 1000.);
+  }
+
+  GArray *ns = g_array_new (false, false, sizeof (gint64));
+  GArray *samples = benchmark_samples;
+
+  static const char header[] = "  %-12s%10s%12s%10s%10s%10s%12s\n";
+  fprintf (fp, "Steady state, in us:\n");
+  fprintf (fp, header, "chars", "calls", "mean", "p50", "p90", "p99", "max");
+  unsigned int max_bucket = 0;
+  for (unsigned int i = 0; i < samples->len; i++)
+    max_bucket = MAX (max_bucket, benchmark_length_bucket (g_array_index (samples, benchmark_sample_t, i).length));
+  for (unsigned int bucket = 0; bucket <= max_bucket; bucket++)
+  {
+    for (unsigned int i = 0; i < samples->len; i++)
+    {
+      const benchmark_sample_t &sample = g_array_index (samples, benchmark_sample_t, i);
+      if (benchmark_length_bucket (sample.length) == bucket)
+	g_array_append_val (ns, sample.ns);
+    }
+    char label[32];
+    if (bucket <= 1)
+      snprintf (label, sizeof (label), "%u", bucket);
+    else
+      snprintf (label, sizeof (label), "%u-%u", 1u << (bucket - 1), (1u << bucket) - 1);
+    print_benchmark_row (fp, label, ns);
+  }
+
+  fprintf (fp, header, "script", "calls", "mean", "p50", "p90", "p99", "max");
+  GArray *scripts = g_array_new (false, false, sizeof (hb_script_t));
+  for (unsigned int i = 0; i < samples->len; i++)
+  {
+    hb_script_t script = g_array_index (samples, benchmark_sample_t, i).props.script;
+    unsigned int j;
+    for (j = 0; j < scripts->len; j++)
+      if (g_array_index (scripts, hb_script_t, j) == script)
+	break;
+    if (j < scripts->len)
+      continue;
+    g_array_append_val (scripts, script);
+
+    for (j = i; j < samples->len; j++)
+    {
+      const benchmark_sample_t &sample = g_array_index (samples, benchmark_sample_t, j);
+      if (sample.props.script == script)
+	g_array_append_val (ns, sample.ns);
+    }
+    char label[5];
+    benchmark_script_label (script, label);
+    print_benchmark_row (fp, label, ns);
+  }
+  g_array_free (scripts, true);
+
+  for (unsigned int i = 0; i < samples->len; i++)
+    g_array_append_val (ns, g_array_index (samples, benchmark_sample_t, i).ns);
+  print_benchmark_row (fp, "all", ns);
+
+  g_array_free (ns, true);
+}
+
 static gboolean
 parse_font_size (const char *name G_GNUC_UNUSED,
 		 const char *arg,
@@ -711,6 +940,7 @@ format_options_t::add_options (option_parser_t *parser)
     {"no-clusters",	0, G_OPTION_FLAG_REVERSE,
 			      G_OPTION_ARG_NONE,	&this->show_clusters,		"Do not output cluster indices",					NULL},
     {"show-extents",	0, 0, G_OPTION_ARG_NONE,	&this->show_extents,		"Output glyph extents",							NULL},
+    {"show-flags",	0, 0, G_OPTION_ARG_NONE,	&this->show_flags,		"Output glyph flags",							NULL},
     {NULL}
   };
   parser->add_group (entries,
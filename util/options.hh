@@ -40,6 +40,7 @@
 #include <locale.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <time.h>
 #ifdef HAVE_UNISTD_H
 #include <unistd.h> /* for isatty() */
 #endif
@@ -154,6 +155,7 @@ struct view_options_t : option_group_t
     back = NULL;
     line_space = 0;
     margin.t = margin.r = margin.b = margin.l = DEFAULT_MARGIN;
+    render_jobs = 0;
 
     add_options (parser);
   }
@@ -172,6 +174,7 @@ struct view_options_t : option_group_t
   struct margin_t {
     double t, r, b, l;
   } margin;
+  unsigned int render_jobs;
 };
 
 
@@ -188,6 +191,11 @@ struct shape_options_t : option_group_t
     cluster_level = HB_BUFFER_CLUSTER_LEVEL_DEFAULT;
     normalize_glyphs = false;
     num_iterations = 1;
+    num_jobs = 0;
+    lookup_stats = false;
+    benchmark = false;
+    benchmark_first_calls = NULL;
+    benchmark_samples = NULL;
 
     add_options (parser);
   }
@@ -198,6 +206,10 @@ struct shape_options_t : option_group_t
     g_free (script);
     free (features);
     g_strfreev (shapers);
+    if (benchmark_first_calls)
+      g_array_free (benchmark_first_calls, true);
+    if (benchmark_samples)
+      g_array_free (benchmark_samples, true);
   }
 
   void add_options (option_parser_t *parser);
@@ -245,12 +257,31 @@ struct shape_options_t : option_group_t
 
   hb_bool_t shape (hb_font_t *font, hb_buffer_t *buffer)
   {
+    unsigned int length = hb_buffer_get_length (buffer);
+    gint64 start = benchmark ? get_time_ns () : 0;
     hb_bool_t res = hb_shape_full (font, buffer, features, num_features, shapers);
+    if (benchmark)
+      add_benchmark_sample (buffer, length, get_time_ns () - start);
     if (normalize_glyphs)
       hb_buffer_normalize_glyphs (buffer);
     return res;
   }
 
+  void print_lookup_stats (hb_face_t *face, FILE *fp);
+
+  static gint64 get_time_ns (void)
+  {
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * (gint64) 1000000000 + ts.tv_nsec;
+#else
+    return g_get_monotonic_time () * 1000;
+#endif
+  }
+  void add_benchmark_sample (hb_buffer_t *buffer, unsigned int length, gint64 ns);
+  void print_benchmark (FILE *fp);
+
   void shape_closure (const char *text, int text_len,
 		      hb_font_t *font, hb_buffer_t *buffer,
 		      hb_set_t *glyphs)
@@ -278,6 +309,13 @@ struct shape_options_t : option_group_t
   hb_buffer_cluster_level_t cluster_level;
   hb_bool_t normalize_glyphs;
   unsigned int num_iterations;
+  unsigned int num_jobs;
+  hb_bool_t lookup_stats;
+  hb_bool_t benchmark;
+
+  private:
+  GArray *benchmark_first_calls;	/* The first call for each segment properties. */
+  GArray *benchmark_samples;		/* All other calls. */
 };
 
 
@@ -431,6 +469,7 @@ struct format_options_t : option_group_t
     show_unicode = false;
     show_line_num = false;
     show_extents = false;
+    show_flags = false;
 
     add_options (parser);
   }
@@ -472,6 +511,7 @@ struct format_options_t : option_group_t
   hb_bool_t show_unicode;
   hb_bool_t show_line_num;
   hb_bool_t show_extents;
+  hb_bool_t show_flags;
 };
 
 /* fallback implementation for scalbn()/scalbnf() for pre-2013 MSVC */
@@ -30,6 +30,29 @@
 #define HB_SHAPE_CONSUMER_HH
 
 
+/* With --jobs, lines are shaped on worker threads sharing the font, in
+ * batches of SHAPE_JOB_LINES, each line with its own buffer.  The output is
+ * still fed from the main thread, in input order, as the oldest pending
+ * batch gets done. */
+
+#if GLIB_CHECK_VERSION (2, 32, 0)
+#define HAVE_SHAPE_JOBS 1
+#endif
+
+#define SHAPE_JOB_LINES 32
+
+struct shape_job_t
+{
+  unsigned int num_lines;
+  GString *text;		/* The lines, back to back. */
+  unsigned int starts[SHAPE_JOB_LINES + 1];
+  hb_buffer_t *buffers[SHAPE_JOB_LINES];
+  bool failed[SHAPE_JOB_LINES];
+  const char *text_before;
+  const char *text_after;
+  bool done;
+};
+
 template <typename output_t>
 struct shape_consumer_t
 {
@@ -42,8 +65,15 @@ struct shape_consumer_t
   void init (const font_options_t *font_opts)
   {
     font = hb_font_reference (font_opts->get_font ());
+    if (shaper.lookup_stats &&
+	!hb_ot_layout_lookup_stats_enable (hb_font_get_face (font)))
+      fail (false, "Failed enabling lookup statistics");
+    if (shaper.benchmark && shaper.num_jobs)
+      fail (true, "--benchmark cannot be used with --jobs");
     output.init (font_opts);
     failed = false;
+    if (shaper.num_jobs)
+      start_jobs ();
   }
   void consume_line (hb_buffer_t  *buffer,
 		     const char   *text,
@@ -51,6 +81,12 @@ struct shape_consumer_t
 		     const char   *text_before,
 		     const char   *text_after)
   {
+    if (shaper.num_jobs)
+    {
+      queue_line (text, text_len, text_before, text_after);
+      return;
+    }
+
     output.new_line ();
 
     for (unsigned int n = shaper.num_iterations; n; n--)
@@ -70,11 +106,185 @@ struct shape_consumer_t
   }
   void finish (const font_options_t *font_opts)
   {
+    if (shaper.num_jobs)
+      finish_jobs ();
     output.finish (font_opts);
+    if (shaper.lookup_stats)
+      shaper.print_lookup_stats (hb_font_get_face (font), stderr);
+    if (shaper.benchmark)
+      shaper.print_benchmark (stderr);
     hb_font_destroy (font);
     font = NULL;
   }
 
+#ifdef HAVE_SHAPE_JOBS
+  protected:
+  void start_jobs (void)
+  {
+    text_buffer = hb_buffer_create ();
+    filling = NULL;
+    pending = g_queue_new ();
+    free_jobs = g_queue_new ();
+    todo = g_async_queue_new ();
+    g_mutex_init (&mutex);
+    g_cond_init (&cond);
+    num_lines = num_glyphs = 0;
+    start_time = g_get_monotonic_time ();
+
+    threads = g_new (GThread *, shaper.num_jobs);
+    for (unsigned int i = 0; i < shaper.num_jobs; i++)
+      threads[i] = g_thread_new ("shape", worker, this);
+  }
+
+  void queue_line (const char   *text,
+		   unsigned int  text_len,
+		   const char   *text_before,
+		   const char   *text_after)
+  {
+    if (!filling)
+    {
+      /* Bound the batches in flight, so memory use does not grow with
+       * the input when the output falls behind. */
+      if (g_queue_get_length (pending) >= shaper.num_jobs * 4)
+	output_job ();
+
+      filling = (shape_job_t *) g_queue_pop_head (free_jobs);
+      if (!filling)
+      {
+	filling = g_new0 (shape_job_t, 1);
+	filling->text = g_string_new (NULL);
+      }
+      filling->num_lines = 0;
+      filling->starts[0] = 0;
+      g_string_truncate (filling->text, 0);
+      filling->text_before = text_before;
+      filling->text_after = text_after;
+      filling->done = false;
+    }
+
+    shape_job_t *job = filling;
+    unsigned int i = job->num_lines++;
+    g_string_append_len (job->text, text, text_len);
+    job->starts[i + 1] = job->text->len;
+    if (!job->buffers[i])
+      job->buffers[i] = hb_buffer_create ();
+
+    if (job->num_lines == SHAPE_JOB_LINES)
+      queue_job ();
+  }
+
+  void queue_job (void)
+  {
+    g_queue_push_tail (pending, filling);
+    g_async_queue_push (todo, filling);
+    filling = NULL;
+  }
+
+  static gpointer worker (gpointer data)
+  {
+    shape_consumer_t *c = (shape_consumer_t *) data;
+    shape_job_t *job;
+    while ((job = (shape_job_t *) g_async_queue_pop (c->todo)) != &c->stop_job)
+    {
+      for (unsigned int i = 0; i < job->num_lines; i++)
+      {
+	const char *text = job->text->str + job->starts[i];
+	unsigned int text_len = job->starts[i + 1] - job->starts[i];
+	bool ok = true;
+	for (unsigned int n = c->shaper.num_iterations; n && ok; n--)
+	{
+	  c->shaper.populate_buffer (job->buffers[i], text, text_len,
+				     job->text_before, job->text_after);
+	  ok = c->shaper.shape (c->font, job->buffers[i]);
+	}
+	job->failed[i] = !ok;
+      }
+
+      g_mutex_lock (&c->mutex);
+      job->done = true;
+      g_cond_signal (&c->cond);
+      g_mutex_unlock (&c->mutex);
+    }
+    return NULL;
+  }
+
+  /* Waits for the oldest pending batch and outputs its lines. */
+  void output_job (void)
+  {
+    shape_job_t *job = (shape_job_t *) g_queue_pop_head (pending);
+    g_mutex_lock (&mutex);
+    while (!job->done)
+      g_cond_wait (&cond, &mutex);
+    g_mutex_unlock (&mutex);
+
+    for (unsigned int i = 0; i < job->num_lines; i++)
+    {
+      const char *text = job->text->str + job->starts[i];
+      unsigned int text_len = job->starts[i + 1] - job->starts[i];
+      hb_buffer_t *buffer = job->buffers[i];
+
+      output.new_line ();
+      shaper.populate_buffer (text_buffer, text, text_len, job->text_before, job->text_after);
+      output.consume_text (text_buffer, text, text_len, shaper.utf8_clusters);
+      if (job->failed[i])
+      {
+	failed = true;
+	hb_buffer_set_length (buffer, 0);
+	output.shape_failed (buffer, text, text_len, shaper.utf8_clusters);
+      }
+      else
+	output.consume_glyphs (buffer, text, text_len, shaper.utf8_clusters);
+
+      num_glyphs += hb_buffer_get_length (buffer);
+    }
+    num_lines += job->num_lines;
+
+    g_queue_push_tail (free_jobs, job);
+  }
+
+  void finish_jobs (void)
+  {
+    if (filling)
+      queue_job ();
+    while (!g_queue_is_empty (pending))
+      output_job ();
+
+    for (unsigned int i = 0; i < shaper.num_jobs; i++)
+      g_async_queue_push (todo, &stop_job);
+    for (unsigned int i = 0; i < shaper.num_jobs; i++)
+      g_thread_join (threads[i]);
+    g_free (threads);
+
+    double seconds = (g_get_monotonic_time () - start_time) / (double) G_USEC_PER_SEC;
+    if (seconds <= 0)
+      seconds = 1. / G_USEC_PER_SEC;
+    fprintf (stderr, "%u lines, %" G_GUINT64_FORMAT " glyphs in %.3fs on %u threads: "
+		     "%.0f lines/s, %.0f glyphs/s\n",
+	     num_lines, num_glyphs, seconds, shaper.num_jobs,
+	     num_lines / seconds, num_glyphs / seconds);
+
+    shape_job_t *job;
+    while ((job = (shape_job_t *) g_queue_pop_head (free_jobs)))
+    {
+      for (unsigned int i = 0; i < SHAPE_JOB_LINES; i++)
+	hb_buffer_destroy (job->buffers[i]);
+      g_string_free (job->text, true);
+      g_free (job);
+    }
+    g_queue_free (free_jobs);
+    g_queue_free (pending);
+    g_async_queue_unref (todo);
+    g_mutex_clear (&mutex);
+    g_cond_clear (&cond);
+    hb_buffer_destroy (text_buffer);
+  }
+#else
+  protected:
+  void start_jobs (void) { fail (true, "--jobs needs GLib 2.32 or newer"); }
+  void queue_line (const char *, unsigned int, const char *, const char *) {}
+  void finish_jobs (void) {}
+#endif
+
   public:
   bool failed;
 
@@ -83,7 +293,22 @@ struct shape_consumer_t
   output_t output;
 
   hb_font_t *font;
-};
 
+#ifdef HAVE_SHAPE_JOBS
+  /* --jobs state. */
+  GThread **threads;
+  GAsyncQueue *todo;		/* Batches for the workers, then stop_job once per worker. */
+  shape_job_t *filling;		/* Batch being filled from the input, or NULL. */
+  GQueue *pending;		/* Batches queued and not output yet, in input order. */
+  GQueue *free_jobs;		/* Output batches, with their buffers, to reuse. */
+  GMutex mutex;			/* Protects shape_job_t::done. */
+  GCond cond;
+  shape_job_t stop_job;
+  hb_buffer_t *text_buffer;	/* For output.consume_text (), on the main thread. */
+  unsigned int num_lines;
+  guint64 num_glyphs;
+  gint64 start_time;
+#endif
+};
 
 #endif
@@ -28,13 +28,15 @@
 
 #include <assert.h>
 
+#if GLIB_CHECK_VERSION (2, 32, 0)
+#define HAVE_RENDER_BANDS 1
+#endif
+
 
 void
 view_cairo_t::render (const font_options_t *font_opts)
 {
   bool vertical = HB_DIRECTION_IS_VERTICAL (direction);
-  int vert  = vertical ? 1 : 0;
-  int horiz = vertical ? 0 : 1;
 
   int x_sign = font_opts->font_size_x < 0 ? -1 : +1;
   int y_sign = font_opts->font_size_y < 0 ? -1 : +1;
@@ -90,44 +92,200 @@ view_cairo_t::render (const font_options_t *font_opts)
    }
 
   /* Draw. */
-  cairo_translate (cr, +vert * leading, -horiz * leading);
+  if (view_options.render_jobs > 1 &&
+      cairo_surface_get_type (cairo_get_target (cr)) == CAIRO_SURFACE_TYPE_IMAGE)
+    render_bands (cr, scaled_font, leading, vertical);
+  else
+    for (unsigned int i = 0; i < lines->len; i++)
+      draw_line (cr, i, leading, vertical);
+
+  /* Clean up. */
+  helper_cairo_destroy_context (cr);
+  cairo_scaled_font_destroy (scaled_font);
+}
+
+
+static void
+translate_to_line (cairo_t *cr, unsigned int i, double leading, bool vertical)
+{
+  /* We stack lines right to left, or top to bottom. */
+  if (vertical)
+    cairo_translate (cr, -(double) i * leading, 0);
+  else
+    cairo_translate (cr, 0, (double) i * leading);
+}
+
+void
+view_cairo_t::draw_line (cairo_t *cr, unsigned int i, double leading, bool vertical)
+{
+  helper_cairo_line_t &l = g_array_index (lines, helper_cairo_line_t, i);
+
+  cairo_save (cr);
+  translate_to_line (cr, i, leading, vertical);
+
+  if (view_options.annotate) {
+    cairo_save (cr);
+
+    /* Draw actual glyph origins */
+    cairo_set_source_rgba (cr, 1., 0., 0., .5);
+    cairo_set_line_width (cr, 5);
+    cairo_set_line_cap (cr, CAIRO_LINE_CAP_ROUND);
+    for (unsigned i = 0; i < l.num_glyphs; i++) {
+      cairo_move_to (cr, l.glyphs[i].x, l.glyphs[i].y);
+      cairo_rel_line_to (cr, 0, 0);
+    }
+    cairo_stroke (cr);
+
+    cairo_restore (cr);
+  }
+
+  if (0 && cairo_surface_get_type (cairo_get_target (cr)) == CAIRO_SURFACE_TYPE_IMAGE) {
+    /* cairo_show_glyphs() doesn't support subpixel positioning */
+    cairo_glyph_path (cr, l.glyphs, l.num_glyphs);
+    cairo_fill (cr);
+  } else if (l.num_clusters)
+    cairo_show_text_glyphs (cr,
+			    l.utf8, l.utf8_len,
+			    l.glyphs, l.num_glyphs,
+			    l.clusters, l.num_clusters,
+			    l.cluster_flags);
+  else
+    cairo_show_glyphs (cr, l.glyphs, l.num_glyphs);
+
+  cairo_restore (cr);
+}
+
+
+/* With --render-jobs, image output is split into bands across the lines,
+ * each drawn on its own thread into its own image surface over its part of
+ * the target's pixels, so no cairo object is drawn to from two threads.
+ * The bands share the scaled font, and with it cairo's cache of rasterized
+ * glyphs, so a glyph is still rasterized once per subpixel phase for the
+ * whole image. */
+
+struct view_cairo_band_t
+{
+  view_cairo_t *view;
+  cairo_t *cr;
+  double start, end;		/* Device-space range along the line-stacking axis. */
+  const double *line_bounds;	/* Same, for the ink of each line. */
+  double leading;
+  bool vertical;
+};
+
+gpointer
+view_cairo_t::render_band (gpointer data)
+{
+  view_cairo_band_t *band = (view_cairo_band_t *) data;
+  view_cairo_t *view = band->view;
+  for (unsigned int i = 0; i < view->lines->len; i++)
+    if (band->line_bounds[2 * i] < band->end && band->line_bounds[2 * i + 1] > band->start)
+      view->draw_line (band->cr, i, band->leading, band->vertical);
+  return NULL;
+}
+
+void
+view_cairo_t::render_bands (cairo_t *cr, cairo_scaled_font_t *scaled_font,
+			    double leading, bool vertical)
+{
+#ifdef HAVE_RENDER_BANDS
+  cairo_surface_t *target = cairo_get_target (cr);
+  int width = cairo_image_surface_get_width (target);
+  int height = cairo_image_surface_get_height (target);
+  int length = vertical ? width : height;
+  /* Column bands start at multiples of four pixels, for pixman to find
+   * them aligned in A8 surfaces. */
+  int unit = vertical ? 4 : 1;
+  unsigned int num_bands = MIN<unsigned int> (view_options.render_jobs, MAX ((length + unit - 1) / unit, 1));
+
+  /* Find where each line's ink and glyph origins land, so bands can skip
+   * the lines they do not touch.  Padded for the annotation strokes. */
+  double *line_bounds = g_new (double, 2 * lines->len);
   for (unsigned int i = 0; i < lines->len; i++)
   {
     helper_cairo_line_t &l = g_array_index (lines, helper_cairo_line_t, i);
+    cairo_text_extents_t extents;
+    cairo_scaled_font_glyph_extents (scaled_font, l.glyphs, l.num_glyphs, &extents);
+    double x_advance, y_advance;
+    l.get_advance (&x_advance, &y_advance);
+    double x[2], y[2];
+    x[0] = MIN (MIN (0., x_advance), extents.x_bearing);
+    y[0] = MIN (MIN (0., y_advance), extents.y_bearing);
+    x[1] = MAX (MAX (0., x_advance), extents.x_bearing + extents.width);
+    y[1] = MAX (MAX (0., y_advance), extents.y_bearing + extents.height);
 
-    cairo_translate (cr, -vert * leading, +horiz * leading);
+    cairo_save (cr);
+    translate_to_line (cr, i, leading, vertical);
+    double lo = HUGE_VAL, hi = -HUGE_VAL;
+    for (unsigned int corner = 0; corner < 4; corner++)
+    {
+      double dx = x[corner & 1], dy = y[corner >> 1];
+      cairo_user_to_device (cr, &dx, &dy);
+      double d = vertical ? dx : dy;
+      lo = MIN (lo, d);
+      hi = MAX (hi, d);
+    }
+    cairo_restore (cr);
+    line_bounds[2 * i] = lo - 4;
+    line_bounds[2 * i + 1] = hi + 4;
+  }
 
-    if (view_options.annotate) {
-      cairo_save (cr);
+  cairo_matrix_t matrix;
+  cairo_get_matrix (cr, &matrix);
 
-      /* Draw actual glyph origins */
-      cairo_set_source_rgba (cr, 1., 0., 0., .5);
-      cairo_set_line_width (cr, 5);
-      cairo_set_line_cap (cr, CAIRO_LINE_CAP_ROUND);
-      for (unsigned i = 0; i < l.num_glyphs; i++) {
-	cairo_move_to (cr, l.glyphs[i].x, l.glyphs[i].y);
-	cairo_rel_line_to (cr, 0, 0);
-      }
-      cairo_stroke (cr);
+  cairo_surface_flush (target);
+  unsigned char *data = cairo_image_surface_get_data (target);
+  cairo_format_t format = cairo_image_surface_get_format (target);
+  int stride = cairo_image_surface_get_stride (target);
+  int pixel_size = format == CAIRO_FORMAT_A8 ? 1 : 4;
+  view_cairo_band_t *bands = g_new (view_cairo_band_t, num_bands);
+  GThread **threads = g_new (GThread *, num_bands);
+  for (unsigned int b = 0; b < num_bands; b++)
+  {
+    int units = (length + unit - 1) / unit;
+    int start = (int) ((gint64) units * b / num_bands) * unit;
+    int end = MIN (length, (int) ((gint64) units * (b + 1) / num_bands) * unit);
+    cairo_surface_t *surface = vertical ?
+			       cairo_image_surface_create_for_data (data + start * pixel_size, format,
+								    end - start, height, stride) :
+			       cairo_image_surface_create_for_data (data + start * stride, format,
+								    width, end - start, stride);
 
-      cairo_restore (cr);
-    }
+    view_cairo_band_t &band = bands[b];
+    band.view = this;
+    band.cr = cairo_create (surface);
+    cairo_surface_destroy (surface);
+    band.start = start;
+    band.end = end;
+    band.line_bounds = line_bounds;
+    band.leading = leading;
+    band.vertical = vertical;
 
-    if (0 && cairo_surface_get_type (cairo_get_target (cr)) == CAIRO_SURFACE_TYPE_IMAGE) {
-      /* cairo_show_glyphs() doesn't support subpixel positioning */
-      cairo_glyph_path (cr, l.glyphs, l.num_glyphs);
-      cairo_fill (cr);
-    } else if (l.num_clusters)
-      cairo_show_text_glyphs (cr,
-			      l.utf8, l.utf8_len,
-			      l.glyphs, l.num_glyphs,
-			      l.clusters, l.num_clusters,
-			      l.cluster_flags);
-    else
-      cairo_show_glyphs (cr, l.glyphs, l.num_glyphs);
+    /* Same state as cr, in band coordinates. */
+    cairo_translate (band.cr, vertical ? -start : 0, vertical ? 0 : -start);
+    cairo_transform (band.cr, &matrix);
+    cairo_set_scaled_font (band.cr, scaled_font);
+    cairo_set_source (band.cr, cairo_get_source (cr));
+    cairo_set_operator (band.cr, cairo_get_operator (cr));
+
+    threads[b] = g_thread_new ("render", render_band, &band);
   }
 
-  /* Clean up. */
-  helper_cairo_destroy_context (cr);
-  cairo_scaled_font_destroy (scaled_font);
+  for (unsigned int b = 0; b < num_bands; b++)
+  {
+    g_thread_join (threads[b]);
+    cairo_status_t status = cairo_status (bands[b].cr);
+    if (status != CAIRO_STATUS_SUCCESS)
+      fail (false, "Failed: %s", cairo_status_to_string (status));
+    cairo_destroy (bands[b].cr);
+  }
+  cairo_surface_mark_dirty (target);
+
+  g_free (threads);
+  g_free (bands);
+  g_free (line_bounds);
+#else
+  for (unsigned int i = 0; i < lines->len; i++)
+    draw_line (cr, i, leading, vertical);
+#endif
 }
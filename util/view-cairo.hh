@@ -95,6 +95,10 @@ struct view_cairo_t
   view_options_t view_options;
 
   void render (const font_options_t *font_opts);
+  void draw_line (cairo_t *cr, unsigned int i, double leading, bool vertical);
+  void render_bands (cairo_t *cr, cairo_scaled_font_t *scaled_font,
+		     double leading, bool vertical);
+  static gpointer render_band (gpointer data);
 
   hb_direction_t direction; // Remove this, make segment_properties accessible
   GArray *lines;